@@ -10,6 +10,7 @@ extern "C"
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifndef _IDN2_API
 # if defined IDN2_BUILDING && defined HAVE_VISIBILITY && HAVE_VISIBILITY
@@ -45,6 +46,17 @@ extern _IDN2_API int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupname, in
 extern _IDN2_API int idn2_lookup_ul(const char *src, char **lookupname, int flags);
 extern _IDN2_API int idn2_to_unicode_8z8z(const char *src, char **lookupname, int flags);
 
+/* Non-allocating variants of the functions above.
+ * src is srclen bytes long and does not need to be NUL-terminated.
+ * The result is written to dest (destlen bytes including the terminating NUL),
+ * its length without the NUL is stored in *outlen if outlen is not NULL.
+ * The processing object for the flags is created once and shared between calls,
+ * nothing is allocated per call. */
+
+extern _IDN2_API int idn2_lookup_u8_buf(const uint8_t *src, size_t srclen, uint8_t *dest, size_t destlen, size_t *outlen, int flags);
+extern _IDN2_API int idn2_lookup_ul_buf(const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen, int flags);
+extern _IDN2_API int idn2_to_unicode_8z8z_buf(const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen, int flags);
+
 typedef enum {
 	IDN2_OK = 0,
 	IDN2_MALLOC = -100,
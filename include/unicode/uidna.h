@@ -27,6 +27,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef U_EXPORT
     /* Use the predefined value. */
@@ -388,7 +389,32 @@ enum {
 	 * UTS #46 does not require the CONTEXTO check.
 	 * @stable ICU 49
 	 */
-	UIDNA_CHECK_CONTEXTO = 0x40
+	UIDNA_CHECK_CONTEXTO = 0x40,
+	/**
+	 * IDNA option for input that is already mapped and in NFC, for example from a source
+	 * that normalized it before: well-formed, with no characters that UTS #46 maps or disallows
+	 * after the first non-ASCII one. The input is then used as is, without the UTS #46 mapping
+	 * and normalization pass. Instead, the label validation looks up the UTS #46 status of each code point
+	 * and reports mapped, ignored and disallowed ones with UIDNA_ERROR_DISALLOWED;
+	 * ASCII uppercase letters are still lowercased.
+	 * Input that is not in NFC is not normalized, so its results can differ from those without this option.
+	 * Builds with UIDNA_VERIFY_TRUSTED_NFC defined assert that the input is normalized.
+	 * For use in static worker and factory methods.
+	 * <p>This option is ignored by the IDNA2003 implementation.
+	 */
+	UIDNA_TRUSTED_NFC_INPUT = 0x80,
+	/**
+	 * IDNA option for callers that reject names with errors anyway, such as untrusted query input:
+	 * processing stops as soon as one of the fail-fast errors is found, without building the rest of the result
+	 * (no U+FFFD replacements, no Punycode, no further labels, no BiDi and length checks of the whole name).
+	 * The fail-fast errors are all UIDNA_ERROR_... bits, or those set with uidna_setFailFastErrors().
+	 * A result with one of them is empty (length 0), and pInfo->errors has at least that one
+	 * but may lack others that full processing would find. Results without them are not affected.
+	 * The dual conversions uidna_nameToASCIIDual*() and uidna_nameToASCIIAndUnicodeUTF8() ignore this option.
+	 * For use in static worker and factory methods.
+	 * <p>This option is ignored by the IDNA2003 implementation.
+	 */
+	UIDNA_FAIL_FAST = 0x100
 };
 
 struct UIDNA;
@@ -629,6 +655,455 @@ U_CAPI int32_t uidna_nameToASCII_UTF8(const UIDNA *idna, const char *name, int32
 U_CAPI int32_t uidna_nameToUnicodeUTF8(const UIDNA *idna, const char *name, int32_t length,
 		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
 
+/**
+ * Like uidna_nameToASCII_UTF8(), but without copying names that are already in canonical form:
+ * if the result would be identical to the input and have no errors (lowercase ASCII with valid labels and length),
+ * *pResult is set to name itself, *pIsUnchanged to true, and dest is not written, not even NUL-terminated.
+ * Names with A-labels ("xn--") are always copied, because they have to be decoded to be checked.
+ * Otherwise *pResult is set to dest, which receives the result as with uidna_nameToASCII_UTF8(),
+ * including U_BUFFER_OVERFLOW_ERROR if it does not fit.
+ * dest can be NULL with a capacity of 0 for callers that only want the result when it is the input.
+ *
+ * @param idna UIDNA instance
+ * @param name Input domain name
+ * @param length Domain name length, or -1 if NUL-terminated
+ * @param dest Destination string buffer, used only if the name changes or has errors
+ * @param capacity Destination buffer capacity
+ * @param pResult Receives the start of the result: name or dest, must not be NULL.
+ * @param pIsUnchanged Receives true if the result is the input name, can be NULL.
+ * @param pInfo Output container of IDNA processing details.
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return result length
+ */
+U_CAPI int32_t uidna_nameToASCII_UTF8_view(const UIDNA *idna, const char *name, int32_t length,
+		char *dest, int32_t capacity, const char **pResult, UBool *pIsUnchanged, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Converts a whole domain name into its ASCII form with both nontransitional and transitional processing,
+ * whatever the UIDNA_NONTRANSITIONAL_TO_ASCII option of idna, for callers that need both forms.
+ * The name is mapped and normalized once, and only the labels with deviation characters
+ * (U+00DF, U+03C2, ZWNJ, ZWJ) are processed twice, which is cheaper than two uidna_nameToASCII() calls.
+ *
+ * dest and pInfo receive the nontransitional result.
+ * If pInfo->isTransitionalDifferent, the transitional result is written to transDest
+ * and its length to *pTransLength; otherwise both results are the one in dest,
+ * transDest is not written and *pTransLength is set to -1.
+ * pTransInfo always receives the transitional processing details.
+ * If either result does not fit, U_BUFFER_OVERFLOW_ERROR is set and both lengths are returned.
+ *
+ * @param idna UIDNA instance
+ * @param name Input domain name
+ * @param length Domain name length, or -1 if NUL-terminated
+ * @param dest Destination string buffer for the nontransitional result
+ * @param capacity Destination buffer capacity
+ * @param pInfo Output container of the nontransitional IDNA processing details, must not be NULL.
+ * @param transDest Destination string buffer for the transitional result
+ * @param transCapacity Transitional destination buffer capacity
+ * @param pTransLength Receives the transitional result length, or -1, must not be NULL.
+ * @param pTransInfo Output container of the transitional IDNA processing details, can be NULL.
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return nontransitional destination string length
+ */
+U_CAPI int32_t uidna_nameToASCIIDual(const UIDNA *idna, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo,
+		UChar *transDest, int32_t transCapacity, int32_t *pTransLength, UIDNAInfo *pTransInfo, UErrorCode *pErrorCode);
+
+/**
+ * UTF-8 version of uidna_nameToASCIIDual(), same behavior as uidna_nameToASCII_UTF8() for each result.
+ */
+U_CAPI int32_t uidna_nameToASCIIDual_UTF8(const UIDNA *idna, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo,
+		char *transDest, int32_t transCapacity, int32_t *pTransLength, UIDNAInfo *pTransInfo, UErrorCode *pErrorCode);
+
+/**
+ * Output container of uidna_nameToASCIIAndUnicodeUTF8(): the errors of its two results, split by direction.
+ */
+typedef struct UIDNAASCIIAndUnicodeInfo {
+    /**
+     * Set to true if transitional and nontransitional processing produce different results.
+     */
+    UBool isTransitionalDifferent;
+    /**
+     * UIDNA_ERROR_... bits set for both the ASCII and the Unicode result. 0 if no errors.
+     */
+    uint32_t errors;
+    /**
+     * UIDNA_ERROR_... bits set only for the ASCII result, such as UIDNA_ERROR_LABEL_TOO_LONG.
+     */
+    uint32_t asciiErrors;
+    /**
+     * UIDNA_ERROR_... bits set only for the Unicode result.
+     */
+    uint32_t unicodeErrors;
+} UIDNAASCIIAndUnicodeInfo;
+
+/**
+ * Converts a whole domain name into both its ASCII form for DNS lookup and its Unicode form for display,
+ * the same results as uidna_nameToASCII_UTF8() and uidna_nameToUnicodeUTF8() with the same idna.
+ * The name is mapped, normalized, decoded and validated once; the ASCII form is derived from the Unicode one.
+ * Only labels with deviation characters (U+00DF, U+03C2, ZWNJ, ZWJ) are processed twice,
+ * and only if the UIDNA_NONTRANSITIONAL_TO_ASCII and UIDNA_NONTRANSITIONAL_TO_UNICODE options of idna differ.
+ * If either result does not fit, U_BUFFER_OVERFLOW_ERROR is set and both lengths are returned.
+ *
+ * @param idna UIDNA instance
+ * @param name Input domain name
+ * @param length Domain name length, or -1 if NUL-terminated
+ * @param asciiDest Destination string buffer for the ASCII result
+ * @param asciiCapacity ASCII destination buffer capacity
+ * @param unicodeDest Destination string buffer for the Unicode result
+ * @param unicodeCapacity Unicode destination buffer capacity
+ * @param pUnicodeLength Receives the Unicode result length, must not be NULL.
+ * @param pInfo Output container of IDNA processing details, can be NULL.
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return ASCII destination string length
+ */
+U_CAPI int32_t uidna_nameToASCIIAndUnicodeUTF8(const UIDNA *idna, const char *name, int32_t length,
+		char *asciiDest, int32_t asciiCapacity, char *unicodeDest, int32_t unicodeCapacity, int32_t *pUnicodeLength,
+		UIDNAASCIIAndUnicodeInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Checks a whole domain name for DNS lookup without converting it.
+ * Sets the same pInfo as uidna_nameToASCII(), but does not build the ASCII result:
+ * valid non-ASCII labels are not converted to Punycode, only the length of their Punycode form is determined.
+ * Results of uidna_setCache() are used, but not added.
+ *
+ * @param idna UIDNA instance
+ * @param name Input domain name
+ * @param length Domain name length, or -1 if NUL-terminated
+ * @param pInfo Output container of IDNA processing details, can be NULL.
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Check for U_FAILURE() on output or use with
+ *                  function chaining. (See User Guide for details.)
+ * @return true if the name has no errors
+ */
+U_CAPI UBool uidna_checkName(const UIDNA *idna, const UChar *name, int32_t length,
+		UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * UTF-8 version of uidna_checkName(), same behavior as uidna_nameToASCII_UTF8() for the errors.
+ */
+U_CAPI UBool uidna_checkNameUTF8(const UIDNA *idna, const char *name, int32_t length,
+		UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Returns true if uidna_nameToASCII() would report no errors for the name.
+ * Like uidna_checkName(), but returns at the first error found.
+ *
+ * @param idna UIDNA instance
+ * @param name Input domain name
+ * @param length Domain name length, or -1 if NUL-terminated
+ * @param pErrorCode Standard ICU error code, see uidna_checkName().
+ * @return true if the name has no errors
+ */
+U_CAPI UBool uidna_isValidName(const UIDNA *idna, const UChar *name, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * UTF-8 version of uidna_isValidName(), same behavior as uidna_nameToASCII_UTF8() for the errors.
+ */
+U_CAPI UBool uidna_isValidNameUTF8(const UIDNA *idna, const char *name, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Input element for the batch functions: a UTF-8 domain name.
+ */
+typedef struct UIDNAName {
+    /** Domain name bytes, can be NULL if length is 0 */
+    const char *data;
+    /** Domain name length, or -1 if NUL-terminated */
+    int32_t length;
+} UIDNAName;
+
+/**
+ * Converts an array of domain names into their ASCII forms for DNS lookup.
+ * Same behavior as calling uidna_nameToASCII_UTF8() for each name,
+ * but the arguments are checked once and the results are packed into one arena.
+ *
+ * Result i is written at arena + offsets[i] with lengths[i] bytes, without NUL terminator.
+ * If the arena is too small, then U_BUFFER_OVERFLOW_ERROR is set,
+ * offsets and lengths are still set for all names and the required arena size is returned.
+ * With UIDNA_FAIL_FAST, a name that stops early has a length of 0 and takes up no arena space.
+ *
+ * @param idna UIDNA instance
+ * @param names Input domain names
+ * @param count Number of names
+ * @param arena Destination buffer for all results
+ * @param arenaCapacity Destination buffer capacity
+ * @param offsets Output array of count result offsets in the arena
+ * @param lengths Output array of count result lengths
+ * @param pInfos Output array of count IDNA processing details, can be NULL
+ * @param pErrorCode Standard ICU error code. Its input value must
+ *                  pass the U_SUCCESS() test, or else the function returns
+ *                  immediately. Per-name errors are reported in pInfos only.
+ * @return total length of all results
+ */
+U_CAPI int32_t uidna_nameToASCII_UTF8_batch(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, UErrorCode *pErrorCode);
+
+/**
+ * Converts an array of domain names into their Unicode forms for human-readable display.
+ * Batch version of uidna_nameToUnicodeUTF8(), see uidna_nameToASCII_UTF8_batch().
+ *
+ * @param idna UIDNA instance
+ * @param names Input domain names
+ * @param count Number of names
+ * @param arena Destination buffer for all results
+ * @param arenaCapacity Destination buffer capacity
+ * @param offsets Output array of count result offsets in the arena
+ * @param lengths Output array of count result lengths
+ * @param pInfos Output array of count IDNA processing details, can be NULL
+ * @param pErrorCode Standard ICU error code
+ * @return total length of all results
+ */
+U_CAPI int32_t uidna_nameToUnicodeUTF8_batch(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, UErrorCode *pErrorCode);
+
+/**
+ * Parallel version of uidna_nameToASCII_UTF8_batch(), same results.
+ * Names are converted in chunks by a pool of worker threads with work stealing,
+ * then the results are packed into the arena in input order.
+ *
+ * @param threadCount Number of threads including the calling thread,
+ *                    0 to use all hardware threads
+ * @see uidna_nameToASCII_UTF8_batch
+ */
+U_CAPI int32_t uidna_nameToASCII_UTF8_batchParallel(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos,
+		int32_t threadCount, UErrorCode *pErrorCode);
+
+/**
+ * Parallel version of uidna_nameToUnicodeUTF8_batch(), same results.
+ *
+ * @param threadCount Number of threads including the calling thread,
+ *                    0 to use all hardware threads
+ * @see uidna_nameToASCII_UTF8_batchParallel
+ */
+U_CAPI int32_t uidna_nameToUnicodeUTF8_batchParallel(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos,
+		int32_t threadCount, UErrorCode *pErrorCode);
+
+/**
+ * Result cache statistics, see uidna_getCacheStats().
+ */
+typedef struct UIDNACacheStats {
+    /** Lookups answered from the cache */
+    uint64_t hits;
+    /** Lookups that had to run the conversion */
+    uint64_t misses;
+    /** Entries removed to stay within the memory budget */
+    uint64_t evictions;
+    /** Entries currently in the cache */
+    uint64_t entries;
+    /** Memory currently used by the cache, in bytes */
+    uint64_t memoryUsed;
+} UIDNACacheStats;
+
+/**
+ * Attaches a cache of conversion results to the UIDNA instance, or removes it.
+ *
+ * The cache is used by the UTF-8 conversion functions (including the batch functions),
+ * keyed by the options, the operation and the input bytes. It stores the output
+ * and the error bits, also for invalid input, so cached results are identical
+ * to uncached ones. Lookups do not lock and can run concurrently with insertions;
+ * when the memory budget is reached, least recently used entries are evicted (CLOCK).
+ * Inputs longer than 1024 bytes are not cached.
+ *
+ * Must not be called while other threads use the UIDNA instance.
+ *
+ * @param idna UIDNA instance
+ * @param memoryBudget Maximum cache size in bytes, 0 to remove the cache
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_setCache(UIDNA *idna, int64_t memoryBudget, UErrorCode *pErrorCode);
+
+/**
+ * Returns the counters of the result cache of the UIDNA instance, all 0 if it has no cache.
+ *
+ * @param idna UIDNA instance
+ * @param pStats Output statistics
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_getCacheStats(const UIDNA *idna, UIDNACacheStats *pStats, UErrorCode *pErrorCode);
+
+/**
+ * Attaches a memo of label results to the UIDNA instance, or removes it.
+ *
+ * Labels in Punycode ("xn--...") and labels with non-ASCII characters are remembered
+ * with their converted form and validation errors, so that names which are new as a whole
+ * still skip the Punycode decoding, encoding and validation of their common labels.
+ * Used by both the UTF-16 and the UTF-8 conversion functions, with identical results.
+ * The memo has the same structure as the result cache of uidna_setCache().
+ *
+ * Must not be called while other threads use the UIDNA instance.
+ *
+ * @param idna UIDNA instance
+ * @param memoryBudget Maximum memo size in bytes, 0 to remove the memo
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_setLabelCache(UIDNA *idna, int64_t memoryBudget, UErrorCode *pErrorCode);
+
+/**
+ * Returns the counters of the label memo of the UIDNA instance, all 0 if it has none.
+ *
+ * @param idna UIDNA instance
+ * @param pStats Output statistics
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_getLabelCacheStats(const UIDNA *idna, UIDNACacheStats *pStats, UErrorCode *pErrorCode);
+
+/**
+ * Heap allocation functions for uidna_setAllocator(), with the same semantics as
+ * malloc(), realloc() and free(). The context is the one passed to uidna_setAllocator().
+ */
+typedef void *UIDNAAllocFn(const void *context, size_t size);
+typedef void *UIDNAReallocFn(const void *context, void *mem, size_t size);
+typedef void UIDNAFreeFn(const void *context, void *mem);
+
+/**
+ * Sets the functions for all heap memory of the library: UIDNA objects, strings and buffers
+ * of the conversions, caches and their entries, the call arenas of uidna_setCallArena(),
+ * the bookkeeping of the parallel batch functions and the results of the idn2 functions.
+ * Only the stacks of the parallel batch threads come from the system.
+ * All three functions must be set, or all NULL to return to malloc(), realloc() and free().
+ *
+ * Must be called before any other function of the library, while no other thread uses it,
+ * unless the previous functions are compatible with the new ones (memory allocated by one
+ * can be freed by the other).
+ *
+ * @param context User context passed to the functions
+ * @param a Allocation function
+ * @param r Reallocation function
+ * @param f Free function
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_setAllocator(const void *context, UIDNAAllocFn *a, UIDNAReallocFn *r, UIDNAFreeFn *f, UErrorCode *pErrorCode);
+
+/**
+ * Enables a bump-pointer arena for the temporary memory of each conversion call on the UIDNA instance.
+ *
+ * Each thread gets one arena block, allocated on its first call and reused by all later calls
+ * (sized for the largest capacity used on the thread, each call uses at most its own); temporaries are carved from it and the whole block is reset when the call returns
+ * (for the batch functions: after each name). Temporaries that do not fit go to the heap as usual,
+ * so a block of a few KB keeps steady-state conversions of typical host names free of heap traffic.
+ * Cache entries are always allocated on the heap.
+ *
+ * Must not be called while other threads use the UIDNA instance.
+ *
+ * @param idna UIDNA instance
+ * @param capacity Arena block size in bytes, 0 to disable the arena
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_setCallArena(UIDNA *idna, int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Sets the errors that stop the processing of a UIDNA instance opened with UIDNA_FAIL_FAST,
+ * for example UIDNA_ERROR_DISALLOWED | UIDNA_ERROR_PUNYCODE to reject only garbage early
+ * but convert names with other errors in full. The default is all errors.
+ * Has no effect without UIDNA_FAIL_FAST.
+ *
+ * Must not be called while other threads use the UIDNA instance.
+ *
+ * @param idna UIDNA instance
+ * @param errors Bit set of UIDNA_ERROR_... values, 0 to process all names in full
+ * @param pErrorCode Standard ICU error code
+ */
+U_CAPI void uidna_setFailFastErrors(UIDNA *idna, uint32_t errors, UErrorCode *pErrorCode);
+
+/**
+ * Conversion context: scratch memory that is kept across calls, see uidna_openContext().
+ */
+struct UIDNAContext;
+typedef struct UIDNAContext UIDNAContext;
+
+/**
+ * Opens a conversion context for the *_WithContext() functions.
+ *
+ * The context owns an arena for the temporary strings and buffers of a conversion call
+ * (mapping, normalization, Punycode, label checks), reset after each call. When a call needed more
+ * than the arena holds, the arena grows to that size before the next call (up to 1 MB, or the initial capacity
+ * if larger), so a thread that keeps one context reaches a steady state without heap allocations,
+ * with its scratch memory staying warm in the caches.
+ *
+ * A context must not be used by more than one thread at a time.
+ * It can be used with any UIDNA instance. It takes precedence over the arena of uidna_setCallArena().
+ *
+ * @param capacity Initial arena size in bytes, can be 0
+ * @param pErrorCode Standard ICU error code
+ * @return the context, or NULL on failure
+ */
+U_CAPI UIDNAContext *uidna_openContext(int32_t capacity, UErrorCode *pErrorCode);
+
+/**
+ * Closes a context opened with uidna_openContext().
+ *
+ * @param context Context to close, can be NULL
+ */
+U_CAPI void uidna_closeContext(UIDNAContext *context);
+
+/**
+ * Same as uidna_labelToASCII(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_labelToASCII_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *label, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_labelToUnicode(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_labelToUnicode_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *label, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_nameToASCII(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_nameToASCII_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_nameToUnicode(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_nameToUnicode_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_labelToASCII_UTF8(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_labelToASCII_UTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *label, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_labelToUnicodeUTF8(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_labelToUnicodeUTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *label, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_nameToASCII_UTF8(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_nameToASCII_UTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
+/**
+ * Same as uidna_nameToUnicodeUTF8(), with the temporaries of the call in the context.
+ * @see uidna_openContext
+ */
+U_CAPI int32_t uidna_nameToUnicodeUTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode);
+
 /*
  * IDNA error bit set values.
  * When a domain name or label fails a processing step or does not meet the
@@ -735,9 +1210,9 @@ enum {
  * string output rules.
  *
  * @param src Input Unicode string.
- *            This function handles a limited amount of code points
- *            (the limit is >=64).
- *            U_INDEX_OUTOFBOUNDS_ERROR is set if the limit is exceeded.
+ *            This function handles a limited amount of code units
+ *            (the limit is 1000).
+ *            U_INPUT_TOO_LONG_ERROR is set if the limit is exceeded.
  * @param srcLength Number of UChars in src, or -1 if NUL-terminated.
  * @param dest Output Punycode array.
  * @param destCapacity Size of dest.
@@ -753,8 +1228,8 @@ enum {
  * @param pErrorCode ICU in/out error code parameter.
  *                   U_INVALID_CHAR_FOUND if src contains
  *                   unmatched single surrogates.
- *                   U_INDEX_OUTOFBOUNDS_ERROR if src contains
- *                   too many code points.
+ *                   U_INPUT_TOO_LONG_ERROR if src contains
+ *                   too many code units.
  * @return Number of ASCII characters in puny.
  *
  * @see u_strFromPunycode
@@ -794,6 +1269,54 @@ U_CAPI int32_t u_strToPunycode(const UChar *src, int32_t srcLength, UChar *dest,
 U_CAPI int32_t u_strFromPunycode(const UChar *src, int32_t srcLength, UChar *dest, int32_t destCapacity,
 		UBool *caseFlags, UErrorCode *pErrorCode);
 
+/**
+ * u_strToPunycodeUTF8() converts Unicode to Punycode, like u_strToPunycode(),
+ * but reads UTF-8 and writes the Punycode as chars, without case flags.
+ * The code points are read directly from UTF-8, without an intermediate UTF-16 string.
+ *
+ * @param src Input UTF-8 string.
+ *            The same limit applies as for u_strToPunycode(), counted in UTF-16 code units.
+ * @param srcLength Number of bytes in src, or -1 if NUL-terminated.
+ * @param dest Output Punycode buffer.
+ * @param destCapacity Size of dest.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   U_INVALID_CHAR_FOUND if src is not well-formed UTF-8.
+ *                   U_INPUT_TOO_LONG_ERROR if src contains too many code units.
+ *                   U_BUFFER_OVERFLOW_ERROR if dest is too short;
+ *                   the return value is then the required length.
+ * @return Number of chars in the Punycode string.
+ *
+ * @see u_strFromPunycodeUTF8
+ */
+U_CAPI int32_t u_strToPunycodeUTF8(const char *src, int32_t srcLength, char *dest, int32_t destCapacity,
+		UErrorCode *pErrorCode);
+
+/**
+ * u_strFromPunycodeUTF8() converts Punycode to Unicode, like u_strFromPunycode(),
+ * but writes UTF-8, without case flags.
+ * The decoded code points are written directly as UTF-8, without an intermediate UTF-16 string.
+ * ASCII characters before the last delimiter keep their case.
+ *
+ * @param src Input Punycode string, at most 2000 chars.
+ * @param srcLength Length of src, or -1 if NUL-terminated.
+ * @param dest Output UTF-8 buffer.
+ * @param destCapacity Size of dest.
+ * @param pErrorCode ICU in/out error code parameter.
+ *                   U_INVALID_CHAR_FOUND if a non-ASCII character
+ *                   precedes the last delimiter ('-'),
+ *                   or if an invalid character (not a-zA-Z0-9) is found
+ *                   after the last delimiter.
+ *                   U_ILLEGAL_CHAR_FOUND if the delta sequence is ill-formed.
+ *                   U_INPUT_TOO_LONG_ERROR if src is too long.
+ *                   U_BUFFER_OVERFLOW_ERROR if dest is too short;
+ *                   the return value is then the required length.
+ * @return Number of bytes in the Unicode string.
+ *
+ * @see u_strToPunycodeUTF8
+ */
+U_CAPI int32_t u_strFromPunycodeUTF8(const char *src, int32_t srcLength, char *dest, int32_t destCapacity,
+		UErrorCode *pErrorCode);
+
 
 // variants, that do not requires uidna_open
 
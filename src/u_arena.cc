@@ -0,0 +1,217 @@
+
+#include "u_arena.h"
+
+#include <new>
+
+namespace uidna {
+
+static const void *s_allocatorContext = NULL;
+static UIDNAAllocFn *s_allocFn = NULL;
+static UIDNAReallocFn *s_reallocFn = NULL;
+static UIDNAFreeFn *s_freeFn = NULL;
+
+void *heapMalloc(size_t size) {
+	return s_allocFn ? s_allocFn(s_allocatorContext, size) : ::malloc(size);
+}
+
+void *heapRealloc(void *buffer, size_t size) {
+	return s_reallocFn ? s_reallocFn(s_allocatorContext, buffer, size) : ::realloc(buffer, size);
+}
+
+void heapFree(void *buffer) {
+	if (s_freeFn) {
+		s_freeFn(s_allocatorContext, buffer);
+	} else {
+		::free(buffer);
+	}
+}
+
+// The block pointer is stored right before the aligned memory.
+void *heapMallocAligned(size_t size, size_t alignment) {
+	if (alignment < sizeof(void *)) {
+		alignment = sizeof(void *);
+	}
+	if (size > SIZE_MAX - alignment - sizeof(void *)) {
+		return NULL;
+	}
+	char *block = static_cast<char *>(heapMalloc(size + alignment - 1 + sizeof(void *)));
+	if (block == NULL) {
+		return NULL;
+	}
+	uintptr_t aligned = (reinterpret_cast<uintptr_t>(block) + sizeof(void *) + alignment - 1) & ~uintptr_t(alignment - 1);
+	reinterpret_cast<void **>(aligned)[-1] = block;
+	return reinterpret_cast<void *>(aligned);
+}
+
+void heapFreeAligned(void *buffer) {
+	if (buffer != NULL) {
+		heapFree(static_cast<void **>(buffer)[-1]);
+	}
+}
+
+// Each allocation is preceded by its size, for reallocate().
+static constexpr size_t CallArenaHeaderSize = 16;
+
+// Growth steps and limit of context arenas.
+static constexpr size_t CallArenaGranularity = 4096;
+static constexpr size_t CallArenaContextMaxCapacity = 1 << 20;
+
+static thread_local CallArenaState t_threadArena;
+static thread_local CallArenaState *t_activeArena = NULL;
+
+CallArenaState::~CallArenaState() {
+	if (block != NULL) {
+		heapFree(block);
+	}
+}
+
+void *CallArena::allocate(size_t size) {
+	CallArenaState *arena = t_activeArena;
+	if (arena == NULL || arena->suspended != 0) {
+		return NULL;
+	}
+	size_t aligned = (size + CallArenaHeaderSize - 1) & ~(CallArenaHeaderSize - 1);
+	if (aligned < size || arena->limit - arena->used < CallArenaHeaderSize + aligned) {
+		arena->overflow += CallArenaHeaderSize + aligned;
+		return NULL;
+	}
+	char *header = arena->block + arena->used;
+	*reinterpret_cast<size_t *>(header) = size;
+	arena->last = arena->used;
+	arena->used += CallArenaHeaderSize + aligned;
+	if (arena->peak < arena->used) {
+		arena->peak = arena->used;
+	}
+	return header + CallArenaHeaderSize;
+}
+
+UBool CallArena::contains(const void *p) {
+	const CallArenaState *arena = t_activeArena;
+	return arena != NULL && arena->block != NULL && p >= arena->block && p < arena->block + arena->limit;
+}
+
+void *CallArena::reallocate(void *p, size_t size) {
+	CallArenaState &arena = *t_activeArena;
+	char *header = static_cast<char *>(p) - CallArenaHeaderSize;
+	size_t oldSize = *reinterpret_cast<size_t *>(header);
+	if (arena.suspended == 0 && header == arena.block + arena.last) {
+		size_t aligned = (size + CallArenaHeaderSize - 1) & ~(CallArenaHeaderSize - 1);
+		if (aligned >= size && arena.limit - arena.last - CallArenaHeaderSize >= aligned) {
+			*reinterpret_cast<size_t *>(header) = size;
+			arena.used = arena.last + CallArenaHeaderSize + aligned;
+			if (arena.peak < arena.used) {
+				arena.peak = arena.used;
+			}
+			return p;
+		}
+	}
+	void *q = uprv_malloc(size);
+	if (q != NULL) {
+		::memcpy(q, p, oldSize < size ? oldSize : size);
+	}
+	return q;
+}
+
+CallArenaScope::CallArenaScope(int32_t capacity) : state(NULL) {
+	if (t_activeArena != NULL) {
+		state = t_activeArena;
+		++state->depth;
+	} else if (capacity > 0) {
+		open(t_threadArena, size_t(capacity));
+	}
+}
+
+CallArenaScope::CallArenaScope(CallArenaState &arena) : state(NULL) {
+	if (t_activeArena != NULL) {
+		state = t_activeArena;
+		++state->depth;
+	} else {
+		open(arena, arena.capacity);
+	}
+}
+
+void CallArenaScope::open(CallArenaState &arena, size_t capacity) {
+	// No arena memory is in use outside of scopes, the block can be replaced.
+	if (arena.capacity < capacity || (arena.block == NULL && capacity > 0)) {
+		if (arena.block != NULL) {
+			heapFree(arena.block);
+		}
+		arena.block = static_cast<char *>(heapMalloc(capacity));
+		arena.capacity = capacity;
+	}
+	arena.limit = arena.block != NULL ? capacity : 0;
+	arena.used = arena.last = arena.peak = arena.overflow = 0;
+	arena.depth = 1;
+	state = &arena;
+	t_activeArena = &arena;
+}
+
+CallArenaScope::~CallArenaScope() {
+	if (state == NULL || --state->depth > 0) {
+		return;
+	}
+	t_activeArena = NULL;
+	state->used = 0;
+	if (state->maxCapacity > state->capacity && state->overflow > 0) {
+		// Grow to what the call needed; the new block is allocated by the next scope.
+		size_t needed = (state->peak + state->overflow + CallArenaGranularity - 1) & ~(CallArenaGranularity - 1);
+		heapFree(state->block);
+		state->block = NULL;
+		state->capacity = needed < state->maxCapacity ? needed : state->maxCapacity;
+	}
+}
+
+CallArenaSuspend::CallArenaSuspend() : state(t_activeArena) {
+	if (state != NULL) {
+		++state->suspended;
+	}
+}
+
+CallArenaSuspend::~CallArenaSuspend() {
+	if (state != NULL) {
+		--state->suspended;
+	}
+}
+
+}
+
+U_CAPI void uidna_setAllocator(const void *context, UIDNAAllocFn *a, UIDNAReallocFn *r, UIDNAFreeFn *f, UErrorCode *pErrorCode) {
+	if (uidna::U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if ((a == NULL) != (r == NULL) || (a == NULL) != (f == NULL)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	uidna::s_allocatorContext = context;
+	uidna::s_allocFn = a;
+	uidna::s_reallocFn = r;
+	uidna::s_freeFn = f;
+}
+
+U_CAPI UIDNAContext *uidna_openContext(int32_t capacity, UErrorCode *pErrorCode) {
+	if (uidna::U_FAILURE(*pErrorCode)) {
+		return NULL;
+	}
+	if (capacity < 0) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return NULL;
+	}
+	void *memory = uidna::heapMalloc(sizeof(uidna::CallArenaState));
+	if (memory == NULL) {
+		*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+		return NULL;
+	}
+	uidna::CallArenaState *arena = new (memory) uidna::CallArenaState;
+	arena->capacity = size_t(capacity);
+	arena->maxCapacity = size_t(capacity) > uidna::CallArenaContextMaxCapacity ? size_t(capacity) : uidna::CallArenaContextMaxCapacity;
+	return reinterpret_cast<UIDNAContext *>(arena);
+}
+
+U_CAPI void uidna_closeContext(UIDNAContext *context) {
+	if (context != NULL) {
+		uidna::CallArenaState *arena = reinterpret_cast<uidna::CallArenaState *>(context);
+		arena->~CallArenaState();
+		uidna::heapFree(arena);
+	}
+}
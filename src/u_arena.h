@@ -0,0 +1,122 @@
+
+#ifndef MODULES_IDN_UIDNAARENA_H_
+#define MODULES_IDN_UIDNAARENA_H_
+
+#include "u_types.h"
+
+#include <new>
+
+namespace uidna {
+
+// General-purpose heap, through the functions of uidna_setAllocator() if set.
+void *heapMalloc(size_t size);
+void *heapRealloc(void *buffer, size_t size);
+void heapFree(void *buffer);
+
+// Heap memory with a given power-of-two alignment, freed with heapFreeAligned().
+void *heapMallocAligned(size_t size, size_t alignment);
+void heapFreeAligned(void *buffer);
+
+// Base for the library's long-lived objects: new allocates from the heap functions and returns NULL on failure.
+struct HeapObject {
+	static void *operator new(size_t size) noexcept { return heapMalloc(size); }
+	static void *operator new(size_t, void *p) noexcept { return p; }
+	static void operator delete(void *p) noexcept { heapFree(p); }
+};
+
+// Allocator for the standard containers of long-lived objects, on the heap functions.
+template <typename T>
+struct HeapAllocator {
+	typedef T value_type;
+
+	HeapAllocator() = default;
+	template <typename U> HeapAllocator(const HeapAllocator<U> &) { }
+
+	T *allocate(size_t n) {
+		void *p = n <= SIZE_MAX / sizeof(T) ? heapMallocAligned(n * sizeof(T), alignof(T)) : NULL;
+		if (p == NULL) {
+			throw std::bad_alloc();
+		}
+		return static_cast<T *>(p);
+	}
+
+	void deallocate(T *p, size_t) { heapFreeAligned(p); }
+
+	template <typename U> bool operator==(const HeapAllocator<U> &) const { return true; }
+	template <typename U> bool operator!=(const HeapAllocator<U> &) const { return false; }
+};
+
+// Bump-pointer arena for the temporary allocations of conversion calls.
+//
+// While a CallArenaScope is open on a thread, uprv_malloc() takes memory from the scope's arena,
+// and uprv_free() of such memory does nothing. The arena is reset when the outermost scope closes,
+// so no memory allocated inside a scope may be used after it; allocations that must outlive the call
+// (cache entries, shared output buffers) are made under a CallArenaSuspend.
+// Requests that do not fit fall back to the heap.
+//
+// Each thread has its own arena for uidna_setCallArena(), kept for the lifetime of the thread;
+// a UIDNAContext owns another one, which grows to the high-water mark of its calls.
+struct CallArenaState {
+	char *block = NULL;
+	size_t capacity = 0;  // of the block, or the size for the next allocation of the block
+	size_t limit = 0;  // usable part of the block in the current scope
+	size_t used = 0;
+	size_t last = 0;  // header offset of the last allocation
+	size_t peak = 0;
+	size_t overflow = 0;  // bytes of the requests that did not fit
+	size_t maxCapacity = 0;  // growth limit, 0 for a fixed capacity
+	int32_t depth = 0;
+	int32_t suspended = 0;
+
+	CallArenaState() = default;
+	CallArenaState(const CallArenaState &) = delete;
+	CallArenaState &operator=(const CallArenaState &) = delete;
+	~CallArenaState();
+};
+
+class CallArena {
+public:
+	// Returns NULL if no scope is open, the arena is suspended or the request does not fit.
+	static void *allocate(size_t size);
+
+	static UBool contains(const void *p);
+
+	// Grows or shrinks memory from the arena, in place if it is the last allocation.
+	static void *reallocate(void *p, size_t size);
+};
+
+class CallArenaScope {
+public:
+	// Uses the thread's arena with the given capacity, 0 for none.
+	// Inside another scope, joins that scope's arena instead.
+	CallArenaScope(int32_t capacity);
+
+	// Uses the given arena, or joins the enclosing scope's arena.
+	CallArenaScope(CallArenaState &state);
+
+	~CallArenaScope();
+
+	CallArenaScope(const CallArenaScope &) = delete;
+	CallArenaScope &operator=(const CallArenaScope &) = delete;
+
+private:
+	void open(CallArenaState &state, size_t capacity);
+
+	CallArenaState *state;
+};
+
+class CallArenaSuspend {
+public:
+	CallArenaSuspend();
+	~CallArenaSuspend();
+
+	CallArenaSuspend(const CallArenaSuspend &) = delete;
+	CallArenaSuspend &operator=(const CallArenaSuspend &) = delete;
+
+private:
+	CallArenaState *state;
+};
+
+}
+
+#endif /* MODULES_IDN_UIDNAARENA_H_ */
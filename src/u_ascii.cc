@@ -0,0 +1,188 @@
+
+#include "u_ascii.h"
+
+#include <atomic>
+
+#if !defined(UIDNA_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64) || defined(__i386__))
+#include <immintrin.h>
+#if defined(__SSE2__) || defined(_M_X64)
+#define UIDNA_ASCII_SSE2 1
+#endif
+#if defined(__GNUC__)
+#define UIDNA_ASCII_AVX2 1
+#endif
+#endif
+
+namespace uidna {
+
+static ASCIIBlockMasks processASCIIBlockScalarUTF8(const char *src, char *dest, UBool disallowNonLDHDot) {
+	return processASCIIUnits(reinterpret_cast<const uint8_t *>(src), reinterpret_cast<uint8_t *>(dest), ASCIIBlockSize, disallowNonLDHDot);
+}
+
+static ASCIIBlockMasks processASCIIBlockScalarUTF16(const UChar *src, UChar *dest, UBool disallowNonLDHDot) {
+	return processASCIIUnits(src, dest, ASCIIBlockSize, disallowNonLDHDot);
+}
+
+static const ASCIIBlockKernel s_asciiKernelScalar = {
+	ASCIIKernelType::Scalar, processASCIIBlockScalarUTF8, processASCIIBlockScalarUTF16
+};
+
+#ifdef UIDNA_ASCII_SSE2
+
+// Classifies and lowercases 16 bytes. Non-ASCII bytes are negative for the signed comparisons,
+// so they never fall into the letter, digit, hyphen or dot ranges.
+static inline __m128i processASCIIBytesSSE2(__m128i b, uint32_t &stop, uint32_t &special, UBool disallowNonLDHDot) {
+	__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8(0x40)), _mm_cmplt_epi8(b, _mm_set1_epi8(0x5b)));
+	__m128i spec = _mm_or_si128(_mm_cmpeq_epi8(b, _mm_set1_epi8(0x2d)), _mm_cmpeq_epi8(b, _mm_set1_epi8(0x2e)));
+	special = uint32_t(_mm_movemask_epi8(spec));
+	if (disallowNonLDHDot) {
+		__m128i lower = _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8(0x60)), _mm_cmplt_epi8(b, _mm_set1_epi8(0x7b)));
+		__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(b, _mm_set1_epi8(0x2f)), _mm_cmplt_epi8(b, _mm_set1_epi8(0x3a)));
+		__m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, spec));
+		stop = ~uint32_t(_mm_movemask_epi8(valid)) & 0xffff;
+	} else {
+		stop = uint32_t(_mm_movemask_epi8(b));
+	}
+	return _mm_add_epi8(b, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+// Narrows 8 UTF-16 units to bytes for processASCIIBytesSSE2(): ASCII units keep their value,
+// all others become 0x80 (a plain unsigned saturation would turn U+8000..U+FFFF into 0).
+static inline __m128i narrowASCIISSE2(__m128i v) {
+	__m128i isASCII = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(short(0xff80))), _mm_setzero_si128());
+	return _mm_or_si128(_mm_and_si128(v, isASCII), _mm_andnot_si128(isASCII, _mm_set1_epi16(0x80)));
+}
+
+static ASCIIBlockMasks processASCIIBlockSSE2UTF8(const char *src, char *dest, UBool disallowNonLDHDot) {
+	uint32_t stop0, stop1, special0, special1;
+	__m128i r0 = processASCIIBytesSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src)), stop0, special0, disallowNonLDHDot);
+	__m128i r1 = processASCIIBytesSSE2(_mm_loadu_si128(reinterpret_cast<const __m128i *>(src + 16)), stop1, special1, disallowNonLDHDot);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest), r0);
+	_mm_storeu_si128(reinterpret_cast<__m128i *>(dest + 16), r1);
+	return ASCIIBlockMasks{ stop0 | (stop1 << 16), special0 | (special1 << 16) };
+}
+
+static ASCIIBlockMasks processASCIIBlockSSE2UTF16(const UChar *src, UChar *dest, UBool disallowNonLDHDot) {
+	const __m128i *s = reinterpret_cast<const __m128i *>(src);
+	__m128i *d = reinterpret_cast<__m128i *>(dest);
+	__m128i zero = _mm_setzero_si128();
+	uint32_t stop[2], special[2];
+	for (int32_t i = 0; i < 2; ++i) {
+		__m128i b = _mm_packus_epi16(narrowASCIISSE2(_mm_loadu_si128(s + 2 * i)), narrowASCIISSE2(_mm_loadu_si128(s + 2 * i + 1)));
+		__m128i r = processASCIIBytesSSE2(b, stop[i], special[i], disallowNonLDHDot);
+		_mm_storeu_si128(d + 2 * i, _mm_unpacklo_epi8(r, zero));
+		_mm_storeu_si128(d + 2 * i + 1, _mm_unpackhi_epi8(r, zero));
+	}
+	return ASCIIBlockMasks{ stop[0] | (stop[1] << 16), special[0] | (special[1] << 16) };
+}
+
+static const ASCIIBlockKernel s_asciiKernelSSE2 = {
+	ASCIIKernelType::SSE2, processASCIIBlockSSE2UTF8, processASCIIBlockSSE2UTF16
+};
+
+#endif
+
+#ifdef UIDNA_ASCII_AVX2
+
+// Same as processASCIIBytesSSE2(), for 32 bytes.
+__attribute__((target("avx2")))
+static inline __m256i processASCIIBytesAVX2(__m256i b, uint32_t &stop, uint32_t &special, UBool disallowNonLDHDot) {
+	__m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(b, _mm256_set1_epi8(0x40)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x5b), b));
+	__m256i spec = _mm256_or_si256(_mm256_cmpeq_epi8(b, _mm256_set1_epi8(0x2d)), _mm256_cmpeq_epi8(b, _mm256_set1_epi8(0x2e)));
+	special = uint32_t(_mm256_movemask_epi8(spec));
+	if (disallowNonLDHDot) {
+		__m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(b, _mm256_set1_epi8(0x60)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7b), b));
+		__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(b, _mm256_set1_epi8(0x2f)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x3a), b));
+		__m256i valid = _mm256_or_si256(_mm256_or_si256(upper, lower), _mm256_or_si256(digit, spec));
+		stop = ~uint32_t(_mm256_movemask_epi8(valid));
+	} else {
+		stop = uint32_t(_mm256_movemask_epi8(b));
+	}
+	return _mm256_add_epi8(b, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i narrowASCIIAVX2(__m256i v) {
+	__m256i isASCII = _mm256_cmpeq_epi16(_mm256_and_si256(v, _mm256_set1_epi16(short(0xff80))), _mm256_setzero_si256());
+	return _mm256_or_si256(_mm256_and_si256(v, isASCII), _mm256_andnot_si256(isASCII, _mm256_set1_epi16(0x80)));
+}
+
+__attribute__((target("avx2")))
+static ASCIIBlockMasks processASCIIBlockAVX2UTF8(const char *src, char *dest, UBool disallowNonLDHDot) {
+	ASCIIBlockMasks masks;
+	__m256i r = processASCIIBytesAVX2(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(src)), masks.stop, masks.special, disallowNonLDHDot);
+	_mm256_storeu_si256(reinterpret_cast<__m256i *>(dest), r);
+	return masks;
+}
+
+__attribute__((target("avx2")))
+static ASCIIBlockMasks processASCIIBlockAVX2UTF16(const UChar *src, UChar *dest, UBool disallowNonLDHDot) {
+	const __m256i *s = reinterpret_cast<const __m256i *>(src);
+	__m256i *d = reinterpret_cast<__m256i *>(dest);
+	ASCIIBlockMasks masks;
+	// packus works within 128-bit lanes, the permutation restores the unit order.
+	__m256i b = _mm256_permute4x64_epi64(_mm256_packus_epi16(narrowASCIIAVX2(_mm256_loadu_si256(s)), narrowASCIIAVX2(_mm256_loadu_si256(s + 1))), 0xd8);
+	__m256i r = processASCIIBytesAVX2(b, masks.stop, masks.special, disallowNonLDHDot);
+	_mm256_storeu_si256(d, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(r)));
+	_mm256_storeu_si256(d + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(r, 1)));
+	return masks;
+}
+
+static const ASCIIBlockKernel s_asciiKernelAVX2 = {
+	ASCIIKernelType::AVX2, processASCIIBlockAVX2UTF8, processASCIIBlockAVX2UTF16
+};
+
+#endif
+
+const ASCIIBlockKernel *getASCIIBlockKernel(ASCIIKernelType type) {
+	switch (type) {
+	case ASCIIKernelType::Scalar:
+		return &s_asciiKernelScalar;
+	case ASCIIKernelType::SSE2:
+#ifdef UIDNA_ASCII_SSE2
+		return &s_asciiKernelSSE2;
+#else
+		return NULL;
+#endif
+	case ASCIIKernelType::AVX2:
+#ifdef UIDNA_ASCII_AVX2
+		if (__builtin_cpu_supports("avx2")) {
+			return &s_asciiKernelAVX2;
+		}
+#endif
+		return NULL;
+	}
+	return NULL;
+}
+
+static const ASCIIBlockKernel *selectASCIIBlockKernel() {
+	for (ASCIIKernelType type : { ASCIIKernelType::AVX2, ASCIIKernelType::SSE2 }) {
+		if (const ASCIIBlockKernel *kernel = getASCIIBlockKernel(type)) {
+			return kernel;
+		}
+	}
+	return &s_asciiKernelScalar;
+}
+
+static std::atomic<const ASCIIBlockKernel *> s_asciiKernel { NULL };
+
+const ASCIIBlockKernel &getASCIIBlockKernel() {
+	const ASCIIBlockKernel *kernel = s_asciiKernel.load(std::memory_order_relaxed);
+	if (kernel == NULL) {
+		// Racing threads select the same kernel.
+		kernel = selectASCIIBlockKernel();
+		s_asciiKernel.store(kernel, std::memory_order_relaxed);
+	}
+	return *kernel;
+}
+
+bool setASCIIBlockKernel(ASCIIKernelType type) {
+	const ASCIIBlockKernel *kernel = getASCIIBlockKernel(type);
+	if (kernel == NULL) {
+		return false;
+	}
+	s_asciiKernel.store(kernel, std::memory_order_relaxed);
+	return true;
+}
+
+}
@@ -0,0 +1,89 @@
+
+#ifndef MODULES_IDN_UIDNAASCII_H_
+#define MODULES_IDN_UIDNAASCII_H_
+
+#include "u_types.h"
+
+namespace uidna {
+
+// Block kernels for the ASCII fastpath of UTS46::process() and UTS46::processUTF8().
+//
+// A kernel reads ASCIIBlockSize code units from src, writes them to dest with A..Z lowercased,
+// and classifies them with one bit per unit (bit i for src[i]):
+//   stop    - units the fastpath can not handle: non-ASCII, and with STD3 rules
+//             also ASCII other than [-.0-9A-Za-z];
+//   special - hyphens and dots, which need the label checks of the fastpath.
+// dest units at and after the first stop unit are unspecified.
+static constexpr int32_t ASCIIBlockSize = 32;
+
+struct ASCIIBlockMasks {
+	uint32_t stop;
+	uint32_t special;
+};
+
+enum class ASCIIKernelType {
+	Scalar,
+	SSE2,
+	AVX2,
+};
+
+struct ASCIIBlockKernel {
+	ASCIIKernelType type;
+	ASCIIBlockMasks (*processUTF8)(const char *src, char *dest, UBool disallowNonLDHDot);
+	ASCIIBlockMasks (*processUTF16)(const UChar *src, UChar *dest, UBool disallowNonLDHDot);
+};
+
+// Returns the kernel for the best instruction set supported by the CPU, detected on first use.
+const ASCIIBlockKernel &getASCIIBlockKernel();
+
+// Returns the kernel of the given type, or NULL if it was not compiled in or the CPU does not support it.
+const ASCIIBlockKernel *getASCIIBlockKernel(ASCIIKernelType type);
+
+// Makes getASCIIBlockKernel() return the kernel of the given type, for tests and benchmarks.
+// Returns false if that kernel is not available.
+bool setASCIIBlockKernel(ASCIIKernelType type);
+
+inline ASCIIBlockMasks processASCIIBlock(const ASCIIBlockKernel &kernel, const char *src, char *dest, UBool disallowNonLDHDot) {
+	return kernel.processUTF8(src, dest, disallowNonLDHDot);
+}
+
+inline ASCIIBlockMasks processASCIIBlock(const ASCIIBlockKernel &kernel, const UChar *src, UChar *dest, UBool disallowNonLDHDot) {
+	return kernel.processUTF16(src, dest, disallowNonLDHDot);
+}
+
+// Scalar version of the kernels, for up to ASCIIBlockSize units.
+template <typename Char>
+inline ASCIIBlockMasks processASCIIUnits(const Char *src, Char *dest, int32_t length, UBool disallowNonLDHDot) {
+	ASCIIBlockMasks masks = { 0, 0 };
+	for (int32_t i = 0; i < length; ++i) {
+		uint32_t c = src[i];
+		if ((c - 0x41) <= 25) {
+			dest[i] = Char(c + 0x20);  // Lowercase an uppercase ASCII letter.
+			continue;
+		}
+		dest[i] = Char(c);
+		if (c == 0x2d || c == 0x2e) {
+			masks.special |= uint32_t(1) << i;
+		} else if (c > 0x7f || (disallowNonLDHDot && (c - 0x30) > 9 && ((c | 0x20) - 0x61) > 25)) {
+			masks.stop |= uint32_t(1) << i;
+		}
+	}
+	return masks;
+}
+
+inline int32_t countTrailingZeros(uint32_t mask) {
+#if defined(__GNUC__)
+	return __builtin_ctz(mask);
+#else
+	int32_t n = 0;
+	while ((mask & 1) == 0) {
+		mask >>= 1;
+		++n;
+	}
+	return n;
+#endif
+}
+
+}
+
+#endif /* MODULES_IDN_UIDNAASCII_H_ */
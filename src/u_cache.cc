@@ -0,0 +1,241 @@
+
+#include "u_cache.h"
+#include "u_arena.h"
+
+#include <new>
+#include <thread>
+
+namespace uidna {
+
+// Immutable after publication, except for next (unlinking) and referenced (CLOCK).
+// The key and value bytes follow the struct.
+struct IDNACacheEntry {
+	std::atomic<IDNACacheEntry *> next { nullptr };
+	uint64_t hash = 0;
+	uint32_t operation = 0;
+	uint32_t errors = 0;
+	uint32_t flags = 0;
+	int32_t keyLength = 0;
+	int32_t valueLength = 0;
+	std::atomic<uint8_t> referenced { 0 };
+
+	const char *key() const { return reinterpret_cast<const char *>(this + 1); }
+	const char *value() const { return key() + keyLength; }
+	size_t size() const { return sizeof(IDNACacheEntry) + keyLength + valueLength; }
+
+	UBool matches(uint64_t h, uint32_t op, StringPiece k) const {
+		return hash == h && operation == op && keyLength == k.length() && 0 == memcmp(key(), k.data(), keyLength);
+	}
+};
+
+// Typical entry size for a host name, used to size the hash tables.
+static constexpr size_t IDNACacheTypicalEntrySize = sizeof(IDNACacheEntry) + 64;
+
+static void freeCacheEntry(IDNACacheEntry *entry) {
+	entry->~IDNACacheEntry();
+	uprv_free(entry);
+}
+
+IDNACache::IDNACache(size_t memoryBudget) {
+	size_t bucketCount = 16;
+	while (bucketCount * IDNACacheTypicalEntrySize < memoryBudget / ShardCount) {
+		bucketCount *= 2;
+	}
+	bucketMask = bucketCount - 1;
+	// The hash tables are part of the budget.
+	size_t tablesSize = ShardCount * bucketCount * sizeof(std::atomic<IDNACacheEntry *>);
+	shardBudget = memoryBudget > tablesSize ? (memoryBudget - tablesSize) / ShardCount : 0;
+
+	shards = static_cast<Shard *>(heapMallocAligned(ShardCount * sizeof(Shard), alignof(Shard)));
+	if (shards == nullptr) {
+		return;
+	}
+	for (int32_t i = 0; i < ShardCount; ++i) {
+		new (&shards[i]) Shard;
+	}
+	for (int32_t i = 0; i < ShardCount; ++i) {
+		void *memory = heapMalloc(bucketCount * sizeof(std::atomic<IDNACacheEntry *>));
+		if (memory == nullptr) {
+			destroyShards();
+			return;
+		}
+		shards[i].buckets = static_cast<std::atomic<IDNACacheEntry *> *>(memory);
+		for (size_t j = 0; j < bucketCount; ++j) {
+			new (&shards[i].buckets[j]) std::atomic<IDNACacheEntry *>(nullptr);
+		}
+	}
+}
+
+IDNACache::~IDNACache() {
+	destroyShards();
+}
+
+void IDNACache::destroyShards() {
+	if (shards == nullptr) {
+		return;
+	}
+	for (int32_t i = 0; i < ShardCount; ++i) {
+		for (IDNACacheEntry *entry : shards[i].clock) {
+			freeCacheEntry(entry);
+		}
+		for (IDNACacheEntry *entry : shards[i].retired) {
+			freeCacheEntry(entry);
+		}
+		if (shards[i].buckets != nullptr) {
+			heapFree(shards[i].buckets);
+		}
+		shards[i].~Shard();
+	}
+	heapFreeAligned(shards);
+	shards = nullptr;
+}
+
+uint64_t IDNACache::hash(uint32_t operation, StringPiece key) {
+	// FNV-1a, with a final mix so that the high bits (shard) and low bits (bucket) are both usable.
+	uint64_t h = 0xcbf29ce484222325ULL ^ operation;
+	const uint8_t *s = reinterpret_cast<const uint8_t *>(key.data());
+	for (int32_t i = 0; i < key.length(); ++i) {
+		h = (h ^ s[i]) * 0x100000001b3ULL;
+	}
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return h;
+}
+
+UBool IDNACache::find(uint32_t operation, StringPiece key, ByteSink &dest, uint32_t &errors, uint32_t &flags) {
+	uint64_t h = hash(operation, key);
+	Shard &shard = getShard(h);
+
+	// Read-side critical section: entries seen here are not freed until it is left.
+	uint32_t epoch = shard.epoch.load(std::memory_order_seq_cst) & 1;
+	shard.readers[epoch].fetch_add(1, std::memory_order_seq_cst);
+	UBool found = false;
+	for (IDNACacheEntry *entry = getBucket(shard, h).load(std::memory_order_acquire); entry != nullptr;
+			entry = entry->next.load(std::memory_order_acquire)) {
+		if (entry->matches(h, operation, key)) {
+			if (entry->referenced.load(std::memory_order_relaxed) == 0) {
+				entry->referenced.store(1, std::memory_order_relaxed);
+			}
+			errors = entry->errors;
+			flags = entry->flags;
+			dest.Append(entry->value(), entry->valueLength);
+			found = true;
+			break;
+		}
+	}
+	shard.readers[epoch].fetch_sub(1, std::memory_order_release);
+
+	(found ? shard.hits : shard.misses).fetch_add(1, std::memory_order_relaxed);
+	return found;
+}
+
+void IDNACache::insert(uint32_t operation, StringPiece key, StringPiece value, uint32_t errors, uint32_t flags) {
+	size_t size = sizeof(IDNACacheEntry) + key.length() + value.length();
+	if (size > shardBudget / 4) {
+		return;  // would push out too much of the shard
+	}
+	uint64_t h = hash(operation, key);
+	Shard &shard = getShard(h);
+	std::lock_guard<std::mutex> lock(shard.mutex);
+
+	std::atomic<IDNACacheEntry *> &bucket = getBucket(shard, h);
+	for (IDNACacheEntry *entry = bucket.load(std::memory_order_relaxed); entry != nullptr; entry = entry->next.load(std::memory_order_relaxed)) {
+		if (entry->matches(h, operation, key)) {
+			return;  // added by another thread after our miss
+		}
+	}
+
+	while (shard.memoryUsed + size > shardBudget) {
+		if (!shard.clock.empty()) {
+			evict(shard);
+		} else if (!shard.retired.empty()) {
+			synchronize(shard);
+		} else {
+			return;
+		}
+	}
+
+	CallArenaSuspend suspend;  // entries outlive the call
+	void *memory = uprv_malloc(size);
+	if (memory == nullptr) {
+		return;
+	}
+	IDNACacheEntry *entry = new (memory) IDNACacheEntry;
+	entry->hash = h;
+	entry->operation = operation;
+	entry->errors = errors;
+	entry->flags = flags;
+	entry->keyLength = key.length();
+	entry->valueLength = value.length();
+	memcpy(const_cast<char *>(entry->key()), key.data(), key.length());
+	memcpy(const_cast<char *>(entry->value()), value.data(), value.length());
+
+	entry->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+	bucket.store(entry, std::memory_order_release);
+	shard.clock.push_back(entry);
+	shard.memoryUsed += size;
+}
+
+// CLOCK: skips and clears recently referenced entries, evicts the first one that was not.
+void IDNACache::evict(Shard &shard) {
+	for (;;) {
+		if (shard.hand >= shard.clock.size()) {
+			shard.hand = 0;
+		}
+		IDNACacheEntry *entry = shard.clock[shard.hand];
+		if (entry->referenced.load(std::memory_order_relaxed) != 0) {
+			entry->referenced.store(0, std::memory_order_relaxed);
+			++shard.hand;
+			continue;
+		}
+
+		std::atomic<IDNACacheEntry *> *link = &getBucket(shard, entry->hash);
+		while (link->load(std::memory_order_relaxed) != entry) {
+			link = &link->load(std::memory_order_relaxed)->next;
+		}
+		// Readers that are past the entry keep following its next pointer, which stays valid.
+		link->store(entry->next.load(std::memory_order_relaxed), std::memory_order_seq_cst);
+
+		shard.clock[shard.hand] = shard.clock.back();
+		shard.clock.pop_back();
+		shard.retired.push_back(entry);
+		shard.evictions.fetch_add(1, std::memory_order_relaxed);
+		if (shard.retired.size() >= RetiredLimit) {
+			synchronize(shard);
+		}
+		return;
+	}
+}
+
+// Waits until no reader can still see the retired entries, then frees them.
+// Readers count themselves in the counter of the current epoch; after two epoch flips
+// with the old counter drained each time, every reader that started before has finished.
+void IDNACache::synchronize(Shard &shard) {
+	for (int32_t i = 0; i < 2; ++i) {
+		uint32_t epoch = shard.epoch.fetch_add(1, std::memory_order_seq_cst) & 1;
+		while (shard.readers[epoch].load(std::memory_order_seq_cst) != 0) {
+			std::this_thread::yield();
+		}
+	}
+	for (IDNACacheEntry *entry : shard.retired) {
+		shard.memoryUsed -= entry->size();
+		freeCacheEntry(entry);
+	}
+	shard.retired.clear();
+}
+
+void IDNACache::getStats(uint64_t &hits, uint64_t &misses, uint64_t &evictions, uint64_t &entries, uint64_t &memoryUsed) const {
+	hits = misses = evictions = entries = memoryUsed = 0;
+	for (int32_t i = 0; i < ShardCount; ++i) {
+		Shard &shard = shards[i];
+		hits += shard.hits.load(std::memory_order_relaxed);
+		misses += shard.misses.load(std::memory_order_relaxed);
+		evictions += shard.evictions.load(std::memory_order_relaxed);
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		entries += shard.clock.size();
+		memoryUsed += shard.memoryUsed + (bucketMask + 1) * sizeof(std::atomic<IDNACacheEntry *>);
+	}
+}
+
+}
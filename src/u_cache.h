@@ -0,0 +1,75 @@
+
+#ifndef MODULES_IDN_UIDNACACHE_H_
+#define MODULES_IDN_UIDNACACHE_H_
+
+#include "u_unistr.h"
+#include "u_arena.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace uidna {
+
+struct IDNACacheEntry;
+
+// Concurrent cache of conversion results, keyed by (operation, input bytes).
+// Besides the output bytes, an entry holds error bits and operation-specific flags.
+//
+// The table is split into shards by key hash, each with its own share of the memory budget.
+// Readers do not lock: they walk immutable entries in the hash chains and only announce themselves
+// in one of two per-shard reader counters (a minimal RCU). Writers lock their shard, evict with CLOCK
+// and free evicted entries only after all readers that could still see them have left.
+class IDNACache : public HeapObject {
+public:
+	IDNACache(size_t memoryBudget);
+	~IDNACache();
+
+	// false if the tables could not be allocated
+	UBool isValid() const { return shards != nullptr; }
+
+	// Appends the cached result to dest and returns true, or returns false if the key is not cached.
+	UBool find(uint32_t operation, StringPiece key, ByteSink &dest, uint32_t &errors, uint32_t &flags);
+
+	void insert(uint32_t operation, StringPiece key, StringPiece value, uint32_t errors, uint32_t flags);
+
+	void getStats(uint64_t &hits, uint64_t &misses, uint64_t &evictions, uint64_t &entries, uint64_t &memoryUsed) const;
+
+private:
+	struct alignas(64) Shard {
+		std::atomic<uint32_t> epoch { 0 };
+		std::atomic<int32_t> readers[2] { { 0 }, { 0 } };
+		std::atomic<uint64_t> hits { 0 };
+		std::atomic<uint64_t> misses { 0 };
+
+		std::atomic<IDNACacheEntry *> *buckets = nullptr;
+
+		std::mutex mutex;  // for all below
+		std::vector<IDNACacheEntry *, HeapAllocator<IDNACacheEntry *>> clock;  // all entries in CLOCK order
+		size_t hand = 0;
+		size_t memoryUsed = 0;
+		std::vector<IDNACacheEntry *, HeapAllocator<IDNACacheEntry *>> retired;  // unlinked, freed after the next grace period
+		std::atomic<uint64_t> evictions { 0 };
+	};
+
+	static uint64_t hash(uint32_t operation, StringPiece key);
+
+	Shard &getShard(uint64_t h) const { return shards[h >> (64 - ShardBits)]; }
+	std::atomic<IDNACacheEntry *> &getBucket(Shard &shard, uint64_t h) const { return shard.buckets[h & bucketMask]; }
+
+	void destroyShards();
+	void evict(Shard &shard);
+	void synchronize(Shard &shard);
+
+	static constexpr int32_t ShardBits = 4;
+	static constexpr int32_t ShardCount = 1 << ShardBits;
+	static constexpr size_t RetiredLimit = 64;
+
+	Shard *shards;
+	uint64_t bucketMask;
+	size_t shardBudget;
+};
+
+}
+
+#endif /* MODULES_IDN_UIDNACACHE_H_ */
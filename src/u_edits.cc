@@ -210,6 +210,32 @@ UBool ReorderingBuffer::equals(const UChar *otherStart, const UChar *otherLimit)
 	return length == (int32_t) (otherLimit - otherStart) && 0 == u_memcmp(start, otherStart, length);
 }
 
+UBool ReorderingBuffer::equals(const uint8_t *otherStart, const uint8_t *otherLimit) const {
+	// U_ASSERT((otherLimit - otherStart) <= INT32_MAX);  // ensured by caller
+	int32_t length = (int32_t) (limit - start);
+	int32_t otherLength = (int32_t) (otherLimit - otherStart);
+	// For equal strings, UTF-8 is at least as long as UTF-16, and at most three times as long.
+	if (otherLength < length || (otherLength / 3) > length) {
+		return false;
+	}
+	// Compare valid strings from between normalization boundaries.
+	// (Invalid sequences are normalization-inert.)
+	for (int32_t i = 0, j = 0;;) {
+		if (i >= length) {
+			return j >= otherLength;
+		} else if (j >= otherLength) {
+			return false;
+		}
+		// Not at the end of either string yet.
+		UChar32 c, other;
+		U16_NEXT_UNSAFE(start, i, c);
+		U8_NEXT_UNSAFE(otherStart, j, other);
+		if (c != other) {
+			return false;
+		}
+	}
+}
+
 void ReorderingBuffer::insert(UChar32 c, uint8_t cc) {
 	for (setIterator(), skipPrevious(); previousCC() > cc;) { }
 	// insert c at codePointLimit, after the character with prevCC<=cc
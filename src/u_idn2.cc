@@ -1,10 +1,13 @@
 
 #ifdef UIDNA_SOURCES 
 #include "u_types.h"
+#include "u_arena.h"
 #else
 #include <string>
 #endif
 
+#include <atomic>
+
 #include <unicode/uidna.h>
 
 #include "idn2.h"
@@ -123,29 +126,30 @@ static int32_t u_nameToUnicodeUTF8(uint32_t options, const char *name, int32_t l
 	return ret;
 }
 
+static UIDNA *uidna_open(uint32_t options, UErrorCode *pErrorCode) {
+	return uidna_openUTS46(options, pErrorCode);
+}
+
 #endif
 
 namespace uidna {
 
 static constexpr size_t DefaultBufferSize = 2048;
 
+// All option bits that flagsToOptions() sets fit below this value, see the UIDNA_... options in uidna.h
+static constexpr uint32_t OptionsCacheSize = 0x80;
+
 U_CAPI const char *u_errorName(UErrorCode code);
 
 static int errorToIdn2(UErrorCode err) {
-	if (err >= 0) {
+	if (U_SUCCESS(err)) {
 		return IDN2_OK;
 	} else {
 		return -err;
 	}
 }
 
-extern "C" int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupname, int flags) {
-	if (!src) {
-		if (lookupname) {
-			*lookupname = nullptr;
-		}
-		return IDN2_OK;
-	}
+static uint32_t flagsToOptions(int flags, uint32_t nontransitionalOption) {
 	uint32_t options = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO; // IDN2008
 
 	if (flags & IDN2_NO_TR46) {
@@ -157,139 +161,161 @@ extern "C" int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupname, int flag
 	}
 
 	if (flags & IDN2_NONTRANSITIONAL) {
-		options |= UIDNA_NONTRANSITIONAL_TO_ASCII;
+		options |= nontransitionalOption;
 	}
+	return options;
+}
 
-	char *buf = new char[DefaultBufferSize];
+// UIDNA instances are immutable and thread-safe, so one instance per option set
+// is opened on first use and shared by all idn2 calls for the lifetime of the process.
+static const UIDNA *getCachedIdna(uint32_t options, UErrorCode *pErrorCode) {
+	static std::atomic<UIDNA *> s_cache[OptionsCacheSize];
 
-	UIDNAInfo info;
-	UErrorCode error = U_ZERO_ERROR;
+	if (options >= OptionsCacheSize) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return nullptr;
+	}
 
-	u_nameToASCII_UTF8(options, (const char *)src, std::char_traits<char>::length((const char *)src), buf, 512, &info, &error);
+	UIDNA *idna = s_cache[options].load(std::memory_order_acquire);
+	if (idna) {
+		return idna;
+	}
 
-	if (error == U_ZERO_ERROR && info.errors == 0) {
-		if (lookupname) {
-			*lookupname = (uint8_t *)buf;
-		} else {
-			delete [] buf;
-		}
-		return IDN2_OK;
-	} else {
-		if (error != U_ZERO_ERROR) {
-			delete [] buf;
-			return errorToIdn2(error);
-		} else {
-			if (info.errors == UIDNA_ERROR_EMPTY_LABEL) {
-				if (lookupname) {
-					*lookupname = (uint8_t *)buf;
-				} else {
-					delete [] buf;
-				}
-				return IDN2_OK;
-			}
-			return -info.errors;
-		}
+	idna = uidna_open(options, pErrorCode);
+	if (U_FAILURE(*pErrorCode)) {
+		return nullptr;
 	}
+
+	UIDNA *expected = nullptr;
+	if (!s_cache[options].compare_exchange_strong(expected, idna, std::memory_order_acq_rel)) {
+		// another thread was faster
+		uidna_close(idna);
+		idna = expected;
+	}
+	return idna;
 }
 
-extern "C" int idn2_lookup_ul(const char *src, char **lookupname, int flags) {
+static int processToBuffer(bool toASCII, uint32_t options, const char *src, size_t srclen,
+		char *dest, size_t destlen, size_t *outlen) {
 	if (!src) {
-		if (lookupname) {
-			*lookupname = nullptr;
+		if (dest && destlen > 0) {
+			dest[0] = 0;
+		}
+		if (outlen) {
+			*outlen = 0;
 		}
 		return IDN2_OK;
 	}
-	uint32_t options = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO; // IDN2008
-
-	if (flags & IDN2_NO_TR46) {
-		options = 0;
-	}
 
-	if (flags & IDN2_USE_STD3_ASCII_RULES) {
-		options |= UIDNA_USE_STD3_RULES;
+	if (srclen > INT32_MAX || (!dest && destlen != 0)) {
+		return errorToIdn2(U_ILLEGAL_ARGUMENT_ERROR);
 	}
 
-	if (flags & IDN2_NONTRANSITIONAL) {
-		options |= UIDNA_NONTRANSITIONAL_TO_ASCII;
+	UErrorCode error = U_ZERO_ERROR;
+	const UIDNA *idna = getCachedIdna(options, &error);
+	if (!idna) {
+		return errorToIdn2(error);
 	}
 
-	char *buf = new char[DefaultBufferSize];
-
 	UIDNAInfo info;
-	UErrorCode error = U_ZERO_ERROR;
-
-	u_nameToASCII_UTF8(options, (const char *)src, std::char_traits<char>::length((const char *)src), buf, 512, &info, &error);
-
-	if (error == U_ZERO_ERROR && info.errors == 0) {
-		if (lookupname) {
-			*lookupname = buf;
-		} else {
-			delete [] buf;
-		}
-		return IDN2_OK;
+	int32_t capacity = destlen > INT32_MAX ? INT32_MAX : int32_t(destlen);
+	int32_t len = 0;
+	if (toASCII) {
+		len = uidna_nameToASCII_UTF8(idna, src, int32_t(srclen), dest, capacity, &info, &error);
 	} else {
-		if (error != U_ZERO_ERROR) {
-			delete [] buf;
-			return errorToIdn2(error);
-		} else {
-			if (info.errors == UIDNA_ERROR_EMPTY_LABEL) {
-				if (lookupname) {
-					*lookupname = buf;
-				} else {
-					delete [] buf;
-				}
-				return IDN2_OK;
-			}
-			return -info.errors;
-		}
+		len = uidna_nameToUnicodeUTF8(idna, src, int32_t(srclen), dest, capacity, &info, &error);
 	}
-}
 
-extern "C" int idn2_to_unicode_8z8z(const char *src, char **lookupname, int flags) {
-	uint32_t options = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO; // IDN2008
+	if (error == U_STRING_NOT_TERMINATED_WARNING) {
+		// no space left for the NUL
+		error = U_BUFFER_OVERFLOW_ERROR;
+	}
 
-	if (flags & IDN2_NO_TR46) {
-		options = 0;
+	if (U_FAILURE(error)) {
+		return errorToIdn2(error);
 	}
 
-	if (flags & IDN2_USE_STD3_ASCII_RULES) {
-		options |= UIDNA_USE_STD3_RULES;
+	if (info.errors != 0 && info.errors != UIDNA_ERROR_EMPTY_LABEL) {
+		return -info.errors;
 	}
 
-	if (flags & IDN2_NONTRANSITIONAL) {
-		options |= UIDNA_NONTRANSITIONAL_TO_UNICODE;
+	if (outlen) {
+		*outlen = size_t(len);
 	}
+	return IDN2_OK;
+}
 
-	char *buf = new char[DefaultBufferSize];
+extern "C" int idn2_lookup_u8_buf(const uint8_t *src, size_t srclen, uint8_t *dest, size_t destlen, size_t *outlen, int flags) {
+	return processToBuffer(true, flagsToOptions(flags, UIDNA_NONTRANSITIONAL_TO_ASCII),
+			(const char *)src, srclen, (char *)dest, destlen, outlen);
+}
 
-	UIDNAInfo info;
-	UErrorCode error = U_ZERO_ERROR;
+extern "C" int idn2_lookup_ul_buf(const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen, int flags) {
+	return processToBuffer(true, flagsToOptions(flags, UIDNA_NONTRANSITIONAL_TO_ASCII),
+			src, srclen, dest, destlen, outlen);
+}
 
-	auto retLen = u_nameToUnicodeUTF8(0, (const char *)src, std::char_traits<char>::length((const char *)src), buf, 2048, &info, &error);
+extern "C" int idn2_to_unicode_8z8z_buf(const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen, int flags) {
+	// Validation options were never applied on the way back to Unicode
+	(void)flags;
+	return processToBuffer(false, 0, src, srclen, dest, destlen, outlen);
+}
 
-	if (error == U_ZERO_ERROR && info.errors == 0) {
+// Results for idn2_free(), from the heap functions of uidna_setAllocator() where the library has them.
+static void *allocateBuffer(size_t size) {
+#ifdef UIDNA_SOURCES
+	return uidna::heapMalloc(size);
+#else
+	return ::malloc(size);
+#endif
+}
+
+static void freeBuffer(void *buffer) {
+#ifdef UIDNA_SOURCES
+	uidna::heapFree(buffer);
+#else
+	::free(buffer);
+#endif
+}
+
+template <typename CharType, typename Fn>
+static int allocateResult(const CharType *src, CharType **lookupname, const Fn &fn) {
+	if (!src) {
 		if (lookupname) {
-			*lookupname = buf;
-		} else {
-			delete [] buf;
+			*lookupname = nullptr;
 		}
 		return IDN2_OK;
+	}
+
+	CharType *buf = static_cast<CharType *>(allocateBuffer(DefaultBufferSize * sizeof(CharType)));
+	if (!buf) {
+		return IDN2_MALLOC;
+	}
+	int rc = fn(src, std::char_traits<char>::length((const char *)src), buf, DefaultBufferSize, nullptr);
+	if (rc == IDN2_OK && lookupname) {
+		*lookupname = buf;
 	} else {
-		if (error != U_ZERO_ERROR) {
-			delete [] buf;
-			return errorToIdn2(error);
-		} else {
-			if (info.errors == UIDNA_ERROR_EMPTY_LABEL) {
-				if (lookupname) {
-					*lookupname = buf;
-				} else {
-					delete [] buf;
-				}
-				return IDN2_OK;
-			}
-			return -info.errors;
-		}
+		freeBuffer(buf);
 	}
+	return rc;
+}
+
+extern "C" int idn2_lookup_u8(const uint8_t *src, uint8_t **lookupname, int flags) {
+	return allocateResult(src, lookupname, [flags] (const uint8_t *src, size_t srclen, uint8_t *dest, size_t destlen, size_t *outlen) {
+		return idn2_lookup_u8_buf(src, srclen, dest, destlen, outlen, flags);
+	});
+}
+
+extern "C" int idn2_lookup_ul(const char *src, char **lookupname, int flags) {
+	return allocateResult(src, lookupname, [flags] (const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen) {
+		return idn2_lookup_ul_buf(src, srclen, dest, destlen, outlen, flags);
+	});
+}
+
+extern "C" int idn2_to_unicode_8z8z(const char *src, char **lookupname, int flags) {
+	return allocateResult(src, lookupname, [flags] (const char *src, size_t srclen, char *dest, size_t destlen, size_t *outlen) {
+		return idn2_to_unicode_8z8z_buf(src, srclen, dest, destlen, outlen, flags);
+	});
 }
 
 extern "C" const char* idn2_strerror(int rc) {
@@ -318,7 +344,7 @@ extern "C" const char* idn2_strerror_name(int rc) {
 
 extern "C" void idn2_free(void *ptr) {
 	if (ptr) {
-		delete [] (char *)ptr;
+		freeBuffer(ptr);
 	}
 }
 
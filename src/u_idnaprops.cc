@@ -0,0 +1,1761 @@
+// Copyright (C) 2016 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+//
+// file name: u_idnaprops.cc
+//
+// machine-generated by: tools/genidnaprops.cpp
+
+#include "u_idnaprops.h"
+
+namespace uidna {
+
+const uint16_t idnaPropsBMPIndex[0x10000 >> IDNAPropsShift2] = {
+	0x0, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0, 0x100, 0x120, 0x140, 0x160, 0x180, 0x1a0, 0x1c0, 0x1e0,
+	0x100, 0x200, 0x220, 0x240, 0x240, 0x260, 0x280, 0x2a0, 0x2c0, 0x2c0, 0x2e0, 0x300, 0x320, 0x340, 0x360, 0x380,
+	0x3a0, 0x3c0, 0x240, 0x100, 0x3e0, 0x100, 0x400, 0x100, 0x100, 0x420, 0x440, 0x240, 0x460, 0x480, 0x4a0, 0x4c0,
+	0x4e0, 0x500, 0x520, 0x540, 0x560, 0x580, 0x5a0, 0x5c0, 0x5e0, 0x600, 0x620, 0x640, 0x660, 0x680, 0x6a0, 0x6c0,
+	0x6e0, 0x700, 0x720, 0x740, 0x760, 0x780, 0x7a0, 0x7c0, 0x7e0, 0x800, 0x820, 0x840, 0x860, 0x880, 0x8a0, 0x8c0,
+	0x8e0, 0x900, 0x920, 0x940, 0x960, 0x980, 0x9a0, 0x9c0, 0x9e0, 0xa00, 0xa20, 0xa40, 0xa60, 0xa80, 0xaa0, 0xac0,
+	0xae0, 0xb00, 0xb20, 0xb40, 0xb60, 0xb80, 0xba0, 0xbc0, 0xbe0, 0xc00, 0xc20, 0xc40, 0xc60, 0xc80, 0xca0, 0xcc0,
+	0xce0, 0xd00, 0xd20, 0xd40, 0xd60, 0xd80, 0xda0, 0xd40, 0xdc0, 0xde0, 0xe00, 0xe20, 0xe40, 0xe60, 0xe80, 0xd40,
+	0x240, 0xea0, 0xec0, 0xee0, 0xf00, 0xd40, 0xf20, 0xf40, 0x240, 0x240, 0xf60, 0xce0, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0xf80, 0x240, 0xfa0, 0xfc0, 0xfe0, 0x240, 0x1000, 0x240, 0x1020, 0x1040, 0x1060, 0x240, 0x240, 0x1080,
+	0x10a0, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x10c0, 0x240, 0x240, 0x10e0, 0x1100, 0x1120, 0x1140, 0x1160, 0x240, 0x1180, 0x11a0, 0x11c0,
+	0x11e0, 0x1200, 0x1200, 0x1220, 0x1240, 0x1260, 0x240, 0x1280, 0xf60, 0x12a0, 0x12c0, 0x12e0, 0x240, 0x1300, 0x1320, 0x1340,
+	0x1360, 0x240, 0x1380, 0x13a0, 0x13c0, 0x13e0, 0x1400, 0xd40, 0x1420, 0x1440, 0x1460, 0x1480, 0x14a0, 0x14c0, 0x240, 0x14e0,
+	0x240, 0x1500, 0x1520, 0x240, 0x1540, 0x1560, 0x1580, 0x15a0, 0x240, 0x15c0, 0x15e0, 0x1600, 0x1620, 0x1640, 0x2c0, 0x2c0,
+	0x100, 0x100, 0x100, 0x100, 0x1660, 0x100, 0x100, 0x100, 0x1680, 0x16a0, 0x16c0, 0x16e0, 0x1700, 0x1720, 0x1740, 0x1760,
+	0x1780, 0x17a0, 0x17c0, 0x17e0, 0x1800, 0x1820, 0x1840, 0x1860, 0x1880, 0x18a0, 0x18c0, 0x3a0, 0x18e0, 0x1340, 0x1340, 0x1340,
+	0x1900, 0x1920, 0x1340, 0x1940, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1960, 0x240, 0x1980, 0x19a0, 0x1340, 0x1340, 0x1340,
+	0x1340, 0x19c0, 0x19e0, 0x1a00, 0x1a20, 0x3a0, 0x3a0, 0x1a40, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1a60, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x1a80, 0x1340, 0x1340, 0x1aa0, 0x1340, 0x1340, 0x1ac0, 0x1340, 0x1340, 0x1340, 0x1340, 0x1ae0, 0x1b00, 0x1340, 0x1340, 0x1340,
+	0x3a0, 0x3c0, 0x240, 0x1b20, 0x100, 0x100, 0x100, 0x1b40, 0x240, 0x1b60, 0x240, 0x1b80, 0x1ba0, 0x1bc0, 0x1bc0, 0x2c0,
+	0x1340, 0x1340, 0x1be0, 0xd40, 0x1c00, 0x1c20, 0x1c20, 0x1c40, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c60, 0x1c80, 0x1ca0,
+	0x1cc0, 0x1ce0, 0x1d00, 0x1d20, 0x1d40, 0x1d60, 0x1d20, 0x1d80, 0x1da0, 0x1dc0, 0x3a0, 0x1de0, 0x1e00, 0x240, 0x1340, 0x1e20,
+	0x1e40, 0x3a0, 0x1e60, 0x1e80, 0x3a0, 0x1ea0, 0x1ec0, 0x1ee0, 0x1f00, 0x1f00, 0x1f20, 0x1f40, 0x3a0, 0x3a0, 0x1f60, 0x1f80,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1340, 0x1340,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x1fa0, 0x1340, 0x1fc0, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x1fe0, 0x2000, 0x100, 0x2020, 0x2040, 0x240, 0x240, 0x2060, 0x1340, 0x2080, 0x100, 0x20a0, 0x20c0, 0x20e0, 0x2100, 0x2120,
+	0x2140, 0x2160, 0x1200, 0x2180, 0x21a0, 0x21c0, 0x21e0, 0x2200, 0x240, 0x2220, 0x2240, 0x1040, 0x7e0, 0x2260, 0x2280, 0x22a0,
+	0x240, 0x22c0, 0x22e0, 0x2300, 0x240, 0x2320, 0x2340, 0x2360, 0x2380, 0x23a0, 0x23c0, 0x23e0, 0x3a0, 0x3a0, 0x240, 0x2400,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x2420, 0x2440, 0x2460,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x1f00,
+	0x2480, 0x24a0, 0x1f00, 0x24c0, 0x1f00, 0x1f00, 0x24e0, 0xd40, 0x2500, 0x2520, 0x2540, 0x2560, 0x2560, 0x2580, 0x25a0, 0x2560,
+	0x2560, 0x2560, 0x2560, 0x2560, 0x2560, 0x2560, 0x2560, 0x2560, 0x2560, 0x25c0, 0x25e0, 0x2560, 0x2600, 0x2560, 0x2620, 0x2640,
+	0x2660, 0x2680, 0x26a0, 0x26c0, 0x2560, 0x2560, 0x2560, 0x26e0, 0x2700, 0x2720, 0x2720, 0x2740, 0x2760, 0x2780, 0x27a0, 0x27c0,
+};
+
+const uint16_t idnaPropsSuppIndex1[0x100000 >> IDNAPropsShift1] = {
+	0x0, 0x80, 0x100, 0x180, 0x200, 0x280, 0x300, 0x380, 0x400, 0x280, 0x480, 0x500, 0x580, 0x600, 0x680, 0x700,
+	0x780, 0x780, 0x780, 0x780, 0x780, 0x780, 0x780, 0x780, 0x780, 0x780, 0x800, 0x880, 0x900, 0x780, 0x980, 0xa00,
+	0x780, 0xa80, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0xb80, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+	0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0x280, 0xb00,
+};
+
+const uint16_t idnaPropsSuppIndex2[] = {
+	0x27e0, 0x2800, 0x2820, 0xd40, 0x240, 0x240, 0x240, 0x2840, 0x2860, 0x2880, 0x28a0, 0x28a0, 0x28c0, 0x28e0, 0x2900, 0x2920,
+	0xd40, 0xd40, 0xd40, 0xd40, 0x1040, 0x240, 0x2940, 0x2960, 0x240, 0x2980, 0x29a0, 0x29c0, 0x29e0, 0x240, 0x2a00, 0xd40,
+	0x3a0, 0x2a20, 0x240, 0x240, 0x2a40, 0x2a60, 0x2a80, 0x2460, 0x240, 0x2aa0, 0x240, 0x2ac0, 0x2ae0, 0x2b00, 0xd40, 0xd40,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x1ba0, 0x1280, 0x2b20, 0x2b40, 0x2b60, 0xd40, 0xd40,
+	0x2b80, 0x2ba0, 0x2bc0, 0x2be0, 0x2c00, 0x2c20, 0x2c40, 0x2c60, 0x2c80, 0x2ca0, 0x2c40, 0x2c40, 0x2be0, 0x2cc0, 0x2ce0, 0x2be0,
+	0x2d00, 0x2d20, 0x2d40, 0x2be0, 0x2be0, 0x2c40, 0x2d60, 0x2d80, 0x2be0, 0x2da0, 0x2dc0, 0x2de0, 0x2e00, 0x2e20, 0x2c40, 0x2c40,
+	0x2be0, 0x2be0, 0x2e40, 0x2c40, 0x2e60, 0x2e80, 0x2be0, 0x2ea0, 0x2ec0, 0x2ee0, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40,
+	0x2c40, 0x2c40, 0x2c40, 0x2f00, 0x2be0, 0x2f20, 0x2c40, 0x2c40, 0x2be0, 0x2f40, 0x2f60, 0x2f80, 0x2fa0, 0x2fc0, 0x2fe0, 0x3000,
+	0x3020, 0x3040, 0x3060, 0x3080, 0x14a0, 0x30a0, 0x30c0, 0x30e0, 0x3100, 0x3120, 0x3140, 0x3160, 0x14a0, 0x3180, 0x31a0, 0x31c0,
+	0x31e0, 0x3200, 0xd40, 0xd40, 0x3220, 0x3240, 0x3260, 0x3280, 0x32a0, 0x32c0, 0x32e0, 0x3300, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x240, 0x3320, 0x3340, 0x3360, 0x240, 0x3380, 0x33a0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x240, 0x33c0, 0x33e0, 0xd40,
+	0x240, 0x3400, 0x3420, 0x3440, 0x240, 0x3460, 0x3480, 0xd40, 0x1020, 0x34a0, 0x34c0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x240, 0x34e0, 0xd40, 0xd40, 0xd40, 0x3a0, 0x240, 0x3500, 0x3520, 0x3540, 0x3560, 0xd40, 0xd40, 0x3580, 0x35a0, 0x35c0,
+	0x35e0, 0x3600, 0x3620, 0x240, 0x3640, 0x3660, 0x240, 0x10e0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x3680, 0x36a0, 0x36c0, 0x36e0, 0x3700, 0x3720, 0xd40, 0xd40, 0x3740, 0x3760, 0x3780, 0x37a0, 0x37c0, 0x3480, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x37e0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x3800, 0x3820, 0x3840,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x3860, 0xd40, 0xd40, 0xd40,
+	0x240, 0x240, 0x240, 0x3880, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x38a0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x2900, 0x240, 0x240, 0x38c0,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x38e0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x34c0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x10e0, 0xf60, 0x3900, 0x240, 0xf60, 0x3240, 0x3920, 0x240, 0x3940, 0x3960, 0x3980, 0x39a0, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0x3a0, 0x240, 0x2840, 0xd40, 0xd40, 0xd40, 0x240, 0x240, 0x39c0, 0x39e0, 0x3a00, 0xd40, 0xd40, 0x3a20,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x3a40,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x1280, 0xd40, 0x3a60, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x3a80,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x3aa0, 0x3ac0, 0x3ae0, 0x240, 0x240, 0x240, 0x240,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x2460, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x240, 0x240, 0x240, 0x3b00, 0x3b20, 0x3b40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x2c0, 0x3b60, 0x3b80, 0x240, 0x240, 0x240, 0x38a0, 0xd40,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x1280, 0x240, 0x3ba0, 0x3bc0, 0x3be0, 0x3c00, 0x3c20, 0x3c40, 0x3c60,
+	0x28a0, 0x28a0, 0x3c80, 0xd40, 0xd40, 0xd40, 0xd40, 0x3ca0, 0x1340, 0x1340, 0x3cc0, 0x10e0, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x3a0, 0x3a0, 0x3ce0, 0x3a0, 0x3d00, 0x3d20, 0x1de0, 0x3a0, 0x3d40, 0x3d60, 0x3d80, 0x3a0, 0x3a0, 0x3a0, 0x3a0, 0x3a0,
+	0x3a0, 0x3a0, 0x3a0, 0x3a0, 0x3a0, 0x3da0, 0x3dc0, 0x3a0, 0x3de0, 0x3a0, 0x3e00, 0x3a0, 0x3e20, 0x3a0, 0x3e40, 0x3e60,
+	0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240, 0x240,
+	0x2c0, 0x3e80, 0x2c0, 0x3ea0, 0x3ec0, 0x3ee0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xf60, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x3f00, 0x3f20, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x240, 0x3f40, 0x3f60, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0x2900, 0x3f80, 0x240, 0x3fa0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x3fc0,
+	0x2be0, 0x2be0, 0x2be0, 0x2be0, 0x2be0, 0x2be0, 0x3fe0, 0x2c40, 0x4000, 0x4020, 0x4040, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40,
+	0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40,
+	0x2c40, 0x2c40, 0x2c40, 0x4060, 0x660, 0x4080, 0x2c40, 0x2c40, 0x40a0, 0x40c0, 0x40e0, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40,
+	0x4100, 0x4120, 0x4140, 0x4160, 0x4180, 0x41a0, 0x41c0, 0x41e0, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40, 0x2c40,
+	0x1340, 0x4200, 0x1340, 0x1340, 0x4220, 0x4240, 0x4260, 0x4280, 0x42a0, 0x42c0, 0x3c0, 0x42e0, 0x4300, 0x4320, 0xd40, 0x4340,
+	0x4360, 0x4380, 0x43a0, 0x43c0, 0xd40, 0xd40, 0xd40, 0xd40, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x43e0, 0x4400, 0x1340, 0x1340, 0x1340, 0x4220, 0x1340, 0x1340, 0x4420, 0x4440,
+	0x4200, 0x1340, 0x4460, 0x1340, 0x4480, 0x44a0, 0xd40, 0xd40, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340, 0x1340,
+	0x1340, 0x1340, 0x4220, 0x44c0, 0x44e0, 0x4500, 0x4520, 0x4540, 0x1340, 0x1340, 0x1340, 0x1340, 0x4560, 0x1340, 0x19e0, 0x4580,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x45a0,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0xd40, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x45c0, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x45e0, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x4600, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x4620,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0x1f00, 0x1f00, 0x1f00, 0x4640, 0x1f00, 0x1f00, 0x1f00, 0x1f00, 0x4660, 0x1f00, 0x4660, 0x1f00, 0x1f00, 0x4660, 0x1f00, 0x1f00,
+	0x4680, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x45a0,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20,
+	0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x1d20, 0x46a0, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40,
+	0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0xd40, 0x45a0,
+	0x46c0, 0x46e0, 0x46e0, 0x46e0, 0x4700, 0x4700, 0x4700, 0x4700, 0x4720, 0x4720, 0x4720, 0x4720, 0x4720, 0x4720, 0x4720, 0x4740,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+	0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700, 0x4700,
+};
+
+const uint16_t idnaPropsData[] = {
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x8, 0x7, 0x8, 0x9, 0x7, 0x12, 0x12,
+	0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, 0x7, 0x7, 0x7, 0x8,
+	0x9, 0xa, 0xa, 0x4, 0x4, 0x4, 0xa, 0xa, 0xa, 0xa, 0xa, 0x3, 0x6, 0x3, 0x6, 0x6,
+	0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x6, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0x12,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc007, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0x4006, 0xa, 0x4, 0x4, 0x4, 0x4, 0xa, 0xa, 0x400a, 0xa, 0x4000, 0xa, 0xa, 0x80b2, 0xa, 0x400a,
+	0x4, 0x4, 0x4002, 0x4002, 0x400a, 0x4000, 0xa, 0xa, 0x400a, 0x4002, 0x4000, 0xa, 0x400a, 0x400a, 0x400a, 0xa,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x2000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000,
+	0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000,
+	0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x0, 0x4000,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x4000,
+	0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000,
+	0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x0,
+	0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0xa, 0xa,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x0, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x41b1, 0x41b1, 0x1b1, 0x41b1, 0x41b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x81b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x4400, 0x400, 0x4400, 0x400, 0x400a, 0x40a, 0x4400, 0x400, 0xc000, 0xc000, 0x4400, 0x400, 0x400, 0x400, 0x400a, 0x4400,
+	0xc000, 0xc000, 0xc000, 0xc000, 0x440a, 0x400a, 0x4400, 0x400a, 0x4400, 0x4400, 0x4400, 0xc000, 0x4400, 0xc000, 0x4400, 0x4400,
+	0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x4400, 0x4400, 0xc000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x400, 0x400, 0x400, 0x400,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400,
+	0x400, 0x400, 0x2400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x4400,
+	0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400,
+	0x4400, 0x400, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4400, 0x4400, 0x4400, 0x400, 0x4400, 0x4400, 0x40a, 0x4400, 0x400, 0x4400, 0x4400, 0x400, 0x400, 0x4400, 0x4400, 0x4400,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4000, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0xc000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0xa, 0xc000, 0xc000, 0xa, 0xa, 0x4,
+	0xc001, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1,
+	0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1,
+	0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x9b1, 0x801, 0x9b1,
+	0x801, 0x9b1, 0x9b1, 0x801, 0x9b1, 0x9b1, 0x801, 0x9b1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801,
+	0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0x801, 0xc001, 0xc001, 0xc001, 0xc001, 0x801,
+	0x801, 0x801, 0x801, 0x801, 0x801, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc005, 0xc005, 0xc005, 0xc005, 0xc005, 0xc005, 0xa, 0xa, 0xd, 0x4, 0x4, 0xd, 0x6, 0xd, 0xa, 0xa,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xd, 0xc0ad, 0xd, 0xd, 0xd,
+	0x4d, 0xd, 0x8d, 0x8d, 0x8d, 0x8d, 0x4d, 0x8d, 0x4d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d,
+	0x8d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x2d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x4d, 0x4d, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x4, 0x5, 0x5, 0xd, 0x4d, 0x4d,
+	0x1b1, 0x8d, 0x8d, 0x8d, 0xd, 0x408d, 0x408d, 0x408d, 0x404d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+	0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x8d, 0x4d, 0x4d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x4d, 0x8d, 0x4d, 0x8d,
+	0x4d, 0x4d, 0x8d, 0x8d, 0xd, 0x8d, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc005, 0xa, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xd, 0xd, 0x1b1, 0x1b1, 0xa, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x8d, 0x8d,
+	0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x4d, 0x4d, 0x4d, 0xd, 0xd, 0x4d,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xc00d, 0xc0ad,
+	0x8d, 0x1b1, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x4d, 0x8d, 0x4d, 0x8d, 0x4d, 0x4d, 0x8d,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc00d, 0xc00d, 0x8d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x8d, 0x4d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0xd, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1, 0x1, 0xa, 0xa, 0xa, 0xa, 0x21, 0xc001, 0xc001, 0x1b1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1, 0x1b1, 0x1b1, 0x1b1, 0x1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001,
+	0x81, 0x41, 0x41, 0x41, 0x41, 0x41, 0x81, 0x81, 0x41, 0x81, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x81, 0x41, 0x81, 0x81, 0x81, 0x1b1, 0x1b1, 0x1b1, 0xc001, 0xc001, 0x1, 0xc001,
+	0x4d, 0xd, 0x4d, 0x4d, 0x4d, 0x4d, 0xd, 0x8d, 0x4d, 0x8d, 0x8d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d,
+	0x8d, 0x8d, 0x8d, 0x2d, 0x2d, 0x2d, 0x4d, 0xd, 0xd, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0xc00d,
+	0xc005, 0xc005, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x8d, 0x8d, 0xd, 0x8d, 0x4d,
+	0x4d, 0x8d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0xd, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0xc005, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x100, 0x1b1, 0x0, 0x100, 0x100,
+	0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0x100, 0x3b1, 0x100, 0x100,
+	0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x1b1, 0x100, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0,
+	0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x0, 0x100, 0x100,
+	0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x100, 0x100, 0xc000, 0xc000, 0x100, 0x100, 0x3b1, 0x0, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000, 0x4000, 0xc000, 0x4000,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x4, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x1b1, 0xc000,
+	0xc000, 0x1b1, 0x1b1, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x4000, 0xc000, 0x0, 0x4000, 0xc000, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0xc000, 0x100, 0x100,
+	0x100, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x3b1, 0xc000, 0xc000,
+	0xc000, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x0, 0xc000, 0x4000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0x1b1, 0x1b1, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x0, 0x100, 0x100,
+	0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x100, 0xc000, 0x100, 0x100, 0x3b1, 0xc000, 0xc000,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x4, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0xc000, 0x1b1, 0x100, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0,
+	0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x0, 0x100, 0x1b1,
+	0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x100, 0x100, 0xc000, 0xc000, 0x100, 0x100, 0x3b1, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000, 0x4000, 0xc000, 0x0,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0x1b1, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x100, 0x100,
+	0x1b1, 0x100, 0x100, 0xc000, 0xc000, 0xc000, 0x100, 0x100, 0x100, 0xc000, 0x100, 0x100, 0x100, 0x3b1, 0xc000, 0xc000,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x4, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x100, 0x100, 0x100, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x0, 0x1b1, 0x1b1,
+	0x1b1, 0x100, 0x100, 0x100, 0x100, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1, 0x1b1, 0xc000, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x0,
+	0x0, 0x1b1, 0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x0, 0x100, 0x1a0,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0xc000, 0x1a0, 0x100, 0x100, 0xc000, 0x100, 0x100, 0x1b1, 0x3b1, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x100, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b1, 0x3b1, 0x0, 0x100, 0x100,
+	0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x100, 0x100, 0x100, 0xc000, 0x100, 0x100, 0x100, 0x3b1, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0x1b1, 0x100, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000, 0x100,
+	0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0xc000, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0xc000, 0x100, 0x100, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x1b1, 0x0, 0x4000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000, 0x4,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x1b1, 0x0, 0x4000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0x1b1, 0x1b1, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x4000, 0x4000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x1b1, 0x0, 0x1b1, 0xa, 0xa, 0xa, 0xa, 0x100, 0x100,
+	0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0,
+	0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0xc000, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x41b1, 0x41b1, 0x41b1, 0x41b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100,
+	0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x3b1, 0x0, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x41b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x3b1, 0x3b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1,
+	0x1b1, 0x0, 0x100, 0x100, 0x100, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x0, 0x0,
+	0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x0, 0x100,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x1b1, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000,
+	0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc009, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x1b1, 0x3b1, 0x300, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x1b1, 0x300, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0xc000, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc1b1, 0xc1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x3b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x1b1, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc00a, 0x4a, 0xa, 0xa, 0x2a, 0x81b1, 0x81b1, 0x81b1, 0xc012, 0x81b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x1b1, 0x40, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x100, 0x100, 0x1b1, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xc000, 0xc000, 0xc000, 0xa, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000,
+	0x3b1, 0x100, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x1b1, 0x100, 0x300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x1b1, 0x1b1, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x300, 0x3b1, 0x1b1, 0x1b1, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x100, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0x1b1, 0x100, 0x1b1,
+	0x1b1, 0x1b1, 0x300, 0x300, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x100, 0x1b1, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400, 0x400, 0x400, 0x400, 0x400, 0x0, 0x4000, 0x4000, 0x4000, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4400, 0x4400, 0x4400,
+	0x4400, 0x4400, 0x4000, 0x4000, 0x4000, 0x4000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4400,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x0, 0x0, 0x4000, 0x0,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0xc000, 0xc000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0xc000, 0xc000,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0xc000, 0xc000, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0xc000, 0xc000,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0xc000, 0x4400, 0xc000, 0x4400, 0xc000, 0x4400, 0xc000, 0x4400,
+	0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0x400, 0x4400, 0xc000, 0xc000,
+	0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400,
+	0x400, 0x400, 0x4400, 0x4400, 0x4400, 0xc000, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x440a, 0x4400, 0x440a,
+	0x440a, 0x440a, 0x4400, 0x4400, 0x4400, 0xc000, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x440a, 0x440a, 0x440a,
+	0x400, 0x400, 0x400, 0x4400, 0xc000, 0xc000, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0xc000, 0x440a, 0x440a, 0x440a,
+	0x400, 0x400, 0x400, 0x4400, 0x400, 0x400, 0x400, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x440a, 0x440a, 0x440a,
+	0xc000, 0xc000, 0x4400, 0x4400, 0x4400, 0xc000, 0x400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x4400, 0x440a, 0x440a, 0xc000,
+	0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x4009, 0x80b2, 0x2012, 0x2032, 0xc0a0, 0xc0a1,
+	0xa, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xc00a, 0xc00a, 0xc00a, 0xa, 0xc009, 0xc007, 0xc0ab, 0xc0ae, 0xc0b0, 0xc0ac, 0xc0af, 0x4006,
+	0x4, 0x4, 0x4, 0x4004, 0x4004, 0xa, 0x400a, 0x400a, 0xa, 0xa, 0xa, 0xa, 0x400a, 0xa, 0x400a, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0x6, 0xa, 0xa, 0x400a, 0x400a, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x4009,
+	0x80b2, 0xc0b2, 0xc0b2, 0xc0b2, 0x80b2, 0xc012, 0xc014, 0xc015, 0xc013, 0xc016, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2,
+	0x4002, 0x4000, 0xc000, 0xc000, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4003, 0x4003, 0x400a, 0x400a, 0x400a, 0x4000,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4003, 0x4003, 0x400a, 0x400a, 0x400a, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000,
+	0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4004, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+	0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+	0x4, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004, 0xc004,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x400a, 0x400a, 0x4000, 0x400a, 0xa, 0x400a, 0x400a, 0x4000, 0xa, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0x4000, 0x400a, 0xa, 0xa, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0xa,
+	0x400a, 0x400a, 0x400a, 0xa, 0x4000, 0xa, 0x4400, 0xa, 0x4000, 0xa, 0x4000, 0x4000, 0x4000, 0x4000, 0x4, 0x4000,
+	0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x400a, 0xa, 0xa, 0xa, 0xa, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa, 0xa, 0xa, 0xa, 0x0, 0x0,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400a, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0x3, 0x4, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0x400a, 0xa, 0x400a,
+	0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x100a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x100a, 0x100a,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002,
+	0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0xc002, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x0, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0x400a, 0x400a, 0x400a, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x400a, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x0, 0x4000, 0x0, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x0, 0x4000, 0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x4000, 0x0, 0x4000, 0x0, 0x1b1,
+	0x1b1, 0x1b1, 0x4000, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4000,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x3b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000,
+	0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a,
+	0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc000, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0x4c0a,
+	0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a,
+	0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a,
+	0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a, 0xc0a,
+	0xc0a, 0xc0a, 0xc0a, 0x4c0a, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a,
+	0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a,
+	0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a,
+	0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0x4c0a, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc00a, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4009, 0xa, 0x400a, 0xa, 0xa, 0xc00, 0x0, 0xc00, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100,
+	0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400a, 0xa, 0x4c00, 0x4c00, 0x4c00, 0xc00, 0x0, 0xa, 0xa, 0xa,
+	0xc000, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x400a, 0x400a, 0xc00, 0xc00, 0x4c00,
+	0xa, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xa, 0x0, 0xc00, 0xc00, 0x4c00,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000,
+	0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a, 0x400a, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4000,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a, 0x400a, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xa,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x0, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0xa, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xa, 0xa,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x1b1, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0xa, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x0, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x0,
+	0x4000, 0x0, 0x4000, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x4000, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x4000, 0x0, 0x4000, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x4000, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x3b1, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x100, 0x100, 0x1b1, 0x1b1, 0x100, 0xa, 0xa, 0xa, 0xa, 0x3b1, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x4, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+	0x40, 0x40, 0x60, 0x0, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x100, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x3b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x100, 0x300, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x100, 0x100,
+	0x300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100,
+	0x100, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x100, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x1b1, 0x100, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x1b1, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1,
+	0x0, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x1b1, 0x1b1, 0x100, 0x100,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x400, 0x0, 0x0, 0x0, 0x4000, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x0, 0x100, 0x100, 0x1b1, 0x100, 0x100, 0x1b1, 0x100, 0x100, 0x0, 0x100, 0x3b1, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xc00, 0xc00,
+	0x4c00, 0xc00, 0x4c00, 0xc00, 0xc00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xc00,
+	0x4c00, 0xc00, 0x4c00, 0xc00, 0xc00, 0x4c00, 0x4c00, 0xc00, 0xc00, 0xc00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xc000, 0xc000,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4801, 0x9b1, 0x4801,
+	0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4803, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801,
+	0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0xc001, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0xc001, 0x4801, 0xc001,
+	0x4801, 0x4801, 0xc001, 0x4801, 0x4801, 0xc001, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801, 0x4801,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0xc00d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xa,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xa, 0xa, 0xa,
+	0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1,
+	0x400a, 0x400a, 0xc00a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0xc00a, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0xc00a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0xa, 0xa, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x4006, 0x400a, 0xc006, 0xc000, 0x400a, 0x4006, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x4004,
+	0x400a, 0x400a, 0x4003, 0x4003, 0x400a, 0x400a, 0x400a, 0xc000, 0x400a, 0x4004, 0x4004, 0x400a, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x400d, 0x400d, 0x400d, 0xd, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0xc00d, 0x80b2,
+	0xc000, 0x400a, 0x400a, 0x4004, 0x4004, 0x4004, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x4003, 0x4006, 0x4003, 0x4006, 0x4006,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4006, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a,
+	0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4000, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4000, 0x4000,
+	0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000,
+	0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000,
+	0x4004, 0x4004, 0x400a, 0x400a, 0x400a, 0x4004, 0x4004, 0xc000, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0x400a, 0xc000,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc0aa, 0xc0aa, 0xc0aa, 0xc00a, 0xc00a, 0xc012, 0xc012,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0xa, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a,
+	0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a,
+	0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x40a, 0x400, 0x400, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0x40a, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2,
+	0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0x1, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0x1, 0xc001, 0xc001, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0xc001, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xa,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1b1, 0x1b1, 0x1b1, 0xc001, 0x1b1, 0x1b1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1, 0x1, 0x1, 0x1, 0xc001, 0x1, 0x1, 0x1, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0x1b1, 0x1b1, 0x1b1, 0xc001, 0xc001, 0xc001, 0xc001, 0x3b1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x81, 0x1, 0x81, 0x1, 0x81, 0x81, 0x1, 0x1, 0x61, 0x81, 0x81,
+	0x81, 0x81, 0x81, 0x41, 0x41, 0x41, 0x41, 0x61, 0x41, 0x41, 0x41, 0x41, 0x41, 0x81, 0x41, 0x41,
+	0x41, 0x81, 0x1, 0x1, 0x81, 0x1b1, 0x1b1, 0xc001, 0xc001, 0xc001, 0xc001, 0x41, 0x41, 0x41, 0x41, 0x81,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x41, 0x81, 0x41, 0x81, 0x81, 0x81, 0x41, 0x41, 0x41, 0x81, 0x41, 0x41, 0x81, 0x41, 0x81, 0x81,
+	0x41, 0x81, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x81, 0x81, 0x81, 0x81, 0x41, 0x41, 0x1,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+	0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+	0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001, 0x4001,
+	0x4001, 0x4001, 0x4001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x6d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x8d, 0x4d, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5,
+	0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0x5, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0x1b1, 0x1b1, 0x1, 0xc001, 0xc001,
+	0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x4d, 0x4d, 0x4d, 0x8d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0x4d,
+	0x4d, 0x4d, 0x4d, 0x4d, 0x4d, 0xd, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x4d, 0x4d, 0x4d, 0x8d, 0xd, 0xd, 0xd, 0xd, 0xd, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0x41, 0x41, 0x41, 0x41, 0x81, 0x81, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x41, 0x1, 0x41, 0x41, 0x81, 0x81, 0x81, 0x1, 0x41, 0x81, 0x81, 0x41, 0x41, 0x81, 0x41, 0x41,
+	0x1, 0x41, 0x81, 0x81, 0x41, 0x1, 0x1, 0x1, 0x1, 0x81, 0x41, 0x61, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x100, 0x1b1, 0x100, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x3b1, 0x0, 0x0, 0x1b1, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x3b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x3b1, 0x1b1, 0x0, 0x0, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x3b1, 0x3b1, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100,
+	0x300, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x100, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x1b1,
+	0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x300, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1,
+	0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x100, 0x100, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0,
+	0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x1b1, 0x1b1, 0x0, 0x100, 0x100,
+	0x1b1, 0x100, 0x100, 0x100, 0x100, 0xc000, 0xc000, 0x100, 0x100, 0xc000, 0xc000, 0x100, 0x100, 0x300, 0xc000, 0xc000,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x100, 0x100, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x100, 0x100, 0x3b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x1b1, 0x0,
+	0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x100, 0x100, 0x100, 0x100, 0x1b1,
+	0x1b1, 0x100, 0x3b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100,
+	0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x100, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x100, 0x3b1,
+	0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x100, 0x3b1,
+	0x1b1, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x100, 0x1b1, 0x100, 0x100,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x300, 0x1b1, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x3b1, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0xc000, 0x100, 0x100, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x300, 0x3b1, 0x0,
+	0x100, 0x0, 0x100, 0x1b1, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x100, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x100, 0x100, 0x100, 0x100,
+	0x3b1, 0x0, 0x0, 0x0, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1a0, 0x1a0, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x1b1, 0x3b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x3b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x100, 0x3a0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x100, 0x1b1, 0x1b1, 0x100, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0xc000, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x3b1, 0x3b1, 0x0, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0xc000,
+	0x1b1, 0x1b1, 0xc000, 0x100, 0x100, 0x1b1, 0x100, 0x3b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x100, 0x100, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0x4, 0x4, 0x4,
+	0x4, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc0a0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1,
+	0x0, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0x100, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0xc0a, 0xc00, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xd00, 0xd00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc00, 0xc00, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x1b1, 0x1b1, 0x0,
+	0x80b2, 0x80b2, 0x80b2, 0x80b2, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x100, 0x100, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x100, 0x100, 0x100,
+	0x100, 0x100, 0x100, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x40a, 0x40a, 0x5b1, 0x5b1, 0x5b1, 0x40a, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000,
+	0xc000, 0xc000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0x4000, 0xc000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x400a, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0x4002, 0x4002,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0xc000, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b1, 0x1b1, 0x1b1, 0x1b1,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x4,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0x0, 0x0, 0xc000, 0x0, 0x0, 0xc000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xc000,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+	0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041,
+	0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041, 0x4041,
+	0x4041, 0x4041, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41,
+	0x41, 0x41, 0x41, 0x41, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0x1b1, 0xa1, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xc001, 0xc001, 0xc001, 0xc001, 0x1, 0x1,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0xc00d, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd,
+	0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xd, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001, 0xc001,
+	0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0xc00d, 0x400d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0x400d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d,
+	0xc00d, 0x400d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0x400d,
+	0xc00d, 0x400d, 0x400d, 0xc00d, 0x400d, 0xc00d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0xc00d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d,
+	0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0x400d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xa, 0xa, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d, 0xc00d,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000,
+	0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xa,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x400a, 0x400a, 0x400a, 0xa, 0xa, 0xa,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x4c00, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4000, 0x4000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000,
+	0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xa, 0xa, 0xa, 0xc000, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa, 0xa,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0x4002, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc012, 0xc012,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00,
+	0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xcc00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xcc00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xcc00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00,
+	0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0x4c00, 0xc000, 0xc000,
+	0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc00, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xc000,
+	0xc012, 0xc0b2, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2,
+	0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2, 0xc0b2,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+	0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1,
+	0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1,
+	0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1, 0x81b1,
+	0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012, 0xc012,
+};
+
+const uint32_t uts46InertBMP[0x10000 >> 5] = {
+	0xffffffff, 0xffffffff, 0xf8000001, 0xffffffff, 0x0, 0x88c35afe, 0x80800000, 0xffffffff,
+	0xaaaaaaaa, 0x55a2aaaa, 0xaaaaa954, 0x54aaaaaa, 0x4e243129, 0xee512d2a, 0xb555400f, 0xaa21aaaa,
+	0xaaaaaaaa, 0x93faaaaa, 0xffffaa85, 0xffffffff, 0xffffffff, 0xfe00ffff, 0xc0ffffff, 0xffffffe0,
+	0x0, 0x0, 0x0, 0x38aa0000, 0x10000, 0xfffff000, 0xaa807fff, 0x1948aaaa,
+	0x0, 0xffff0000, 0xffffffff, 0xaaaaaaaa, 0xaaaaab06, 0xaaaaaaaa, 0xaaaad554, 0xaaaaaaaa,
+	0xaaaaaaaa, 0xaaaa, 0xfe000000, 0xffffffff, 0xe77f, 0x40000000, 0xffff0049, 0x1f87ff,
+	0xe800ffc0, 0xffffffff, 0x7ff, 0xfe1effff, 0xffffffff, 0xffffffff, 0x403fffff, 0xffffc260,
+	0xfffd3fff, 0xffff, 0xffffe000, 0xffffffff, 0xffffffff, 0x3ffff, 0xffffffff, 0xc7f007ff,
+	0x43fffff, 0x7fff0110, 0x41ffffff, 0xffff07ff, 0x7fff, 0xffffffff, 0x3ff, 0x0,
+	0xffffffff, 0xefffffff, 0xe1dfff, 0xffffffff, 0xfff99fef, 0xa3c5fdff, 0x599f, 0x3fffffcf,
+	0xfff987ee, 0xc325fdff, 0x10021987, 0x7fffc0, 0xfffbbfee, 0xe3edfdff, 0x11bbf, 0xfe03ffcf,
+	0xfff99fee, 0xa3edfdff, 0x8020199f, 0xffffcf, 0xd63dc7ec, 0x83ffc718, 0x11dc7, 0x7ffffc0,
+	0xfffddfff, 0xe3fffdff, 0x27001ddf, 0xff80ffcf, 0xfffddfff, 0xe3effdff, 0x60001ddb, 0x6ffcf,
+	0xfffddfff, 0xa7ffffff, 0xff70dddf, 0xffffffcf, 0xfc7fffee, 0x2ffbffff, 0x7f5f007f, 0x1cffc0,
+	0xfffffffe, 0x80f7ffff, 0xffff0ff, 0x0, 0xfffff7d6, 0x38f7ffaf, 0xc3ff305f, 0x0,
+	0xfcffefff, 0xfd5fffff, 0xef7bdef7, 0xc0001dff, 0xdef7ff20, 0xddffef7b, 0x7ffdfbf, 0x0,
+	0xffffffff, 0xf97fbfff, 0xffffffff, 0xffffffff, 0xffffdfff, 0x0, 0xffff0000, 0xefffffff,
+	0xffffffff, 0xffffffff, 0x7fffffff, 0xffc00000, 0xffffffff, 0xff, 0xfffffff8, 0xffffffff,
+	0xffffffff, 0xffffffff, 0x3d7f3dff, 0xffffffff, 0xffff3dff, 0x7f3dffff, 0xff7fff3d, 0xffffffff,
+	0xff3dffff, 0xffffffff, 0x7ffffff, 0x1fffffff, 0x3ffffff, 0xffffffff, 0xffffffff, 0x3fffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0x1ffffffe, 0xffffffff, 0xffffffff, 0x1ffffff,
+	0x800fffff, 0x6fffff, 0xfffff, 0xddfff, 0xffffffff, 0xffcfffff, 0x1ffbffff, 0x3ff03ff,
+	0x3ff07bf, 0xffffffff, 0xffffffff, 0x1ffffff, 0xffffffff, 0xffff05ff, 0xffffffff, 0x3fffff,
+	0x7fffffff, 0x1ff0fff, 0xfffffff1, 0x1f3fff, 0xffffffff, 0xffff0fff, 0xc7ff03ff, 0xffffffff,
+	0xce7fffff, 0xffffffff, 0x7fffffff, 0x1ffffe, 0x3ff03ff, 0x40003fff, 0x0, 0x0,
+	0xffffffff, 0xffcfffff, 0xffff1fef, 0x7ff007ff, 0xffffffff, 0xfffff3ff, 0xffffffff, 0xf003ffbf,
+	0xffffffff, 0xf87fffff, 0xffffe3ff, 0xffffffff, 0x0, 0x0, 0x800ff, 0x4efde02,
+	0xffffffff, 0x8008fff, 0x4000, 0xfefff800, 0x7ffffff, 0x0, 0x0, 0x0,
+	0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xb3eaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa,
+	0x3f00ff, 0xff00ff, 0xff003f, 0x155500ff, 0x0, 0x430000, 0xc70040, 0x4000f7,
+	0xff7d3000, 0xaf27008f, 0x7f7ffc7f, 0x0, 0x0, 0xfffffeff, 0xe0000001, 0x1d,
+	0xc1900110, 0x40042a8, 0xfc1e, 0x0, 0xffff0df7, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xfffe4fff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xfffff9ff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0x7f, 0x7ff, 0x0, 0x0, 0x0, 0x0, 0xfffff800,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffefff, 0xffffffff, 0xffffffff, 0xff8fffff, 0xffffffff, 0xffffffff, 0xefffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffcfffff, 0xffbfffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0x0, 0xffff0000, 0xffffffff, 0xfda1562, 0xaaaaaaaa, 0xaaaaaaaa, 0xaaaaaaaa, 0xfe0857fa,
+	0xffffffff, 0xffff20bf, 0xffffffff, 0x100ff, 0x7fffff, 0x7f7f7f7f, 0x7f7f7f7f, 0x0,
+	0xffffffff, 0xffffffff, 0x3fffffff, 0x0, 0x7bffffff, 0xffffffff, 0xffffffff, 0x7ffff,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xfffffffa, 0xf8bf03ff, 0xfffffffe, 0xffffffff, 0x607fffff, 0xffffffff, 0xffffffff, 0x7fffffff,
+	0xffffffe0, 0xffff, 0x0, 0x0, 0x30000, 0xffffffff, 0xffffffff, 0xffff000f,
+	0x0, 0x0, 0xff00, 0x80000000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff1fff, 0xffffffff, 0xffff007f, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xfff, 0xaaaaaaaa, 0xc00f6aaa, 0xaaaaaaa, 0xffffffff, 0xffffffff, 0xfcffff,
+	0xffffffff, 0xaaabaaab, 0xaaaaaaaa, 0x95feaaaa, 0xaabad7aa, 0xaaa082aa, 0x2aa050a, 0xfcc00000,
+	0xffffffbf, 0x3ff0fff, 0xffffffff, 0xffffff, 0xffffffff, 0xffffffff, 0x3ffc02f, 0xfffc0000,
+	0xffffffff, 0xffffc7ff, 0x8007ffff, 0x1fffffff, 0xffffffff, 0xfff7ffff, 0xc3ffbffe, 0x7fffffff,
+	0xffffffff, 0x7fffff, 0xf3ff3fff, 0xffffffff, 0xffffffff, 0x3e62ffff, 0xf8000005, 0x3fffff,
+	0x7e7e7e, 0xffff7f7f, 0xfffffff, 0xdff, 0x0, 0x0, 0xffffffff, 0x3ff1fff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffff000f, 0xfffff87f, 0xfffffff,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x801ac000, 0x39a, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0xfffc0000, 0x7, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0xc0000000, 0xffff, 0x0, 0x0, 0x0, 0x8000, 0xe0000000,
+	0x0, 0x0, 0x60, 0x80000, 0x0, 0x0, 0x0, 0x0,
+	0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20000000,
+};
+
+}
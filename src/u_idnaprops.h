@@ -0,0 +1,104 @@
+
+#ifndef MODULES_IDN_UIDNAPROPS_H_
+#define MODULES_IDN_UIDNAPROPS_H_
+
+#include "u_char.h"
+
+namespace uidna {
+
+// Properties of a code point for the label validation of UTS46::processLabel(), packed into 16 bits,
+// so that the validation needs one lookup per code point instead of one per property:
+//   bits  0..4  - Bidi_Class (UCharDirection), for the BiDi rule
+//   bits  5..7  - Joining_Type (UJoiningType), for CONTEXTJ
+//   bit   8     - General_Category=Mark, for the leading combining mark check
+//   bit   9     - Canonical_Combining_Class=Virama, for CONTEXTJ
+//   bits 10..11 - IDNAScriptClass, for CONTEXTO
+//   bit  12     - UTS #46 status disallowed_STD3_valid
+//   bit  13     - UTS #46 status deviation
+//
+// The data in u_idnaprops.cc, together with uts46InertBMP below, is generated by tools/genidnaprops.cpp (make genidnaprops)
+// from the separate property lookups, rerun it after updating the Unicode data.
+
+static constexpr uint16_t IDNAPropsBiDiMask = 0x1f;
+static constexpr int32_t IDNAPropsJoiningTypeShift = 5;
+static constexpr uint16_t IDNAPropsJoiningTypeMask = 7 << IDNAPropsJoiningTypeShift;
+static constexpr uint16_t IDNAPropsMark = 0x100;
+static constexpr uint16_t IDNAPropsVirama = 0x200;
+static constexpr int32_t IDNAPropsScriptShift = 10;
+static constexpr uint16_t IDNAPropsScriptMask = 3 << IDNAPropsScriptShift;
+static constexpr uint16_t IDNAPropsDisallowedSTD3Valid = 0x1000;
+static constexpr uint16_t IDNAPropsDeviation = 0x2000;
+static constexpr int32_t IDNAPropsStatusShift = 14;
+static constexpr uint16_t IDNAPropsStatusMask = 3 << IDNAPropsStatusShift;
+
+// The UTS #46 status of a code point. Valid includes deviation and disallowed_STD3_valid,
+// which have their own bits; Disallowed includes unassigned code points and surrogates.
+enum class UTS46Status {
+	Valid,
+	Mapped,
+	Ignored,
+	Disallowed,
+};
+
+// The scripts that the CONTEXTO rules look at.
+enum class IDNAScriptClass {
+	Other,
+	Greek,
+	Hebrew,
+	HiraganaKatakanaHan,
+};
+
+// Trie shape: BMP code points are looked up with one index level,
+// supplementary ones with two, both into data blocks of IDNAPropsBlockLength values.
+static constexpr int32_t IDNAPropsShift1 = 12;
+static constexpr int32_t IDNAPropsShift2 = 5;
+static constexpr int32_t IDNAPropsBlockLength = 1 << IDNAPropsShift2;
+static constexpr int32_t IDNAPropsIndex2BlockLength = 1 << (IDNAPropsShift1 - IDNAPropsShift2);
+
+extern const uint16_t idnaPropsBMPIndex[0x10000 >> IDNAPropsShift2];
+extern const uint16_t idnaPropsSuppIndex1[0x100000 >> IDNAPropsShift1];
+extern const uint16_t idnaPropsSuppIndex2[];
+extern const uint16_t idnaPropsData[];
+
+// Returns the properties of c; 0 (Bidi_Class=L, UTS46Status::Valid, no flags) for c outside of 0..0x10ffff.
+inline uint16_t getIDNAProps(UChar32 c) {
+	if ((uint32_t) c <= 0xffff) {
+		return idnaPropsData[idnaPropsBMPIndex[c >> IDNAPropsShift2] + (c & (IDNAPropsBlockLength - 1))];
+	} else if ((uint32_t) c <= 0x10ffff) {
+		int32_t i2 = idnaPropsSuppIndex1[(c - 0x10000) >> IDNAPropsShift1] + ((c >> IDNAPropsShift2) & (IDNAPropsIndex2BlockLength - 1));
+		return idnaPropsData[idnaPropsSuppIndex2[i2] + (c & (IDNAPropsBlockLength - 1))];
+	} else {
+		return 0;
+	}
+}
+
+// One bit per BMP code point, set if the uts46 normalizer leaves the code point unchanged
+// (it is not mapped, not disallowed, and has no decomposition that composes differently)
+// and it has a composition boundary before it, so it neither reorders nor combines with the preceding text.
+// A run of such code points can be copied without normalization; only the last one
+// may combine with what follows. Surrogate code points are never set.
+extern const uint32_t uts46InertBMP[0x10000 >> 5];
+
+inline bool isUTS46Inert(UChar32 c) {
+	return (uint32_t) c <= 0xffff && (uts46InertBMP[c >> 5] & ((uint32_t) 1 << (c & 0x1f))) != 0;
+}
+
+inline UCharDirection getIDNAPropsBiDi(uint16_t props) {
+	return (UCharDirection) (props & IDNAPropsBiDiMask);
+}
+
+inline UJoiningType getIDNAPropsJoiningType(uint16_t props) {
+	return (UJoiningType) ((props & IDNAPropsJoiningTypeMask) >> IDNAPropsJoiningTypeShift);
+}
+
+inline IDNAScriptClass getIDNAPropsScript(uint16_t props) {
+	return (IDNAScriptClass) ((props & IDNAPropsScriptMask) >> IDNAPropsScriptShift);
+}
+
+inline UTS46Status getIDNAPropsStatus(uint16_t props) {
+	return (UTS46Status) ((props & IDNAPropsStatusMask) >> IDNAPropsStatusShift);
+}
+
+}
+
+#endif /* MODULES_IDN_UIDNAPROPS_H_ */
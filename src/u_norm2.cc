@@ -86,6 +86,135 @@ static UChar32 codePointFromValidUTF8(const uint8_t *cpStart, const uint8_t *cpL
     return 0;
 }
 
+namespace {
+
+// Byte sink helpers for composeUTF8(), after ICU's ByteSinkUtil.
+
+inline uint8_t leadByteForCP(UChar32 c) {
+	if (c <= 0x7f) {
+		return (uint8_t) c;
+	} else if (c <= 0x7ff) {
+		return (uint8_t) (0xc0 + (c >> 6));
+	} else {
+		// Should not occur because ccc(U+0300)!=0.
+		return 0xe0;
+	}
+}
+
+/**
+ * Returns the code point from one single well-formed UTF-8 byte sequence
+ * between start and p, or U_SENTINEL if there is none.
+ * Only for Hangul syllables and conjoining Jamo, which are all 3-byte sequences.
+ */
+UChar32 previousHangulOrJamo(const uint8_t *start, const uint8_t *p) {
+	if ((p - start) >= 3) {
+		p -= 3;
+		uint8_t l = *p;
+		uint8_t t1, t2;
+		if (0xe1 <= l && l <= 0xed && (t1 = (uint8_t) (p[1] - 0x80)) <= 0x3f && (t2 = (uint8_t) (p[2] - 0x80)) <= 0x3f && (l < 0xed || t1 <= 0x1f)) {
+			return ((l & 0xf) << 12) | (t1 << 6) | t2;
+		}
+	}
+	return U_SENTINEL;
+}
+
+/**
+ * Returns the offset from the Jamo T base if [src, limit[ starts with a single Jamo T code point.
+ * Otherwise returns a negative value.
+ */
+int32_t getJamoTMinusBase(const uint8_t *src, const uint8_t *limit) {
+	// Jamo T: E1 86 A8..E1 87 82
+	if ((limit - src) >= 3 && *src == 0xe1) {
+		if (src[1] == 0x86) {
+			uint8_t t = src[2];
+			// The first Jamo T is U+11A8 but JAMO_T_BASE is 11A7.
+			// Offset 0 does not correspond to any conjoining Jamo.
+			if (0xa8 <= t && t <= 0xbf) {
+				return t - 0xa7;
+			}
+		} else if (src[1] == 0x87) {
+			uint8_t t = src[2];
+			if ((int8_t) t <= (int8_t) 0x82u) {
+				return t - (0xa7 - 0x40);
+			}
+		}
+	}
+	return -1;
+}
+
+inline UBool appendUnchanged(const uint8_t *s, const uint8_t *limit, ByteSink &sink, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return false;
+	}
+	if ((limit - s) > INT32_MAX) {
+		errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+		return false;
+	}
+	sink.Append(reinterpret_cast<const char*>(s), (int32_t) (limit - s));
+	return true;
+}
+
+inline void appendCodePoint(UChar32 c, ByteSink &sink) {
+	char s8[U8_MAX_LENGTH];
+	int32_t length = 0;
+	U8_APPEND_UNSAFE(s8, length, c);
+	sink.Append(s8, length);
+}
+
+/** Appends the UTF-8 form of the well-formed UTF-16 string s16. */
+UBool appendChange(const UChar *s16, int32_t s16Length, ByteSink &sink, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return false;
+	}
+	char scratch[200];
+	int32_t capacity;
+	char *buffer = sink.GetAppendBuffer(U8_MAX_LENGTH, s16Length * 3, scratch, UPRV_LENGTHOF(scratch), &capacity);
+	int32_t length = 0;
+	for (int32_t i = 0; i < s16Length;) {
+		UChar32 c;
+		U16_NEXT(s16, i, s16Length, c);
+		if ((capacity - length) < U8_MAX_LENGTH) {
+			sink.Append(buffer, length);
+			buffer = sink.GetAppendBuffer(U8_MAX_LENGTH, (s16Length - i + 1) * 3, scratch, UPRV_LENGTHOF(scratch), &capacity);
+			length = 0;
+		}
+		U8_APPEND_UNSAFE(buffer, length, c);
+	}
+	sink.Append(buffer, length);
+	return true;
+}
+
+/** The delta is added to the code point in [cpStart, cpLimit[, which must be well-formed UTF-8. */
+void appendCodePointDelta(const uint8_t *cpStart, const uint8_t *cpLimit, int32_t delta, ByteSink &sink) {
+	char buffer[U8_MAX_LENGTH];
+	int32_t length;
+	int32_t cpLength = (int32_t) (cpLimit - cpStart);
+	if (cpLength == 1) {
+		// The builder makes ASCII map to ASCII.
+		buffer[0] = (uint8_t) (*cpStart + delta);
+		length = 1;
+	} else {
+		int32_t trail = *(cpLimit - 1) + delta;
+		if (0x80 <= trail && trail <= 0xbf) {
+			// The delta only changes the last trail byte.
+			--cpLimit;
+			length = 0;
+			do {
+				buffer[length++] = *cpStart++;
+			} while (cpStart < cpLimit);
+			buffer[length++] = (uint8_t) trail;
+		} else {
+			// Decode the code point, add the delta, re-encode.
+			UChar32 c = codePointFromValidUTF8(cpStart, cpLimit) + delta;
+			length = 0;
+			U8_APPEND_UNSAFE(buffer, length, c);
+		}
+	}
+	sink.Append(buffer, length);
+}
+
+}  // namespace
+
 uint16_t Normalizer2Impl::getNorm16(UChar32 c) const {
 	return U_IS_LEAD(c) ?
 		static_cast<uint16_t>(INERT) :
@@ -265,23 +394,12 @@ UnicodeString& ComposeNormalizer2::normalize(const UnicodeString &src, UnicodeSt
 	return dest;
 }
 
-/*
-
-
-
-
- //   using Normalizer2WithImpl::normalize;  // Avoid warning about hiding base class function.
-
-void ComposeNormalizer2::normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink, Edits *edits, UErrorCode &errorCode) const {
+void ComposeNormalizer2::normalizeUTF8(StringPiece src, ByteSink &sink, UErrorCode &errorCode) const {
 	if (U_FAILURE(errorCode)) {
 		return;
 	}
-	if (edits != nullptr && (options & U_EDITS_NO_RESET) == 0) {
-		edits->reset();
-	}
 	const uint8_t *s = reinterpret_cast<const uint8_t *>(src.data());
-	impl.composeUTF8(options, onlyContiguous, s, s + src.length(),
-			&sink, edits, errorCode);
+	impl.composeUTF8(onlyContiguous, s, s + src.length(), &sink, errorCode);
 	sink.Flush();
 }
 
@@ -290,9 +408,16 @@ UBool ComposeNormalizer2::isNormalizedUTF8(StringPiece sp, UErrorCode &errorCode
 		return false;
 	}
 	const uint8_t *s = reinterpret_cast<const uint8_t*>(sp.data());
-	return impl.composeUTF8(0, onlyContiguous, s, s + sp.length(), nullptr, nullptr, errorCode);
+	return impl.composeUTF8(onlyContiguous, s, s + sp.length(), nullptr, errorCode);
 }
 
+/*
+
+
+
+
+ //   using Normalizer2WithImpl::normalize;  // Avoid warning about hiding base class function.
+
 UNormalizationCheckResult ComposeNormalizer2::quickCheck(const UnicodeString &s, UErrorCode &errorCode) const {
 	if (U_FAILURE(errorCode)) {
 		return UNORM_MAYBE;
@@ -599,6 +724,238 @@ UBool Normalizer2Impl::compose(const UChar *src, const UChar *limit, UBool onlyC
 	return true;
 }
 
+UBool Normalizer2Impl::composeUTF8(UBool onlyContiguous, const uint8_t *src, const uint8_t *limit,
+		ByteSink *sink, UErrorCode &errorCode) const {
+	UnicodeString s16;
+	uint8_t minNoMaybeLead = leadByteForCP(minCompNoMaybeCP);
+	const uint8_t *prevBoundary = src;
+
+	for (;;) {
+		// Fast path: Scan over a sequence of characters below the minimum "no or maybe" code point,
+		// or with (compYes && ccc==0) properties.
+		const uint8_t *prevSrc;
+		uint16_t norm16 = 0;
+		for (;;) {
+			if (src == limit) {
+				if (prevBoundary != limit && sink != nullptr) {
+					appendUnchanged(prevBoundary, limit, *sink, errorCode);
+				}
+				return true;
+			}
+			if (*src < minNoMaybeLead) {
+				++src;
+			} else {
+				prevSrc = src;
+				UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, src, limit, norm16);
+				if (!isCompYesAndZeroCC(norm16)) {
+					break;
+				}
+			}
+		}
+		// isCompYesAndZeroCC(norm16) is false, that is, norm16>=minNoNo.
+		// The current character is either a "noNo" (has a mapping)
+		// or a "maybeYes" (combines backward)
+		// or a "yesYes" with ccc!=0.
+		// It is not a Hangul syllable or Jamo L because those have "yes" properties.
+
+		// Medium-fast path: Handle cases that do not require full decomposition and recomposition.
+		if (!isMaybeOrNonZeroCC(norm16)) {  // minNoNo <= norm16 < minMaybeYes
+			if (sink == nullptr) {
+				return false;
+			}
+			// Fast path for mapping a character that is immediately surrounded by boundaries.
+			// In this case, we need not decompose around the current character.
+			if (isDecompNoAlgorithmic(norm16)) {
+				// Maps to a single isCompYesAndZeroCC character
+				// which also implies hasCompBoundaryBefore.
+				if (norm16HasCompBoundaryAfter(norm16, onlyContiguous) || hasCompBoundaryBefore(src, limit)) {
+					if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+						break;
+					}
+					appendCodePointDelta(prevSrc, src, getAlgorithmicDelta(norm16), *sink);
+					prevBoundary = src;
+					continue;
+				}
+			} else if (norm16 < minNoNoCompBoundaryBefore) {
+				// The mapping is comp-normalized which also implies hasCompBoundaryBefore.
+				if (norm16HasCompBoundaryAfter(norm16, onlyContiguous) || hasCompBoundaryBefore(src, limit)) {
+					if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+						break;
+					}
+					const uint16_t *mapping = getMapping(norm16);
+					int32_t length = *mapping++ & MAPPING_LENGTH_MASK;
+					if (!appendChange((const UChar*) mapping, length, *sink, errorCode)) {
+						break;
+					}
+					prevBoundary = src;
+					continue;
+				}
+			} else if (norm16 >= minNoNoEmpty) {
+				// The current character maps to nothing.
+				// Simply omit it from the output if there is a boundary before _or_ after it.
+				// The character itself implies no boundaries.
+				if (hasCompBoundaryBefore(src, limit) || hasCompBoundaryAfter(prevBoundary, prevSrc, onlyContiguous)) {
+					if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+						break;
+					}
+					prevBoundary = src;
+					continue;
+				}
+			}
+			// Other "noNo" type, or need to examine more text around this character:
+			// Fall through to the slow path.
+		} else if (isJamoVT(norm16)) {
+			// Jamo L: E1 84 80..92
+			// Jamo V: E1 85 A1..B5
+			// Jamo T: E1 86 A8..E1 87 82
+			// U_ASSERT((src - prevSrc) == 3 && *prevSrc == 0xe1);
+			UChar32 prev = previousHangulOrJamo(prevBoundary, prevSrc);
+			if (prevSrc[1] == 0x85) {
+				// The current character is a Jamo Vowel,
+				// compose with previous Jamo L and following Jamo T.
+				UChar32 l = prev - Hangul::JAMO_L_BASE;
+				if ((uint32_t) l < Hangul::JAMO_L_COUNT) {
+					if (sink == nullptr) {
+						return false;
+					}
+					int32_t t = getJamoTMinusBase(src, limit);
+					if (t >= 0) {
+						// The next character is a Jamo T.
+						src += 3;
+					} else if (hasCompBoundaryBefore(src, limit)) {
+						// No Jamo T follows, not even via decomposition.
+						t = 0;
+					}
+					if (t >= 0) {
+						UChar32 syllable = Hangul::HANGUL_BASE + (l * Hangul::JAMO_V_COUNT + (prevSrc[2] - 0xa1)) * Hangul::JAMO_T_COUNT + t;
+						prevSrc -= 3;  // Replace the Jamo L as well.
+						if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+							break;
+						}
+						appendCodePoint(syllable, *sink);
+						prevBoundary = src;
+						continue;
+					}
+					// If we see L+V+x where x!=T then we drop to the slow path,
+					// decompose and recompose.
+					// This is to deal with NFKC finding normal L and V but a
+					// compatibility variant of a T.
+					// We need to either fully compose that combination here
+					// (which would complicate the code and may not work with strange custom data)
+					// or use the slow path.
+				}
+			} else if (Hangul::isHangulLV(prev)) {
+				// The current character is a Jamo Trailing consonant,
+				// compose with previous Hangul LV that does not contain a Jamo T.
+				if (sink == nullptr) {
+					return false;
+				}
+				UChar32 syllable = prev + getJamoTMinusBase(prevSrc, src);
+				prevSrc -= 3;  // Replace the Hangul LV as well.
+				if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+					break;
+				}
+				appendCodePoint(syllable, *sink);
+				prevBoundary = src;
+				continue;
+			}
+			// No matching context, or may need to decompose surrounding text first:
+			// Fall through to the slow path.
+		} else if (norm16 > JAMO_VT) {  // norm16 >= MIN_YES_YES_WITH_CC
+			// One or more combining marks that do not combine-back:
+			// Check for canonical order, copy unchanged if ok and
+			// if followed by a character with a boundary-before.
+			uint8_t cc = getCCFromNormalYesOrMaybe(norm16);  // cc!=0
+			if (onlyContiguous /* FCC */&& getPreviousTrailCC(prevBoundary, prevSrc) > cc) {
+				// Fails FCD test, need to decompose and contiguously recompose.
+				if (sink == nullptr) {
+					return false;
+				}
+			} else {
+				// If !onlyContiguous (not FCC), then we ignore the tccc of
+				// the previous character which passed the quick check "yes && ccc==0" test.
+				const uint8_t *nextSrc;
+				uint16_t n16;
+				for (;;) {
+					if (src == limit) {
+						if (sink != nullptr) {
+							appendUnchanged(prevBoundary, limit, *sink, errorCode);
+						}
+						return true;
+					}
+					uint8_t prevCC = cc;
+					nextSrc = src;
+					UCPTRIE_FAST_U8_NEXT(normTrie, UCPTRIE_16, nextSrc, limit, n16);
+					if (n16 >= MIN_YES_YES_WITH_CC) {
+						cc = getCCFromNormalYesOrMaybe(n16);
+						if (prevCC > cc) {
+							if (sink == nullptr) {
+								return false;
+							}
+							break;
+						}
+					} else {
+						break;
+					}
+					src = nextSrc;
+				}
+				// src is after the last in-order combining mark.
+				// If there is a boundary here, then we continue with no change.
+				if (norm16HasCompBoundaryBefore(n16)) {
+					if (isCompYesAndZeroCC(n16)) {
+						src = nextSrc;
+					}
+					continue;
+				}
+				// Use the slow path. There is no boundary in [prevSrc, src[.
+			}
+		}
+
+		// Slow path: Find the nearest boundaries around the current character,
+		// decompose and recompose.
+		if (prevBoundary != prevSrc && !norm16HasCompBoundaryBefore(norm16)) {
+			const uint8_t *p = prevSrc;
+			UCPTRIE_FAST_U8_PREV(normTrie, UCPTRIE_16, prevBoundary, p, norm16);
+			if (!norm16HasCompBoundaryAfter(norm16, onlyContiguous)) {
+				prevSrc = p;
+			}
+		}
+		s16.remove();
+		{
+			ReorderingBuffer buffer(*this, s16);
+			if (!buffer.init(8, errorCode)) {
+				break;
+			}
+			// We know there is not a boundary here.
+			decomposeShort(prevSrc, src, STOP_AT_LIMIT, onlyContiguous, buffer, errorCode);
+			// Decompose until the next boundary.
+			src = decomposeShort(src, limit, STOP_AT_COMP_BOUNDARY, onlyContiguous, buffer, errorCode);
+			if (U_FAILURE(errorCode)) {
+				break;
+			}
+			if ((src - prevSrc) > INT32_MAX) {  // guard before buffer.equals()
+				errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+				return true;
+			}
+			recompose(buffer, 0, onlyContiguous);
+			if (buffer.equals(prevSrc, src)) {
+				continue;
+			}
+			if (sink == nullptr) {
+				return false;
+			}
+		}  // The ReorderingBuffer destructor finalizes s16.
+		if (prevBoundary != prevSrc && !appendUnchanged(prevBoundary, prevSrc, *sink, errorCode)) {
+			break;
+		}
+		if (!appendChange(s16.getBuffer(), s16.length(), *sink, errorCode)) {
+			break;
+		}
+		prevBoundary = src;
+	}
+	return true;
+}
+
 const UChar *Normalizer2Impl::copyLowPrefixFromNulTerminated(const UChar *src, UChar32 minNeedDataCP,
 		ReorderingBuffer *buffer, UErrorCode &errorCode) const {
 	// Make some effort to support NUL-terminated strings reasonably.
@@ -272,10 +272,14 @@ public:
 						  ReorderingBuffer &buffer,
 						  UErrorCode &errorCode) const;
 
-	/** sink==nullptr: isNormalized() */
-	UBool composeUTF8(uint32_t options, UBool onlyContiguous,
+	/**
+	 * Composes [src, limit[ directly in UTF-8 and appends the result to sink.
+	 * Ill-formed sequences are normalization-inert and are copied unchanged.
+	 * sink==nullptr: isNormalized()
+	 */
+	UBool composeUTF8(UBool onlyContiguous,
 					  const uint8_t *src, const uint8_t *limit,
-					  ByteSink *sink, Edits *edits, UErrorCode &errorCode) const;
+					  ByteSink *sink, UErrorCode &errorCode) const;
 
 	const UChar *makeFCD(const UChar *src, const UChar *limit,
 						 ReorderingBuffer *buffer, UErrorCode &errorCode) const;
@@ -517,7 +521,7 @@ public:
 
 	UnicodeString &normalize(const UnicodeString &src, UnicodeString &dest, UErrorCode &errorCode) const;
 
-	void normalizeUTF8(uint32_t options, StringPiece src, ByteSink &sink, Edits *edits, UErrorCode &errorCode) const;
+	void normalizeUTF8(StringPiece src, ByteSink &sink, UErrorCode &errorCode) const;
 
 	UnicodeString& normalizeSecondAndAppend(UnicodeString &first, const UnicodeString &second,
 			UBool doNormalize, UErrorCode &errorCode) const;
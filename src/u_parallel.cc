@@ -0,0 +1,273 @@
+
+#include "u_uts46.h"
+#include "u_arena.h"
+
+#include <thread>
+#include <vector>
+
+namespace uidna {
+
+// Names are scheduled in chunks: small enough to balance skewed inputs
+// (long Punycode-heavy names next to short ASCII ones),
+// large enough to keep the scheduling cost negligible.
+static constexpr int32_t ParallelChunkSize = 64;
+
+// Range of chunk indexes owned by a worker, packed as (end << 32) | begin,
+// so that the owner and the thieves can update it with a single CAS.
+// The owner takes chunks from the front, a thief splits off the back half.
+struct alignas(64) ParallelChunkRange {
+	std::atomic<uint64_t> range;
+
+	static uint64_t pack(uint32_t begin, uint32_t end) {
+		return (uint64_t(end) << 32) | begin;
+	}
+
+	void reset(uint32_t begin, uint32_t end) {
+		range.store(pack(begin, end), std::memory_order_release);
+	}
+
+	bool pop(uint32_t &index) {
+		uint64_t cur = range.load(std::memory_order_acquire);
+		for (;;) {
+			uint32_t begin = uint32_t(cur), end = uint32_t(cur >> 32);
+			if (begin >= end) {
+				return false;
+			}
+			if (range.compare_exchange_weak(cur, pack(begin + 1, end), std::memory_order_acq_rel)) {
+				index = begin;
+				return true;
+			}
+		}
+	}
+
+	bool steal(uint32_t &stolenBegin, uint32_t &stolenEnd) {
+		uint64_t cur = range.load(std::memory_order_acquire);
+		for (;;) {
+			uint32_t begin = uint32_t(cur), end = uint32_t(cur >> 32);
+			if (begin >= end) {
+				return false;
+			}
+			uint32_t mid = begin + (end - begin) / 2;
+			if (range.compare_exchange_weak(cur, pack(begin, mid), std::memory_order_acq_rel)) {
+				stolenBegin = mid;
+				stolenEnd = end;
+				return true;
+			}
+		}
+	}
+};
+
+// Per-thread output buffer, aligned to keep the buffers of different threads off each other's cache lines.
+struct alignas(64) ParallelOutput {
+	CharString buffer;
+};
+
+// Where the results of a chunk were written: a range in one worker's output buffer.
+struct ParallelChunkResult {
+	int32_t worker = 0;
+	int32_t start = 0;
+	int32_t length = 0;
+};
+
+class ParallelBatch {
+public:
+	ParallelBatch(const UTS46 *uts46, UBool toASCII, const UIDNAName *names, int32_t count,
+			int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, int32_t threadCount)
+	: uts46(uts46), toASCII(toASCII), names(names), count(count), offsets(offsets), lengths(lengths), pInfos(pInfos),
+	  chunkCount((count + ParallelChunkSize - 1) / ParallelChunkSize), threadCount(threadCount),
+	  ranges(threadCount), outputs(threadCount), chunks(chunkCount) { }
+
+	int32_t run(char *arena, int32_t arenaCapacity, UErrorCode &errorCode);
+
+private:
+	void runWorker(int32_t worker);
+	void processChunk(int32_t worker, uint32_t chunk, UErrorCode &errorCode);
+
+	const UTS46 *uts46;
+	UBool toASCII;
+	const UIDNAName *names;
+	int32_t count;
+	int32_t *offsets;
+	int32_t *lengths;
+	UIDNAInfo *pInfos;
+	int32_t chunkCount;
+	int32_t threadCount;
+
+	std::vector<ParallelChunkRange, HeapAllocator<ParallelChunkRange>> ranges;
+	std::vector<ParallelOutput, HeapAllocator<ParallelOutput>> outputs;
+	std::vector<ParallelChunkResult, HeapAllocator<ParallelChunkResult>> chunks;
+	std::atomic<int32_t> failure { U_ZERO_ERROR };
+};
+
+int32_t ParallelBatch::run(char *arena, int32_t arenaCapacity, UErrorCode &errorCode) {
+	// Initial distribution: contiguous chunk ranges of equal size.
+	for (int32_t i = 0; i < threadCount; ++i) {
+		ranges[i].reset(uint32_t(int64_t(chunkCount) * i / threadCount), uint32_t(int64_t(chunkCount) * (i + 1) / threadCount));
+	}
+
+	std::vector<std::thread, HeapAllocator<std::thread>> threads;
+	threads.reserve(threadCount - 1);
+	for (int32_t i = 1; i < threadCount; ++i) {
+		threads.emplace_back(&ParallelBatch::runWorker, this, i);
+	}
+	runWorker(0);
+	for (auto &thread : threads) {
+		thread.join();
+	}
+
+	int32_t failureCode = failure.load(std::memory_order_acquire);
+	if (failureCode != U_ZERO_ERROR) {
+		errorCode = UErrorCode(failureCode);
+		return 0;
+	}
+
+	// Pack the per-thread outputs into the arena in input order.
+	int32_t total = 0;
+	for (int32_t i = 0; i < chunkCount; ++i) {
+		const ParallelChunkResult &chunk = chunks[i];
+		if (chunk.length > INT32_MAX - total) {
+			errorCode = U_INDEX_OUTOFBOUNDS_ERROR;
+			return 0;
+		}
+		if (total < arenaCapacity) {
+			int32_t length = chunk.length < (arenaCapacity - total) ? chunk.length : (arenaCapacity - total);
+			memcpy(arena + total, outputs[chunk.worker].buffer.data() + chunk.start, length);
+		}
+		int32_t limit = (i + 1) * ParallelChunkSize < count ? (i + 1) * ParallelChunkSize : count;
+		for (int32_t j = i * ParallelChunkSize; j < limit; ++j) {
+			offsets[j] += total;
+		}
+		total += chunk.length;
+	}
+	if (total > arenaCapacity) {
+		errorCode = U_BUFFER_OVERFLOW_ERROR;
+	}
+	return total;
+}
+
+void ParallelBatch::runWorker(int32_t worker) {
+	UErrorCode errorCode = U_ZERO_ERROR;
+	for (;;) {
+		uint32_t chunk;
+		while (ranges[worker].pop(chunk)) {
+			processChunk(worker, chunk, errorCode);
+			if (U_FAILURE(errorCode)) {
+				int32_t expected = U_ZERO_ERROR;
+				failure.compare_exchange_strong(expected, errorCode, std::memory_order_acq_rel);
+				return;
+			}
+			if (failure.load(std::memory_order_relaxed) != U_ZERO_ERROR) {
+				return;
+			}
+		}
+
+		// Own range is exhausted, steal half of the first non-empty range of another worker.
+		bool stolen = false;
+		for (int32_t i = 1; i < threadCount; ++i) {
+			uint32_t begin, end;
+			if (ranges[(worker + i) % threadCount].steal(begin, end)) {
+				ranges[worker].reset(begin, end);
+				stolen = true;
+				break;
+			}
+		}
+		if (!stolen) {
+			return;
+		}
+	}
+}
+
+void ParallelBatch::processChunk(int32_t worker, uint32_t chunk, UErrorCode &errorCode) {
+	CharString &output = outputs[worker].buffer;
+	IDNAInfo info;
+
+	int32_t chunkStart = output.length();
+	int32_t begin = int32_t(chunk) * ParallelChunkSize;
+	int32_t limit = begin + ParallelChunkSize < count ? begin + ParallelChunkSize : count;
+	for (int32_t i = begin; i < limit; ++i) {
+		const UIDNAName &name = names[i];
+		if (name.data == NULL ? name.length != 0 : name.length < -1) {
+			errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+			return;
+		}
+		StringPiece src(name.data, name.length < 0 ? static_cast<int32_t>(uprv_strlen(name.data)) : name.length);
+		int32_t start = output.length();
+		{
+			// The output buffer outlives the name's arena scope, the result is copied into it outside of the arena.
+			CallArenaScope callArena(uts46->getCallArenaSize());
+			CharString result;
+			{
+				CharStringByteSink sink(&result, errorCode);
+				if (toASCII) {
+					uts46->nameToASCII_UTF8(src, sink, info, errorCode);
+				} else {
+					uts46->nameToUnicodeUTF8(src, sink, info, errorCode);
+				}
+			}
+			if (!uts46->hasFailFastError(info)) {  // a rejected name has an empty result, as in the serial batch
+				CallArenaSuspend suspend;
+				output.append(result, errorCode);
+			}
+		}
+		if (U_FAILURE(errorCode)) {
+			return;
+		}
+		// Relative to the chunk start for now, made absolute when the chunks are packed.
+		offsets[i] = start - chunkStart;
+		lengths[i] = output.length() - start;
+		if (pInfos) {
+			pInfos[i].isTransitionalDifferent = info.isTransitionalDifferent();
+			pInfos[i].errors = info.getErrors();
+		}
+	}
+
+	chunks[chunk].worker = worker;
+	chunks[chunk].start = chunkStart;
+	chunks[chunk].length = output.length() - chunkStart;
+}
+
+static int32_t processUTF8BatchParallel(const UIDNA *idna, UBool toASCII, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos,
+		int32_t threadCount, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	if (threadCount < 0) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+	if (threadCount == 0) {
+		threadCount = int32_t(std::thread::hardware_concurrency());
+	}
+	int32_t chunkCount = count > 0 ? (count + ParallelChunkSize - 1) / ParallelChunkSize : 0;
+	if (threadCount > chunkCount) {
+		threadCount = chunkCount;
+	}
+	if (threadCount <= 1) {
+		// Not worth starting threads, the serial batch gives the same results.
+		return toASCII
+				? uidna_nameToASCII_UTF8_batch(idna, names, count, arena, arenaCapacity, offsets, lengths, pInfos, pErrorCode)
+				: uidna_nameToUnicodeUTF8_batch(idna, names, count, arena, arenaCapacity, offsets, lengths, pInfos, pErrorCode);
+	}
+	if (names == NULL || offsets == NULL || lengths == NULL || (arena == NULL ? arenaCapacity != 0 : arenaCapacity < 0)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+
+	ParallelBatch batch(reinterpret_cast<const UTS46*>(idna), toASCII, names, count, offsets, lengths, pInfos, threadCount);
+	return batch.run(arena, arenaCapacity, *pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToASCII_UTF8_batchParallel(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos,
+		int32_t threadCount, UErrorCode *pErrorCode) {
+	return processUTF8BatchParallel(idna, true, names, count, arena, arenaCapacity, offsets, lengths, pInfos, threadCount, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToUnicodeUTF8_batchParallel(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos,
+		int32_t threadCount, UErrorCode *pErrorCode) {
+	return processUTF8BatchParallel(idna, false, names, count, arena, arenaCapacity, offsets, lengths, pInfos, threadCount, pErrorCode);
+}
+
+}
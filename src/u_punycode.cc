@@ -45,8 +45,11 @@ Disclaimer and license
  */
 
 #include "u_types.h"
+#include "u_arena.h"
 #include "u_macro.h"
 
+#include <algorithm>
+
 /**
  * NUL-terminate a string no matter what its type.
  * Set warning and error codes accordingly.
@@ -195,101 +198,116 @@ int32_t u_terminateChars(char *dest, int32_t destCapacity, int32_t length, UErro
 }
 
 
-// encode
-U_CAPI int32_t u_strToPunycode(const UChar *src, int32_t srcLength, UChar *dest, int32_t destCapacity,
-		const UBool *caseFlags, UErrorCode *pErrorCode) {
-	constexpr int32_t ENCODE_MAX_CODE_UNITS = 1000;
+/*
+ * Encoder state for the non-basic code points: one key per code point,
+ * sorted once by code point, then by position.
+ * Key bits: 31 = case flag, 30..10 = code point, 9..0 = code point index in the input.
+ */
+constexpr int32_t ENCODE_POSITION_BITS = 10;
+constexpr uint32_t ENCODE_POSITION_MASK = (1 << ENCODE_POSITION_BITS) - 1;
+constexpr uint32_t ENCODE_CASE_FLAG = 0x80000000;
 
-	int32_t cpBuffer[ENCODE_MAX_CODE_UNITS];
-	int32_t n, delta, handledCPCount, basicLength, destLength, bias, j, m, q, k, t, srcCPCount;
-	UChar c, c2;
+static_assert(ENCODE_MAX_CODE_UNITS <= (1 << ENCODE_POSITION_BITS), "Code point index does not fit into the encoder key");
 
-	/* argument checking */
-	if (pErrorCode == NULL || U_FAILURE(*pErrorCode)) {
-		return 0;
+/* Labels of up to this many code points are encoded without heap memory. */
+constexpr int32_t ENCODE_SHORT_CODE_POINTS = 64;
+
+static inline uint32_t encodeKey(UChar32 c, int32_t index, UBool caseFlag) {
+	return (caseFlag ? ENCODE_CASE_FLAG : 0) | ((uint32_t) c << ENCODE_POSITION_BITS) | (uint32_t) index;
+}
+
+/*
+ * Handled code points by position, for short labels: one bit per position.
+ * Initially the basic code points, which are all positions without a key.
+ */
+class EncodeHandledMask {
+public:
+	EncodeHandledMask(const uint32_t *keys, int32_t keyCount, int32_t cpCount) {
+		bits = cpCount < 64 ? (((uint64_t) 1) << cpCount) - 1 : ~(uint64_t) 0;
+		for (int32_t i = 0; i < keyCount; ++i) {
+			bits &= ~(((uint64_t) 1) << (keys[i] & ENCODE_POSITION_MASK));
+		}
 	}
 
-	if (src == NULL || srcLength < -1 || (dest == NULL && destCapacity != 0)) {
-		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
-		return 0;
+	void add(int32_t index) {
+		bits |= ((uint64_t) 1) << index;
 	}
-	if (srcLength > ENCODE_MAX_CODE_UNITS) {
-		*pErrorCode = U_INPUT_TOO_LONG_ERROR;
-		return 0;
+
+	/* Number of handled code points before index. */
+	int32_t countBefore(int32_t index) const {
+		uint64_t before = bits & ((((uint64_t) 1) << index) - 1);
+#if defined(__GNUC__)
+		return __builtin_popcountll(before);
+#else
+		int32_t count = 0;
+		for (; before != 0; before &= before - 1) {
+			++count;
+		}
+		return count;
+#endif
 	}
 
-	/*
-	 * Handle the basic code points and
-	 * convert extended ones to UTF-32 in cpBuffer (caseFlag in sign bit):
-	 */
-	srcCPCount = destLength = 0;
-	if (srcLength == -1) {
-		/* NUL-terminated input */
-		for (j = 0; /* no condition */; ++j) {
-			if ((c = src[j]) == 0) {
-				break;
-			}
-			if (j >= ENCODE_MAX_CODE_UNITS) {
-				*pErrorCode = U_INPUT_TOO_LONG_ERROR;
-				return 0;
-			}
-			if (IS_BASIC(c)) {
-				cpBuffer[srcCPCount++] = 0;
-				if (destLength < destCapacity) {
-					dest[destLength] = caseFlags != NULL ? asciiCaseMap((char) c, caseFlags[j]) : (char) c;
-				}
-				++destLength;
-			} else {
-				n = (caseFlags != NULL && caseFlags[j]) << 31L;
-				if (U16_IS_SINGLE(c)) {
-					n |= c;
-				} else if (U16_IS_LEAD(c) && U16_IS_TRAIL(c2 = src[j + 1])) {
-					++j;
-					n |= (int32_t) U16_GET_SUPPLEMENTARY(c, c2);
-				} else {
-					/* error: unmatched surrogate */
-					*pErrorCode = U_INVALID_CHAR_FOUND;
-					return 0;
-				}
-				cpBuffer[srcCPCount++] = n;
-			}
+private:
+	uint64_t bits;
+};
+
+/*
+ * Handled code points by position, for longer labels: a Fenwick tree
+ * in tree[1..cpCount], with logarithmic updates and prefix counts.
+ */
+class EncodeHandledTree {
+public:
+	EncodeHandledTree(int32_t *tree, const uint32_t *keys, int32_t keyCount, int32_t cpCount)
+	: tree(tree), size(cpCount) {
+		int32_t i, j;
+		for (i = 1; i <= size; ++i) {
+			tree[i] = 1;
 		}
-	} else {
-		/* length-specified input */
-		for (j = 0; j < srcLength; ++j) {
-			c = src[j];
-			if (IS_BASIC(c)) {
-				cpBuffer[srcCPCount++] = 0;
-				if (destLength < destCapacity) {
-					dest[destLength] = caseFlags != NULL ? asciiCaseMap((char) c, caseFlags[j]) : (char) c;
-				}
-				++destLength;
-			} else {
-				n = (caseFlags != NULL && caseFlags[j]) << 31L;
-				if (U16_IS_SINGLE(c)) {
-					n |= c;
-				} else if (U16_IS_LEAD(c) && (j + 1) < srcLength && U16_IS_TRAIL(c2 = src[j + 1])) {
-					++j;
-					n |= (int32_t) U16_GET_SUPPLEMENTARY(c, c2);
-				} else {
-					/* error: unmatched surrogate */
-					*pErrorCode = U_INVALID_CHAR_FOUND;
-					return 0;
-				}
-				cpBuffer[srcCPCount++] = n;
+		for (i = 0; i < keyCount; ++i) {
+			tree[(keys[i] & ENCODE_POSITION_MASK) + 1] = 0;
+		}
+		/* Build the tree from the per-position values in linear time. */
+		for (i = 1; i <= size; ++i) {
+			j = i + (i & -i);
+			if (j <= size) {
+				tree[j] += tree[i];
 			}
 		}
 	}
 
-	/* Finish the basic string - if it is not empty - with a delimiter. */
-	basicLength = destLength;
-	if (basicLength > 0) {
-		if (destLength < destCapacity) {
-			dest[destLength] = DELIMITER;
+	void add(int32_t index) {
+		for (int32_t i = index + 1; i <= size; i += i & -i) {
+			++tree[i];
 		}
-		++destLength;
 	}
 
+	/* Number of handled code points before index. */
+	int32_t countBefore(int32_t index) const {
+		int32_t count = 0;
+		for (int32_t i = index; i > 0; i -= i & -i) {
+			count += tree[i];
+		}
+		return count;
+	}
+
+private:
+	int32_t *tree;
+	int32_t size;
+};
+
+/*
+ * Main encoding loop, after the basic code points and the delimiter have been output.
+ *
+ * The spec scans all code points once per distinct non-basic code point m, counting those < m
+ * up to each occurrence of m. Here, the keys are visited in sorted order instead, and each count
+ * is the number of handled code points between two occurrences: all code points < m
+ * have been handled when m is reached, and none >= m have.
+ */
+template <typename Char, typename Handled>
+static int32_t encodeDeltas(const uint32_t *keys, int32_t keyCount, Handled &handled, int32_t basicLength,
+		Char *dest, int32_t destLength, int32_t destCapacity, UErrorCode *pErrorCode) {
+	int32_t n, delta, handledCPCount, bias, i, groupStart, counted, before, m, q, k, t;
+
 	/*
 	 * handledCPCount is the number of code points that have been handled
 	 * basicLength is the number of basic code points
@@ -300,19 +318,11 @@ U_CAPI int32_t u_strToPunycode(const UChar *src, int32_t srcLength, UChar *dest,
 	n = INITIAL_N;
 	delta = 0;
 	bias = INITIAL_BIAS;
+	handledCPCount = basicLength;
 
-	/* Main encoding loop: */
-	for (handledCPCount = basicLength; handledCPCount < srcCPCount; /* no op */) {
-		/*
-		 * All non-basic code points < n have been handled already.
-		 * Find the next larger one:
-		 */
-		for (m = 0x7fffffff, j = 0; j < srcCPCount; ++j) {
-			q = cpBuffer[j] & 0x7fffffff; /* remove case flag from the sign bit */
-			if (n <= q && q < m) {
-				m = q;
-			}
-		}
+	for (i = 0; i < keyCount; /* no op */) {
+		/* The next larger non-basic code point: */
+		m = (int32_t) ((keys[i] & ~ENCODE_CASE_FLAG) >> ENCODE_POSITION_BITS);
 
 		/*
 		 * Increase delta enough to advance the decoder's
@@ -325,57 +335,177 @@ U_CAPI int32_t u_strToPunycode(const UChar *src, int32_t srcLength, UChar *dest,
 		delta += (m - n) * (handledCPCount + 1);
 		n = m;
 
-		/* Encode a sequence of same code points n */
-		for (j = 0; j < srcCPCount; ++j) {
-			q = cpBuffer[j] & 0x7fffffff; /* remove case flag from the sign bit */
-			if (q < n) {
-				++delta;
-			} else if (q == n) {
-				/* Represent delta as a generalized variable-length integer: */
-				for (q = delta, k = BASE; /* no condition */; k += BASE) {
-
-					/** RAM: comment out the old code for conformance with draft-ietf-idn-punycode-03.txt
-
-					 t=k-bias;
-					 if(t<TMIN) {
-					 t=TMIN;
-					 } else if(t>TMAX) {
-					 t=TMAX;
-					 }
-					 */
-
-					t = k - bias;
-					if (t < TMIN) {
-						t = TMIN;
-					} else if (k >= (bias + TMAX)) {
-						t = TMAX;
-					}
-
-					if (q < t) {
-						break;
-					}
+		/* Encode the sequence of same code points n, in input order */
+		groupStart = i;
+		counted = 0;
+		before = handledCPCount;
+		do {
+			/* Count the code points < n since the previous occurrence of n: */
+			q = handled.countBefore((int32_t) (keys[i] & ENCODE_POSITION_MASK));
+			delta += q - counted;
+			counted = q;
+
+			/* Represent delta as a generalized variable-length integer: */
+			for (q = delta, k = BASE; /* no condition */; k += BASE) {
+				t = k - bias;
+				if (t < TMIN) {
+					t = TMIN;
+				} else if (k >= (bias + TMAX)) {
+					t = TMAX;
+				}
 
-					if (destLength < destCapacity) {
-						dest[destLength] = digitToBasic(t + (q - t) % (BASE - t), 0);
-					}
-					++destLength;
-					q = (q - t) / (BASE - t);
+				if (q < t) {
+					break;
 				}
 
 				if (destLength < destCapacity) {
-					dest[destLength] = digitToBasic(q, (UBool) (cpBuffer[j] < 0));
+					dest[destLength] = digitToBasic(t + (q - t) % (BASE - t), 0);
 				}
 				++destLength;
-				bias = adaptBias(delta, handledCPCount + 1, (UBool) (handledCPCount == basicLength));
-				delta = 0;
-				++handledCPCount;
+				q = (q - t) / (BASE - t);
+			}
+
+			if (destLength < destCapacity) {
+				dest[destLength] = digitToBasic(q, (UBool) ((keys[i] & ENCODE_CASE_FLAG) != 0));
 			}
+			++destLength;
+			bias = adaptBias(delta, handledCPCount + 1, (UBool) (handledCPCount == basicLength));
+			delta = 0;
+			++handledCPCount;
+			++i;
+		} while (i < keyCount && (int32_t) ((keys[i] & ~ENCODE_CASE_FLAG) >> ENCODE_POSITION_BITS) == n);
+
+		/* The code points < n after the last occurrence, then the same step as in the spec. */
+		delta += before - counted;
+		for (; groupStart < i; ++groupStart) {
+			handled.add((int32_t) (keys[groupStart] & ENCODE_POSITION_MASK));
 		}
 
 		++delta;
 		++n;
 	}
 
+	return destLength;
+}
+
+static inline UBool encodeKeyLess(uint32_t a, uint32_t b) {
+	return (a & ~ENCODE_CASE_FLAG) < (b & ~ENCODE_CASE_FLAG);
+}
+
+/*
+ * Sorts the keys of the non-basic code points (collected in input order) and encodes them.
+ * tree must have room for cpCount + 1 values if cpCount > ENCODE_SHORT_CODE_POINTS.
+ */
+template <typename Char>
+static int32_t encodeNonBasic(uint32_t *keys, int32_t keyCount, int32_t cpCount, int32_t *tree, int32_t basicLength,
+		Char *dest, int32_t destLength, int32_t destCapacity, UErrorCode *pErrorCode) {
+	if (cpCount <= ENCODE_SHORT_CODE_POINTS) {
+		/* insertion sort: few keys, often almost in order */
+		for (int32_t i = 1; i < keyCount; ++i) {
+			uint32_t key = keys[i];
+			int32_t j = i;
+			for (; j > 0 && encodeKeyLess(key, keys[j - 1]); --j) {
+				keys[j] = keys[j - 1];
+			}
+			keys[j] = key;
+		}
+		EncodeHandledMask handled(keys, keyCount, cpCount);
+		return encodeDeltas(keys, keyCount, handled, basicLength, dest, destLength, destCapacity, pErrorCode);
+	} else {
+		EncodeHandledTree handled(tree, keys, keyCount, cpCount);
+		std::sort(keys, keys + keyCount, encodeKeyLess);
+		return encodeDeltas(keys, keyCount, handled, basicLength, dest, destLength, destCapacity, pErrorCode);
+	}
+}
+
+// encode
+U_CAPI int32_t u_strToPunycode(const UChar *src, int32_t srcLength, UChar *dest, int32_t destCapacity,
+		const UBool *caseFlags, UErrorCode *pErrorCode) {
+	int32_t basicLength, destLength, j, keyCount, srcCPCount;
+	UChar c, c2;
+
+	/* argument checking */
+	if (pErrorCode == NULL || U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+
+	if (src == NULL || srcLength < -1 || (dest == NULL && destCapacity != 0)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+	if (srcLength == -1) {
+		/* NUL-terminated input, measured only up to the limit */
+		for (srcLength = 0; src[srcLength] != 0; ++srcLength) {
+			if (srcLength >= ENCODE_MAX_CODE_UNITS) {
+				*pErrorCode = U_INPUT_TOO_LONG_ERROR;
+				return 0;
+			}
+		}
+	} else if (srcLength > ENCODE_MAX_CODE_UNITS) {
+		*pErrorCode = U_INPUT_TOO_LONG_ERROR;
+		return 0;
+	}
+
+	/* Buffers sized to the input: on the stack for short labels. */
+	uint32_t keyStackBuffer[ENCODE_SHORT_CODE_POINTS];
+	uint32_t *keys = keyStackBuffer;
+	int32_t *tree = NULL;
+	if (srcLength > ENCODE_SHORT_CODE_POINTS) {
+		keys = (uint32_t*) uprv_malloc(srcLength * sizeof(uint32_t) + (srcLength + 1) * sizeof(int32_t));
+		if (keys == NULL) {
+			*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+			return 0;
+		}
+		tree = (int32_t*) (keys + srcLength);
+	}
+
+	/*
+	 * Handle the basic code points and
+	 * collect the extended ones as keys (with case flags):
+	 */
+	keyCount = srcCPCount = destLength = 0;
+	for (j = 0; j < srcLength; ++j) {
+		c = src[j];
+		if (IS_BASIC(c)) {
+			++srcCPCount;
+			if (destLength < destCapacity) {
+				dest[destLength] = caseFlags != NULL ? asciiCaseMap((char) c, caseFlags[j]) : (char) c;
+			}
+			++destLength;
+		} else {
+			UBool caseFlag = caseFlags != NULL && caseFlags[j];
+			if (U16_IS_SINGLE(c)) {
+				keys[keyCount++] = encodeKey(c, srcCPCount++, caseFlag);
+			} else if (U16_IS_LEAD(c) && (j + 1) < srcLength && U16_IS_TRAIL(c2 = src[j + 1])) {
+				++j;
+				keys[keyCount++] = encodeKey(U16_GET_SUPPLEMENTARY(c, c2), srcCPCount++, caseFlag);
+			} else {
+				/* error: unmatched surrogate */
+				*pErrorCode = U_INVALID_CHAR_FOUND;
+				break;
+			}
+		}
+	}
+
+	if (U_SUCCESS(*pErrorCode)) {
+		/* Finish the basic string - if it is not empty - with a delimiter. */
+		basicLength = destLength;
+		if (basicLength > 0) {
+			if (destLength < destCapacity) {
+				dest[destLength] = DELIMITER;
+			}
+			++destLength;
+		}
+
+		destLength = encodeNonBasic(keys, keyCount, srcCPCount, tree, basicLength, dest, destLength, destCapacity, pErrorCode);
+	}
+
+	if (keys != keyStackBuffer) {
+		uprv_free(keys);
+	}
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
 	return u_terminateUChars(dest, destCapacity, destLength, pErrorCode);
 }
 
@@ -588,6 +718,246 @@ U_CAPI int32_t u_strFromPunycode(const UChar *src, int32_t srcLength, UChar *des
 }
 
 
+// encode, UTF-8 input
+U_CAPI int32_t u_strToPunycodeUTF8(const char *src, int32_t srcLength, char *dest, int32_t destCapacity,
+		UErrorCode *pErrorCode) {
+	int32_t basicLength, destLength, j, keyCount, srcCPCount, srcLength16, capacity;
+	UChar32 c;
+
+	/* argument checking */
+	if (pErrorCode == NULL || U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+
+	if (src == NULL || srcLength < -1 || (dest == NULL && destCapacity != 0)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+	if (srcLength == -1) {
+		srcLength = static_cast<int32_t>(uprv_strlen(src));
+	}
+
+	/*
+	 * Buffers sized to the input: on the stack for short labels.
+	 * There are no more code points than bytes, nor than the limit of UTF-16 code units.
+	 */
+	capacity = srcLength < ENCODE_MAX_CODE_UNITS ? srcLength : ENCODE_MAX_CODE_UNITS;
+	uint32_t keyStackBuffer[ENCODE_SHORT_CODE_POINTS];
+	uint32_t *keys = keyStackBuffer;
+	int32_t *tree = NULL;
+	if (capacity > ENCODE_SHORT_CODE_POINTS) {
+		keys = (uint32_t*) uprv_malloc(capacity * sizeof(uint32_t) + (capacity + 1) * sizeof(int32_t));
+		if (keys == NULL) {
+			*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+			return 0;
+		}
+		tree = (int32_t*) (keys + capacity);
+	}
+
+	/*
+	 * Handle the basic code points and
+	 * collect the extended ones as keys.
+	 * The input limit is the same as for UTF-16 input, counted in UTF-16 code units.
+	 */
+	keyCount = srcCPCount = destLength = srcLength16 = 0;
+	for (j = 0; j < srcLength;) {
+		U8_NEXT(src, j, srcLength, c);
+		if (c < 0) {
+			/* error: ill-formed UTF-8 */
+			*pErrorCode = U_INVALID_CHAR_FOUND;
+			break;
+		}
+		srcLength16 += U16_LENGTH(c);
+		if (srcLength16 > ENCODE_MAX_CODE_UNITS) {
+			*pErrorCode = U_INPUT_TOO_LONG_ERROR;
+			break;
+		}
+		if (IS_BASIC(c)) {
+			++srcCPCount;
+			if (destLength < destCapacity) {
+				dest[destLength] = (char) c;
+			}
+			++destLength;
+		} else {
+			keys[keyCount++] = encodeKey(c, srcCPCount++, false);
+		}
+	}
+
+	if (U_SUCCESS(*pErrorCode)) {
+		/* Finish the basic string - if it is not empty - with a delimiter. */
+		basicLength = destLength;
+		if (basicLength > 0) {
+			if (destLength < destCapacity) {
+				dest[destLength] = DELIMITER;
+			}
+			++destLength;
+		}
+
+		/* Same as for UTF-16 input without case flags. */
+		destLength = encodeNonBasic(keys, keyCount, srcCPCount, tree, basicLength, dest, destLength, destCapacity, pErrorCode);
+	}
+
+	if (keys != keyStackBuffer) {
+		uprv_free(keys);
+	}
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
+// decode, UTF-8 output
+U_CAPI int32_t u_strFromPunycodeUTF8(const char *src, int32_t srcLength, char *dest, int32_t destCapacity,
+		UErrorCode *pErrorCode) {
+	int32_t n, destLength, i, bias, basicLength, j, in, oldi, w, k, digit, t, destCPCount;
+	char b;
+
+	/* argument checking */
+	if (pErrorCode == NULL || U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+
+	if (src == NULL || srcLength < -1 || (dest == NULL && destCapacity != 0)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+
+	if (srcLength == -1) {
+		srcLength = static_cast<int32_t>(uprv_strlen(src));
+	}
+	if (srcLength > DECODE_MAX_CHARS) {
+		*pErrorCode = U_INPUT_TOO_LONG_ERROR;
+		return 0;
+	}
+
+	/*
+	 * Handle the basic code points:
+	 * Let basicLength be the number of input code points
+	 * before the last delimiter, or 0 if there is none.
+	 */
+	for (j = srcLength; j > 0;) {
+		if (src[--j] == DELIMITER) {
+			break;
+		}
+	}
+	basicLength = destCPCount = j;
+
+	/*
+	 * Decode into UTF-32 first: insertions are by code point index,
+	 * and each input character yields at most one code point.
+	 */
+	UChar32 cpStackBuffer[64];
+	UChar32 *cpBuffer = cpStackBuffer;
+	if (srcLength > UPRV_LENGTHOF(cpStackBuffer)) {
+		cpBuffer = (UChar32*) uprv_malloc(srcLength * sizeof(UChar32));
+		if (cpBuffer == NULL) {
+			*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+			return 0;
+		}
+	}
+
+	while (j > 0) {
+		b = src[--j];
+		if (!IS_BASIC((uint8_t) b)) {
+			*pErrorCode = U_INVALID_CHAR_FOUND;
+			break;
+		}
+		cpBuffer[j] = (uint8_t) b;
+	}
+
+	/* Initialize the state: */
+	n = INITIAL_N;
+	i = 0;
+	bias = INITIAL_BIAS;
+
+	/* Main decoding loop, same as for UTF-16 output: */
+	for (in = basicLength > 0 ? basicLength + 1 : 0; in < srcLength && U_SUCCESS(*pErrorCode); /* no op */) {
+		for (oldi = i, w = 1, k = BASE; /* no condition */; k += BASE) {
+			if (in >= srcLength) {
+				*pErrorCode = U_ILLEGAL_CHAR_FOUND;
+				break;
+			}
+
+			digit = decodeDigit((uint8_t) src[in++]);
+			if (digit < 0) {
+				*pErrorCode = U_INVALID_CHAR_FOUND;
+				break;
+			}
+			if (digit > (0x7fffffff - i) / w) {
+				/* integer overflow */
+				*pErrorCode = U_ILLEGAL_CHAR_FOUND;
+				break;
+			}
+
+			i += digit * w;
+			t = k - bias;
+			if (t < TMIN) {
+				t = TMIN;
+			} else if (k >= (bias + TMAX)) {
+				t = TMAX;
+			}
+			if (digit < t) {
+				break;
+			}
+
+			if (w > 0x7fffffff / (BASE - t)) {
+				/* integer overflow */
+				*pErrorCode = U_ILLEGAL_CHAR_FOUND;
+				break;
+			}
+			w *= BASE - t;
+		}
+		if (U_FAILURE(*pErrorCode)) {
+			break;
+		}
+
+		++destCPCount;
+		bias = adaptBias(i - oldi, destCPCount, (UBool) (oldi == 0));
+
+		if (i / destCPCount > (0x7fffffff - n)) {
+			/* integer overflow */
+			*pErrorCode = U_ILLEGAL_CHAR_FOUND;
+			break;
+		}
+
+		n += i / destCPCount;
+		i %= destCPCount;
+
+		if (n > 0x10ffff || U_IS_SURROGATE(n)) {
+			/* Unicode code point overflow */
+			*pErrorCode = U_ILLEGAL_CHAR_FOUND;
+			break;
+		}
+
+		/* Insert n at position i of the output: */
+		if (i < destCPCount - 1) {
+			::memmove(cpBuffer + i + 1, cpBuffer + i, (destCPCount - 1 - i) * sizeof(UChar32));
+		}
+		cpBuffer[i++] = n;
+	}
+
+	/* Write the code points as UTF-8, preflighting when dest is too short. */
+	destLength = 0;
+	if (U_SUCCESS(*pErrorCode)) {
+		for (j = 0; j < destCPCount; ++j) {
+			UChar32 c = cpBuffer[j];
+			int32_t cpLength = U8_LENGTH(c);
+			if ((destLength + cpLength) <= destCapacity) {
+				U8_APPEND_UNSAFE(dest, destLength, c);
+			} else {
+				destLength += cpLength;
+			}
+		}
+	}
+	if (cpBuffer != cpStackBuffer) {
+		uprv_free(cpBuffer);
+	}
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	return u_terminateChars(dest, destCapacity, destLength, pErrorCode);
+}
+
 static inline UBool isMatchAtCPBoundary(const UChar *start, const UChar *match, const UChar *matchLimit, const UChar *limit) {
 	if (U16_IS_TRAIL(*match) && start != match && U16_IS_LEAD(*(match - 1))) {
 		/* the leading edge of the match is in the middle of a surrogate pair */
@@ -740,7 +1110,10 @@ static const int32_t zeroMem[] = {0, 0, 0, 0, 0, 0};
 
 void * uprv_malloc(size_t s) {
 	if (s > 0) {
-		return ::malloc(s);
+		if (void *p = CallArena::allocate(s)) {
+			return p;
+		}
+		return heapMalloc(s);
 	} else {
 		return (void *)zeroMem;
 	}
@@ -749,17 +1122,19 @@ void * uprv_malloc(size_t s) {
 void * uprv_realloc(void * buffer, size_t size) {
 	if (buffer == zeroMem) {
 		return uprv_malloc(size);
+	} else if (CallArena::contains(buffer)) {
+		return size == 0 ? (void *)zeroMem : CallArena::reallocate(buffer, size);
 	} else if (size == 0) {
-		::free(buffer);
+		heapFree(buffer);
 		return (void *)zeroMem;
 	} else {
-		return ::realloc(buffer, size);
+		return heapRealloc(buffer, size);
 	}
 }
 
 void uprv_free(void *buffer) {
-	if (buffer != zeroMem) {
-		::free(buffer);
+	if (buffer != zeroMem && !CallArena::contains(buffer)) {
+		heapFree(buffer);
 	}
 }
 
@@ -1415,6 +1415,17 @@ CheckedArrayByteSink& CheckedArrayByteSink::Reset() {
 	return *this;
 }
 
+CheckedArrayByteSink& CheckedArrayByteSink::Truncate(int32_t length) {
+	if (length >= 0 && length < appended_) {
+		appended_ = length;
+		if (size_ > length) {
+			size_ = length;
+		}
+		overflowed_ = size_ < appended_;
+	}
+	return *this;
+}
+
 void CheckedArrayByteSink::Append(const char *bytes, int32_t n) {
 	if (n <= 0) {
 		return;
@@ -1452,4 +1463,134 @@ char* CheckedArrayByteSink::GetAppendBuffer(int32_t min_capacity, int32_t /*desi
 	}
 }
 
+CharString &CharString::truncate(int32_t newLength) {
+	if (newLength < 0) {
+		newLength = 0;
+	}
+	if (newLength < len) {
+		buffer[len = newLength] = 0;
+	}
+	return *this;
+}
+
+CharString &CharString::append(const char *s, int32_t sLength, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return *this;
+	}
+	if (sLength < -1 || (s == NULL && sLength != 0)) {
+		errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return *this;
+	}
+	if (sLength < 0) {
+		sLength = static_cast<int32_t>(uprv_strlen(s));
+	}
+	if (sLength > 0) {
+		if (s == (buffer + len)) {
+			// The caller wrote into the getAppendBuffer().
+			if (sLength >= (capacity + 1 - len)) {
+				// The caller wrote too much.
+				errorCode = U_INTERNAL_PROGRAM_ERROR;
+			} else {
+				buffer[len += sLength] = 0;
+			}
+		} else if (buffer <= s && s < (buffer + len) && sLength >= (capacity - len)) {
+			// (Part of) this string is appended to itself which requires reallocation,
+			// so we have to make a copy of the substring and append that.
+			return append(CharString().append(s, sLength, errorCode), errorCode);
+		} else if (ensureCapacity(len + sLength, 0, errorCode)) {
+			::memcpy(buffer + len, s, sLength);
+			buffer[len += sLength] = 0;
+		}
+	}
+	return *this;
+}
+
+CharString &CharString::replace(int32_t start, int32_t length, const char *s, int32_t sLength, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return *this;
+	}
+	if (start < 0 || length < 0 || start > len || length > (len - start) || sLength < 0 || (s == NULL && sLength != 0)) {
+		errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return *this;
+	}
+	int32_t newLength = len - length + sLength;
+	if (!ensureCapacity(newLength, 0, errorCode)) {
+		return *this;
+	}
+	if (sLength != length) {
+		::memmove(buffer + start + sLength, buffer + start + length, len - start - length);
+	}
+	if (sLength > 0) {
+		::memcpy(buffer + start, s, sLength);
+	}
+	buffer[len = newLength] = 0;
+	return *this;
+}
+
+char *CharString::getAppendBuffer(int32_t minCapacity, int32_t desiredCapacityHint, int32_t &resultCapacity, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		resultCapacity = 0;
+		return NULL;
+	}
+	int32_t appendCapacity = capacity - len;  // -1 for NUL is already excluded from capacity
+	if (appendCapacity >= minCapacity) {
+		resultCapacity = appendCapacity;
+		return buffer + len;
+	}
+	if (ensureCapacity(len + minCapacity, len + desiredCapacityHint, errorCode)) {
+		resultCapacity = capacity - len;
+		return buffer + len;
+	}
+	resultCapacity = 0;
+	return NULL;
+}
+
+UBool CharString::ensureCapacity(int32_t newCapacity, int32_t desiredCapacityHint, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return false;
+	}
+	if (newCapacity <= capacity) {
+		return true;
+	}
+	if (desiredCapacityHint < newCapacity) {
+		desiredCapacityHint = newCapacity + capacity;
+	}
+	char *newBuffer = (char*) uprv_malloc(desiredCapacityHint + 1);
+	if (newBuffer == NULL) {
+		desiredCapacityHint = newCapacity;
+		newBuffer = (char*) uprv_malloc(desiredCapacityHint + 1);
+		if (newBuffer == NULL) {
+			errorCode = U_MEMORY_ALLOCATION_ERROR;
+			return false;
+		}
+	}
+	::memcpy(newBuffer, buffer, len + 1);
+	if (buffer != stackBuffer) {
+		uprv_free(buffer);
+	}
+	buffer = newBuffer;
+	capacity = desiredCapacityHint;
+	return true;
+}
+
+char* CharStringByteSink::GetAppendBuffer(int32_t min_capacity, int32_t desired_capacity_hint, char *scratch, int32_t scratch_capacity, int32_t *result_capacity) {
+	if (min_capacity < 1 || scratch_capacity < min_capacity) {
+		*result_capacity = 0;
+		return NULL;
+	}
+	if (U_FAILURE(errorCode_)) {
+		// Just return the scratch buffer.
+		*result_capacity = scratch_capacity;
+		return scratch;
+	}
+	int32_t resultCapacity;
+	char *result = dest_->getAppendBuffer(min_capacity, desired_capacity_hint, resultCapacity, errorCode_);
+	if (U_SUCCESS(errorCode_)) {
+		*result_capacity = resultCapacity;
+		return result;
+	}
+	*result_capacity = scratch_capacity;
+	return scratch;
+}
+
 }
@@ -155,6 +155,8 @@ public:
 	CheckedArrayByteSink(char *outbuf, int32_t capacity);
 	virtual ~CheckedArrayByteSink();
 	virtual CheckedArrayByteSink& Reset();
+	// Drops everything appended after the first length bytes.
+	CheckedArrayByteSink& Truncate(int32_t length);
 	virtual void Append(const char *bytes, int32_t n) override;
 	virtual char* GetAppendBuffer(int32_t min_capacity, int32_t desired_capacity_hint, char *scratch, int32_t scratch_capacity, int32_t *result_capacity) override;
 
@@ -201,6 +203,82 @@ private:
 	StringByteSink& operator=(const StringByteSink&) = delete;
 };
 
+/**
+ * Growable byte buffer for UTF-8 processing, NUL-terminated at all times.
+ * Short strings (most domain names) stay in the internal stack buffer.
+ */
+class CharString {
+public:
+	CharString() : buffer(stackBuffer), capacity(STACK_CAPACITY), len(0) { buffer[0] = 0; }
+	~CharString() {
+		if (buffer != stackBuffer) {
+			uprv_free(buffer);
+		}
+	}
+
+	UBool isEmpty() const { return len == 0; }
+	int32_t length() const { return len; }
+	char operator[](int32_t index) const { return buffer[index]; }
+	StringPiece toStringPiece() const { return StringPiece(buffer, len); }
+
+	const char *data() const { return buffer; }
+	char *data() { return buffer; }
+
+	CharString &clear() { len = 0; buffer[0] = 0; return *this; }
+	CharString &truncate(int32_t newLength);
+
+	CharString &append(char c, UErrorCode &errorCode) { return append(&c, 1, errorCode); }
+	CharString &append(StringPiece s, UErrorCode &errorCode) { return append(s.data(), s.length(), errorCode); }
+	CharString &append(const CharString &s, UErrorCode &errorCode) { return append(s.data(), s.length(), errorCode); }
+	CharString &append(const char *s, int32_t sLength, UErrorCode &errorCode);
+
+	/**
+	 * Replaces length bytes at start with the sLength bytes of s.
+	 * s must not point into this string.
+	 */
+	CharString &replace(int32_t start, int32_t length, const char *s, int32_t sLength, UErrorCode &errorCode);
+
+	/**
+	 * Returns a writable buffer for appending and writes its capacity to
+	 * resultCapacity. Guarantees resultCapacity>=minCapacity if U_SUCCESS().
+	 * There will additionally be space for a terminating NUL right at resultCapacity.
+	 * Call append(buffer, length) with the returned buffer to commit the bytes.
+	 */
+	char *getAppendBuffer(int32_t minCapacity, int32_t desiredCapacityHint, int32_t &resultCapacity, UErrorCode &errorCode);
+
+private:
+	enum { STACK_CAPACITY = 256 };
+
+	UBool ensureCapacity(int32_t newCapacity, int32_t desiredCapacityHint, UErrorCode &errorCode);
+
+	char *buffer;
+	int32_t capacity;  // excluding the terminating NUL
+	int32_t len;
+	char stackBuffer[STACK_CAPACITY + 1];
+
+	CharString(const CharString&) = delete;
+	CharString& operator=(const CharString&) = delete;
+};
+
+class CharStringByteSink: public ByteSink {
+public:
+	CharStringByteSink(CharString *dest, UErrorCode &errorCode) : dest_(dest), errorCode_(errorCode) { }
+
+	virtual void Append(const char *bytes, int32_t n) override {
+		dest_->append(bytes, n, errorCode_);
+	}
+
+	virtual char* GetAppendBuffer(int32_t min_capacity, int32_t desired_capacity_hint, char *scratch, int32_t scratch_capacity, int32_t *result_capacity) override;
+
+private:
+	CharString *dest_;
+	UErrorCode &errorCode_;
+
+	CharStringByteSink() = delete;
+	CharStringByteSink(const CharStringByteSink&) = delete;
+	CharStringByteSink& operator=(const CharStringByteSink&) = delete;
+};
+
 class UnicodeString {
 public:
 	virtual ~UnicodeString();
@@ -17,6 +17,14 @@
 #include "u_macro.h"
 #include "u_char.h"
 #include "u_uts46.h"
+#include "u_ascii.h"
+#include "u_cache.h"
+#include "u_arena.h"
+#include "u_idnaprops.h"
+
+#ifdef UIDNA_VERIFY_TRUSTED_NFC
+#include <assert.h>
+#endif
 
 namespace uidna {
 
@@ -28,28 +36,125 @@ const uint32_t severeErrors =
 		UIDNA_ERROR_LABEL_HAS_DOT |
 		UIDNA_ERROR_INVALID_ACE_LABEL;
 
-static inline UBool isASCIIString(const UnicodeString &dest) {
-	const UChar *s = dest.getBuffer();
-	const UChar *limit = s + dest.length();
-	while (s < limit) {
-		if (*s++ > 0x7f) {
-			return false;
-		}
+// Result cache of whole names (uidna_setCache()).
+// Longer inputs are not cached, they are not host names worth remembering.
+static constexpr int32_t NameCacheMaxKeyLength = 1024;
+static constexpr uint32_t NameCacheTransDiff = 1;
+
+// Memo of processLabel() results for labels with Punycode or non-ASCII (uidna_setLabelCache()).
+static constexpr int32_t LabelCacheMaxKeyLength = 256;
+static constexpr uint32_t LabelCacheBiDi = 1;
+static constexpr uint32_t LabelCacheNotOkBiDi = 2;
+
+static inline int32_t countNonASCII(const UChar *s, int32_t length) {
+	int32_t count = 0;
+	for (int32_t i = 0; i < length; ++i) {
+		count += s[i] > 0x7f;
 	}
-	return true;
+	return count;
+}
+
+static inline int32_t countNonASCII(const char *s, int32_t length) {
+	int32_t count = 0;
+	for (int32_t i = 0; i < length; ++i) {
+		count += (int8_t) s[i] < 0;
+	}
+	return count;
+}
+
+static inline int32_t countNonASCII(const UnicodeString &s) {
+	return countNonASCII(s.getBuffer(), s.length());
+}
+
+static inline int32_t countNonASCII(const CharString &s) {
+	return countNonASCII(s.data(), s.length());
+}
+
+static inline void appendSubstring(UnicodeString &dest, const UnicodeString &src, int32_t start, int32_t length, UErrorCode &errorCode) {
+	dest.append(src, start, length);
+	if (dest.isBogus()) {
+		errorCode = U_MEMORY_ALLOCATION_ERROR;
+	}
+}
+
+static inline void appendSubstring(CharString &dest, const CharString &src, int32_t start, int32_t length, UErrorCode &errorCode) {
+	dest.append(src.data() + start, length, errorCode);
 }
 
-static UBool
-isASCIIOkBiDi(const UChar *s, int32_t length);
+// Discards the result, for validation only.
+// The default GetAppendBuffer() hands out the caller's scratch buffer.
+class DiscardByteSink : public ByteSink {
+public:
+	virtual void Append(const char * /*bytes*/, int32_t /*n*/) override { }
+};
 
-static UBool
-isASCIIOkBiDi(const char *s, int32_t length);
+// IDNA2008 BiDi rule, parts relevant to the all-LTR labels of the ASCII fastpath:
+// 1. The first character must be a character with BIDI property L [...]
+// 5. In an LTR label, only characters with the BIDI properties L, EN,
+// ES, CS, ET, ON, BN and NSM are allowed.
+// 6. In an LTR label, the end of the label must be a character with
+// BIDI property L or EN [...]
+// Called once per completed label, can contain uppercase A-Z.
+// With STD3 rules, B, S and WS characters stop the fastpath, so only the ends need checking.
+template <typename Char>
+static UBool isASCIILabelOkBiDi(const Char *s, int32_t length, UBool checkInterior) {
+	if (length == 0) {
+		return true;
+	}
+	uint32_t c = (uint16_t) s[0] | 0x20;  // lowercase
+	if (!(0x61 <= c && c <= 0x7a)) {
+		// First character in the label is not an L.
+		return false;
+	}
+	c = (uint16_t) s[length - 1];
+	if (!(0x61 <= (c | 0x20) && (c | 0x20) <= 0x7a) && !(0x30 <= c && c <= 0x39)) {
+		// Last character in the label is not an L or EN.
+		return false;
+	}
+	if (checkInterior) {
+		for (int32_t i = 1; i < length - 1; ++i) {
+			c = (uint16_t) s[i];
+			if (c <= 0x20 && (c >= 0x1c || (9 <= c && c <= 0xd))) {
+				// Intermediate character in the label is a B, S or WS.
+				return false;
+			}
+		}
+	}
+	return true;
+}
 
 UTS46::UTS46(uint32_t opt, UErrorCode &errorCode)
 // : uts46Norm2(*Normalizer2::getInstance(UNORM2_COMPOSE, errorCode)), options(opt) { }
-: uts46Norm2(ComposeNormalizer2::getInstance()), options(opt) { }
+: uts46Norm2(ComposeNormalizer2::getInstance()), options(opt), cache(NULL), labelCache(NULL), callArenaSize(0),
+  failFastErrors((opt & UIDNA_FAIL_FAST) != 0 ? 0xffffffff : 0) {
+	engines[0] = getEngine<false>(opt);
+	engines[1] = getEngine<true>(opt);
+}
+
+UTS46::~UTS46() {
+	delete cache;
+	delete labelCache;
+}
+
+void UTS46::setCache(IDNACache *newCache) {
+	delete cache;
+	cache = newCache;
+}
+
+void UTS46::setLabelCache(IDNACache *newCache) {
+	delete labelCache;
+	labelCache = newCache;
+}
+
+void UTS46::setFailFastErrors(uint32_t errors) {
+	if ((options & UIDNA_FAIL_FAST) != 0) {
+		failFastErrors = errors;
+	}
+}
 
-UTS46::~UTS46() { }
+UBool UTS46::hasFailFastError(const IDNAInfo &info) const {
+	return (info.errors & failFastErrors) != 0;
+}
 
 UnicodeString& UTS46::labelToASCII(const UnicodeString &label, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const {
 	return process(label, true, true, dest, info, errorCode);
@@ -62,8 +167,8 @@ UnicodeString& UTS46::labelToUnicode(const UnicodeString &label, UnicodeString &
 UnicodeString&
 UTS46::nameToASCII(const UnicodeString &name, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const {
 	process(name, false, true, dest, info, errorCode);
-	if (dest.length() >= 254 && (info.errors & UIDNA_ERROR_DOMAIN_NAME_TOO_LONG) == 0 && isASCIIString(dest) && (dest.length() > 254 || dest[253] != 0x2e)) {
-		info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
+	if ((info.errors & (UIDNA_ERROR_DOMAIN_NAME_TOO_LONG | info.stopErrors)) == 0) {
+		checkDomainNameLength(0, dest, info);
 	}
 	return dest;
 }
@@ -88,6 +193,42 @@ void UTS46::nameToUnicodeUTF8(StringPiece name, ByteSink &dest, IDNAInfo &info,
 	processUTF8(name, false, false, dest, info, errorCode);
 }
 
+void UTS46::checkName(const UnicodeString &name, UBool stopOnError, IDNAInfo &info, UErrorCode &errorCode) const {
+	// dest is still the working buffer, but valid non-ASCII labels are not converted to Punycode.
+	UnicodeString dest;
+	info.checkOnly = true;
+	info.stopErrors = stopOnError ? 0xffffffff : failFastErrors;
+	process(name, false, true, dest, info, errorCode);
+	if ((info.errors & (UIDNA_ERROR_DOMAIN_NAME_TOO_LONG | info.stopErrors)) == 0) {
+		checkDomainNameLength(0, dest, info);
+	}
+}
+
+void UTS46::checkNameUTF8(StringPiece name, UBool stopOnError, IDNAInfo &info, UErrorCode &errorCode) const {
+	DiscardByteSink sink;
+	info.checkOnly = true;
+	info.stopErrors = stopOnError ? 0xffffffff : failFastErrors;
+	processUTF8(name, false, true, sink, info, errorCode);
+}
+
+// dest is the result after prefixLength ASCII units. Labels that were only checked
+// left all of the skippedNonASCII units in dest, and their Punycode adds skippedLengthDelta units.
+template <typename String>
+void UTS46::checkDomainNameLength(int32_t prefixLength, const String &dest, IDNAInfo &info) {
+	// A result of 254 units is ok if it ends with a trailing dot.
+	int32_t length = prefixLength + dest.length() + info.skippedLengthDelta;
+	if (length >= 254 && countNonASCII(dest) == info.skippedNonASCII
+			&& (length > 254 || (dest.length() > 0 && dest[dest.length() - 1] != 0x2e))) {
+		info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
+	}
+}
+
+void UTS46::checkBiDiName(IDNAInfo &info, UErrorCode &errorCode) {
+	if (info.isBiDi && U_SUCCESS(errorCode) && (info.errors & severeErrors) == 0 && !info.isOkBiDi) {
+		info.errors |= UIDNA_ERROR_BIDI;
+	}
+}
+
 static const int8_t asciiData[128]={
 	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
 	-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
@@ -103,7 +244,204 @@ static const int8_t asciiData[128]={
 	 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, -1, -1, -1, -1, -1
 };
 
+template <uint32_t Options, bool ToASCII, typename Char>
+UBool UTS46::processASCII(const Char *srcArray, int32_t srcLength, int32_t start, int32_t limit, Char *destArray,
+		UBool isLabel, int32_t &i, int32_t &labelStart, IDNAInfo &info) const {
+	// Lowercasing and classification run on blocks of ASCIIBlockSize units;
+	// only hyphens and dots are looked at one by one.
+	const ASCIIBlockKernel &kernel = getASCIIBlockKernel();
+	UBool disallowNonLDHDot = hasOption<Options>(UIDNA_USE_STD3_RULES);
+	destArray -= start;  // indexed like srcArray from here on
+	for (i = start; i < limit;) {
+		int32_t blockLength = limit - i;
+		ASCIIBlockMasks masks;
+		if (blockLength >= ASCIIBlockSize) {
+			blockLength = ASCIIBlockSize;
+			masks = processASCIIBlock(kernel, srcArray + i, destArray + i, disallowNonLDHDot);
+		} else if (kernel.type == ASCIIKernelType::Scalar) {
+			masks = processASCIIUnits(srcArray + i, destArray + i, blockLength, disallowNonLDHDot);
+		} else {
+			// Pad the tail with a letter, which is neither a stop nor a special unit.
+			Char srcBlock[ASCIIBlockSize], destBlock[ASCIIBlockSize];
+			memcpy(srcBlock, srcArray + i, blockLength * sizeof(Char));
+			for (int32_t j = blockLength; j < ASCIIBlockSize; ++j) {
+				srcBlock[j] = 0x61;
+			}
+			masks = processASCIIBlock(kernel, srcBlock, destBlock, disallowNonLDHDot);
+			memcpy(destArray + i, destBlock, blockLength * sizeof(Char));
+		}
+		uint32_t special = masks.special;
+		if (masks.stop != 0) {
+			special &= (masks.stop & (0 - masks.stop)) - 1;  // only before the first stop unit
+		}
+		while (special != 0) {
+			int32_t j = i + countTrailingZeros(special);
+			special &= special - 1;
+			if (srcArray[j] == 0x2d) {  // hyphen
+				if (j == (labelStart + 3) && srcArray[j - 1] == 0x2d) {
+					// "??--..." is Punycode or forbidden.
+					i = j + 1;  // '-' was copied to dest already
+					return false;
+				}
+				if (j == labelStart) {
+					// label starts with "-"
+					info.labelErrors |= UIDNA_ERROR_LEADING_HYPHEN;
+				}
+				if ((j + 1) == srcLength || srcArray[j + 1] == 0x2e) {
+					// label ends with "-"
+					info.labelErrors |= UIDNA_ERROR_TRAILING_HYPHEN;
+				}
+				if ((info.labelErrors & info.stopErrors) != 0) {
+					// Fail fast: done, with an incomplete result that the caller discards.
+					info.errors |= info.labelErrors;
+					i = j + 1;
+					return true;
+				}
+			} else {  // dot
+				if (isLabel) {
+					// Replacing with U+FFFD can be complicated for toASCII.
+					i = j + 1;  // '.' was copied to dest already
+					return false;
+				}
+				if (j == labelStart) {
+					info.labelErrors |= UIDNA_ERROR_EMPTY_LABEL;
+				}
+				if (ToASCII && (j - labelStart) > 63) {
+					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
+				}
+				// Keep the BiDi state of the name up to date, for when a later label turns out to be RTL.
+				if (hasOption<Options>(UIDNA_CHECK_BIDI) && info.isOkBiDi
+						&& !isASCIILabelOkBiDi(srcArray + labelStart, j - labelStart, !disallowNonLDHDot)) {
+					info.isOkBiDi = false;
+				}
+				info.errors |= info.labelErrors;
+				info.labelErrors = 0;
+				labelStart = j + 1;
+				if ((info.errors & info.stopErrors) != 0) {
+					// Fail fast, see above.
+					i = j + 1;
+					return true;
+				}
+			}
+		}
+		if (masks.stop != 0) {
+			// Non-ASCII, or disallowed with STD3 rules:
+			// replacing with U+FFFD can be complicated for toASCII.
+			i += countTrailingZeros(masks.stop);
+			return false;
+		}
+		i += blockLength;
+	}
+	if (limit < srcLength) {
+		return true;
+	}
+	if (ToASCII) {
+		if ((i - labelStart) > 63) {
+			info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
+		}
+		// There is a trailing dot if labelStart==i.
+		if (!isLabel && i >= 254 && (i > 254 || labelStart < i)) {
+			info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
+		}
+	}
+	info.errors |= info.labelErrors;
+	return true;
+}
+
+UBool UTS46::isCanonicalASCIIName(StringPiece name) const {
+	// The checks of the ASCII fastpath, for input that it would copy unchanged:
+	// a single scan without output, as most names are shorter than a kernel block.
+	// Longer names are always too long, except 254 bytes with a trailing dot.
+	const char *srcArray = name.data();
+	int32_t srcLength = name.length();
+	if (srcArray == NULL || srcLength == 0 || srcLength > 254) {
+		return false;
+	}
+	UBool disallowNonLDHDot = (options & UIDNA_USE_STD3_RULES) != 0;
+	int32_t labelStart = 0;
+	for (int32_t i = 0; i < srcLength; ++i) {
+		uint32_t c = (uint8_t) srcArray[i];
+		if (c == 0x2e) {
+			if (i == labelStart || (i - labelStart) > 63) {
+				return false;
+			}
+			labelStart = i + 1;
+		} else if (c == 0x2d) {
+			// Leading or trailing hyphen, or "??--" which is Punycode or forbidden.
+			if (i == labelStart || (i + 1) == srcLength || srcArray[i + 1] == 0x2e || (i == labelStart + 3 && srcArray[i - 1] == 0x2d)) {
+				return false;
+			}
+		} else if (c > 0x7f || (c - 0x41) <= 25 || (disallowNonLDHDot && (c - 0x30) > 9 && (c - 0x61) > 25)) {
+			return false;  // non-ASCII, uppercase, or disallowed with STD3 rules
+		}
+	}
+	// There is a trailing dot if labelStart==srcLength.
+	return (srcLength - labelStart) <= 63 && (srcLength < 254 || labelStart == srcLength);
+}
+
+struct UTS46::Engine {
+	UnicodeString& (UTS46::*process)(const UnicodeString &src, UBool isLabel, UnicodeString &dest, IDNAInfo &info,
+			UnicodeString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const;
+	void (UTS46::*processUTF8)(StringPiece src, UBool isLabel, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
+	void (UTS46::*processDualUTF8)(StringPiece src, CharString &dest, IDNAInfo &info, CharString &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const;
+	void (UTS46::*processBothUTF8)(StringPiece src, CharString &asciiDest, IDNAInfo &asciiInfo,
+			CharString &unicodeDest, IDNAInfo &unicodeInfo, UErrorCode &errorCode) const;
+};
+
+template <uint32_t Options, bool ToASCII>
+const UTS46::Engine *UTS46::makeEngine() {
+	static const Engine engine = {
+		&UTS46::process<Options, ToASCII>, &UTS46::processUTF8Uncached<Options, ToASCII>, &UTS46::processDualUTF8<Options, ToASCII>,
+		&UTS46::processBothUTF8<Options>
+	};
+	return &engine;
+}
+
+// Option sets with a specialized engine, as seen by one direction: only its own NONTRANSITIONAL option
+// matters, so both are set if it is set (see getEngine()).
+static constexpr uint32_t EngineNonTransitional = UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE;
+// IDNA2008 checks, the default of the idn2 functions in u_idn2.cc
+static constexpr uint32_t EngineIDNA2008 = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO;
+// Checks recommended by UTS #46, the default of uidna-conv
+static constexpr uint32_t EngineUTS46 = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ;
+
+template <bool ToASCII>
+const UTS46::Engine *UTS46::getEngine(uint32_t options) {
+	uint32_t nonTransitional = options & (ToASCII ? UIDNA_NONTRANSITIONAL_TO_ASCII : UIDNA_NONTRANSITIONAL_TO_UNICODE);
+	// UIDNA_TRUSTED_NFC_INPUT and UIDNA_FAIL_FAST are tested at runtime, they do not need engines of their own.
+	switch ((options & ~(EngineNonTransitional | UIDNA_TRUSTED_NFC_INPUT | UIDNA_FAIL_FAST)) | (nonTransitional != 0 ? EngineNonTransitional : 0)) {
+	case EngineIDNA2008:
+		return makeEngine<EngineIDNA2008, ToASCII>();
+	case EngineIDNA2008 | UIDNA_USE_STD3_RULES:
+		return makeEngine<EngineIDNA2008 | UIDNA_USE_STD3_RULES, ToASCII>();
+	case EngineIDNA2008 | EngineNonTransitional:
+		return makeEngine<EngineIDNA2008 | EngineNonTransitional, ToASCII>();
+	case EngineIDNA2008 | EngineNonTransitional | UIDNA_USE_STD3_RULES:
+		return makeEngine<EngineIDNA2008 | EngineNonTransitional | UIDNA_USE_STD3_RULES, ToASCII>();
+	case EngineUTS46 | EngineNonTransitional:
+		return makeEngine<EngineUTS46 | EngineNonTransitional, ToASCII>();
+	case EngineUTS46 | EngineNonTransitional | UIDNA_USE_STD3_RULES:
+		return makeEngine<EngineUTS46 | EngineNonTransitional | UIDNA_USE_STD3_RULES, ToASCII>();
+	default:
+		return makeEngine<GenericOptions, ToASCII>();
+	}
+}
+
 UnicodeString& UTS46::process(const UnicodeString &src, UBool isLabel, UBool toASCII, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const {
+	if (info.checkOnly) {
+		return (this->*engines[toASCII ? 1 : 0]->process)(src, isLabel, dest, info, NULL, NULL, errorCode);
+	}
+	info.stopErrors = failFastErrors;
+	(this->*engines[toASCII ? 1 : 0]->process)(src, isLabel, dest, info, NULL, NULL, errorCode);
+	if ((info.errors & info.stopErrors) != 0) {
+		dest.remove();  // incomplete
+	}
+	return dest;
+}
+
+template <uint32_t Options, bool ToASCII>
+UnicodeString& UTS46::process(const UnicodeString &src, UBool isLabel, UnicodeString &dest, IDNAInfo &info,
+		UnicodeString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const {
 	// uts46Norm2.normalize() would do all of this error checking and setup,
 	// but with the ASCII fastpath we do not always call it, and do not
 	// call it first.
@@ -131,77 +469,123 @@ UnicodeString& UTS46::process(const UnicodeString &src, UBool isLabel, UBool toA
 		return dest;
 	}
 	// ASCII fastpath
-	UBool disallowNonLDHDot = (options & UIDNA_USE_STD3_RULES) != 0;
 	int32_t labelStart = 0;
 	int32_t i;
-	for (i = 0;; ++i) {
-		if (i == srcLength) {
-			if (toASCII) {
-				if ((i - labelStart) > 63) {
-					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
-				}
-				// There is a trailing dot if labelStart==i.
-				if (!isLabel && i >= 254 && (i > 254 || labelStart < i)) {
-					info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
-				}
-			}
-			info.errors |= info.labelErrors;
-			dest.releaseBuffer(i);
-			return dest;
-		}
-		UChar c = srcArray[i];
-		if (c > 0x7f) {
-			break;
-		}
-		int cData = asciiData[c];
-		if (cData > 0) {
-			destArray[i] = c + 0x20;  // Lowercase an uppercase ASCII letter.
-		} else if (cData < 0 && disallowNonLDHDot) {
-			break;  // Replacing with U+FFFD can be complicated for toASCII.
-		} else {
-			destArray[i] = c;
-			if (c == 0x2d) {  // hyphen
-				if (i == (labelStart + 3) && srcArray[i - 1] == 0x2d) {
-					// "??--..." is Punycode or forbidden.
-					++i;  // '-' was copied to dest already
-					break;
-				}
-				if (i == labelStart) {
-					// label starts with "-"
-					info.labelErrors |= UIDNA_ERROR_LEADING_HYPHEN;
-				}
-				if ((i + 1) == srcLength || srcArray[i + 1] == 0x2e) {
-					// label ends with "-"
-					info.labelErrors |= UIDNA_ERROR_TRAILING_HYPHEN;
-				}
-			} else if (c == 0x2e) {  // dot
-				if (isLabel) {
-					// Replacing with U+FFFD can be complicated for toASCII.
-					++i;  // '.' was copied to dest already
-					break;
-				}
-				if (i == labelStart) {
-					info.labelErrors |= UIDNA_ERROR_EMPTY_LABEL;
-				}
-				if (toASCII && (i - labelStart) > 63) {
-					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
-				}
-				info.errors |= info.labelErrors;
-				info.labelErrors = 0;
-				labelStart = i + 1;
-			}
-		}
+	if (processASCII<Options, ToASCII>(srcArray, srcLength, 0, srcLength, destArray, isLabel, i, labelStart, info)) {
+		dest.releaseBuffer(i);
+		return dest;
 	}
 	info.errors |= info.labelErrors;
 	dest.releaseBuffer(i);
-	processUnicode(src, labelStart, i, isLabel, toASCII, dest, info, errorCode);
-	if (info.isBiDi && U_SUCCESS(errorCode) && (info.errors & severeErrors) == 0 && (!info.isOkBiDi || (labelStart > 0 && !isASCIIOkBiDi(dest.getBuffer(), labelStart)))) {
-		info.errors |= UIDNA_ERROR_BIDI;
+	if ((info.errors & info.stopErrors) != 0) {
+		return dest;
+	}
+	processUnicode<Options, ToASCII>(src, labelStart, i, isLabel, dest, info, transDest, transInfo, errorCode);
+	if ((info.errors & info.stopErrors) != 0) {
+		return dest;
+	}
+	checkBiDiName(info, errorCode);
+	if (transDest != NULL && info.isTransDiff) {
+		checkBiDiName(*transInfo, errorCode);
 	}
 	return dest;
 }
 
 void UTS46::processUTF8(StringPiece src, UBool isLabel, UBool toASCII, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const {
+	if (!info.checkOnly) {
+		info.stopErrors = failFastErrors;
+	}
+	if (cache == NULL || U_FAILURE(errorCode) || src.data() == NULL || src.length() == 0 || src.length() > NameCacheMaxKeyLength) {
+		processUTF8Uncached(src, isLabel, toASCII, dest, info, errorCode);
+		return;
+	}
+	uint32_t operation = (options << 2) | (isLabel ? 2 : 0) | (toASCII ? 1 : 0);
+	uint32_t errors, flags;
+	if (cache->find(operation, src, dest, errors, flags)) {
+		info.reset();
+		info.errors = errors;
+		info.isTransDiff = (flags & NameCacheTransDiff) != 0;
+		dest.Flush();
+		return;
+	}
+	if (info.checkOnly) {
+		processUTF8Uncached(src, isLabel, toASCII, dest, info, errorCode);  // no result to cache
+		return;
+	}
+	// The result is needed in full for the cache, whatever the capacity of dest.
+	CharString result;
+	{
+		CharStringByteSink sink(&result, errorCode);
+		processUTF8Uncached(src, isLabel, toASCII, sink, info, errorCode);
+	}
+	if (U_FAILURE(errorCode) || (info.errors & info.stopErrors) != 0) {
+		return;  // an incomplete result is neither cached nor used
+	}
+	cache->insert(operation, src, result.toStringPiece(), info.errors, info.isTransDiff ? NameCacheTransDiff : 0);
+	dest.Append(result.data(), result.length());
+	dest.Flush();
+}
+
+void UTS46::processUTF8Uncached(StringPiece src, UBool isLabel, UBool toASCII, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const {
+	(this->*engines[toASCII ? 1 : 0]->processUTF8)(src, isLabel, dest, info, errorCode);
+}
+
+UnicodeString& UTS46::nameToASCIIDual(const UnicodeString &name, UnicodeString &dest, IDNAInfo &info,
+		UnicodeString &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const {
+	if (U_SUCCESS(errorCode) && (&transDest == &name || &transDest == &dest)) {
+		errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+	}
+	transDest.remove();
+	transInfo.reset();
+	// Both results use the toASCII engine: only processUnicode() looks at the NONTRANSITIONAL option,
+	// which it ignores for a dual conversion.
+	(this->*engines[1]->process)(name, false, dest, info, &transDest, &transInfo, errorCode);
+	if ((info.errors & UIDNA_ERROR_DOMAIN_NAME_TOO_LONG) == 0) {
+		checkDomainNameLength(0, dest, info);
+	}
+	if (!info.isTransDiff) {
+		transInfo.copyState(info);
+	}
+	if (info.isTransDiff && (transInfo.errors & UIDNA_ERROR_DOMAIN_NAME_TOO_LONG) == 0) {
+		checkDomainNameLength(0, transDest, transInfo);
+	}
+	return dest;
+}
+
+void UTS46::nameToASCIIDual_UTF8(StringPiece name, ByteSink &dest, IDNAInfo &info,
+		ByteSink &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const {
+	CharString destString, transString;
+	transInfo.reset();
+	(this->*engines[1]->processDualUTF8)(name, destString, info, transString, transInfo, errorCode);
+	if (!info.isTransDiff) {
+		transInfo.copyState(info);
+	}
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	dest.Append(destString.data(), destString.length());
+	dest.Flush();
+	if (info.isTransDiff) {
+		transDest.Append(transString.data(), transString.length());
+		transDest.Flush();
+	}
+}
+
+void UTS46::nameToASCIIAndUnicodeUTF8(StringPiece name, ByteSink &asciiDest, IDNAInfo &asciiInfo,
+		ByteSink &unicodeDest, IDNAInfo &unicodeInfo, UErrorCode &errorCode) const {
+	CharString asciiString, unicodeString;
+	(this->*engines[0]->processBothUTF8)(name, asciiString, asciiInfo, unicodeString, unicodeInfo, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	asciiDest.Append(asciiString.data(), asciiString.length());
+	asciiDest.Flush();
+	unicodeDest.Append(unicodeString.data(), unicodeString.length());
+	unicodeDest.Flush();
+}
+
+template <uint32_t Options, bool ToASCII>
+void UTS46::processUTF8Uncached(StringPiece src, UBool isLabel, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const {
 	if (U_FAILURE(errorCode)) {
 		return;
 	}
@@ -218,158 +602,491 @@ void UTS46::processUTF8(StringPiece src, UBool isLabel, UBool toASCII, ByteSink
 		dest.Flush();
 		return;
 	}
-	UnicodeString destString;
+	CharString destString;
+	// ASCII fastpath, streamed into dest in chunks of the sink's append buffer.
+	// The output for the current label is held back in destString until the label is complete:
+	// if the fastpath stops inside of it, the label is processed again from its start in src
+	// (lowercasing its ASCII prefix is part of the UTS #46 mapping).
+	char stackArray[256];
 	int32_t labelStart = 0;
-	if (srcLength <= 256) {  // length of stackArray[]
-		// ASCII fastpath
-		char stackArray[256];
+	int32_t i = 0;
+	for (;;) {
+		int32_t chunkStart = i;
+		int32_t minCapacity = (srcLength - chunkStart) < UPRV_LENGTHOF(stackArray) ? (srcLength - chunkStart) : UPRV_LENGTHOF(stackArray);
 		int32_t destCapacity;
-		char *destArray = dest.GetAppendBuffer(srcLength, srcLength + 20, stackArray, UPRV_LENGTHOF(stackArray), &destCapacity);
-		UBool disallowNonLDHDot = (options & UIDNA_USE_STD3_RULES) != 0;
-		int32_t i;
-		for (i = 0;; ++i) {
-			if (i == srcLength) {
-				if (toASCII) {
-					if ((i - labelStart) > 63) {
-						info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
-					}
-					// There is a trailing dot if labelStart==i.
-					if (!isLabel && i >= 254 && (i > 254 || labelStart < i)) {
-						info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
-					}
-				}
-				info.errors |= info.labelErrors;
-				dest.Append(destArray, i);
-				dest.Flush();
-				return;
-			}
-			char c = srcArray[i];
-			if ((int8_t) c < 0) {  // (uint8_t)c>0x7f
-				break;
-			}
-			int cData = asciiData[(int) c];  // Cast: gcc warns about indexing with a char.
-			if (cData > 0) {
-				destArray[i] = c + 0x20;  // Lowercase an uppercase ASCII letter.
-			} else if (cData < 0 && disallowNonLDHDot) {
-				break;  // Replacing with U+FFFD can be complicated for toASCII.
+		char *destArray = dest.GetAppendBuffer(minCapacity, srcLength - chunkStart + 20, stackArray, UPRV_LENGTHOF(stackArray), &destCapacity);
+		int32_t chunkLimit = destCapacity < (srcLength - chunkStart) ? chunkStart + destCapacity : srcLength;
+		UBool done = processASCII<Options, ToASCII>(srcArray, srcLength, chunkStart, chunkLimit, destArray, isLabel, i, labelStart, info);
+		if ((info.errors & info.stopErrors) != 0) {
+			dest.Flush();  // fail fast, the rest of the output is not needed
+			return;
+		}
+		// Output of this chunk that can go to dest now: completed labels, or everything at the end of src.
+		int32_t outputLimit = done && chunkLimit == srcLength ? chunkLimit : labelStart;
+		if (outputLimit > chunkStart) {
+			if (destString.length() > 0) {
+				// Prepend the held back start of the first label.
+				// destArray may be the sink's buffer, so it has to be appended before anything else.
+				destString.append(destArray, outputLimit - chunkStart, errorCode);
+				dest.Append(destString.data(), destString.length());
+				destString.clear();
 			} else {
-				destArray[i] = c;
-				if (c == 0x2d) {  // hyphen
-					if (i == (labelStart + 3) && srcArray[i - 1] == 0x2d) {
-						// "??--..." is Punycode or forbidden.
-						break;
-					}
-					if (i == labelStart) {
-						// label starts with "-"
-						info.labelErrors |= UIDNA_ERROR_LEADING_HYPHEN;
-					}
-					if ((i + 1) == srcLength || srcArray[i + 1] == 0x2e) {
-						// label ends with "-"
-						info.labelErrors |= UIDNA_ERROR_TRAILING_HYPHEN;
-					}
-				} else if (c == 0x2e) {  // dot
-					if (isLabel) {
-						break;  // Replacing with U+FFFD can be complicated for toASCII.
-					}
-					if (i == labelStart) {
-						info.labelErrors |= UIDNA_ERROR_EMPTY_LABEL;
-					}
-					if (toASCII && (i - labelStart) > 63) {
-						info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
-					}
-					info.errors |= info.labelErrors;
-					info.labelErrors = 0;
-					labelStart = i + 1;
-				}
+				dest.Append(destArray, outputLimit - chunkStart);
 			}
 		}
-		info.errors |= info.labelErrors;
-		// Convert the processed ASCII prefix of the current label to UTF-16.
-		int32_t mappingStart = i - labelStart;
-		destString = UnicodeString::fromUTF8(StringPiece(destArray + labelStart, mappingStart));
-		// Output the previous ASCII labels and process the rest of src in UTF-16.
-		dest.Append(destArray, labelStart);
-		processUnicode(UnicodeString::fromUTF8(StringPiece(src, labelStart)), 0, mappingStart, isLabel, toASCII, destString, info, errorCode);
-	} else {
-		// src is too long for the ASCII fastpath implementation.
-		processUnicode(UnicodeString::fromUTF8(src), 0, 0, isLabel, toASCII, destString, info, errorCode);
-	}
-	destString.toUTF8(dest);  // calls dest.Flush()
-	if (toASCII && !isLabel) {
-		// length==labelStart==254 means that there is a trailing dot (ok) and
-		// destString is empty (do not index at 253-labelStart).
-		int32_t length = labelStart + destString.length();
-		if (length >= 254 && isASCIIString(destString) && (length > 254 || (labelStart < 254 && destString[253 - labelStart] != 0x2e))) {
-			info.errors |= UIDNA_ERROR_DOMAIN_NAME_TOO_LONG;
+		if (!done) {
+			break;
+		}
+		if (chunkLimit == srcLength) {
+			dest.Flush();
+			return;
+		}
+		int32_t heldStart = labelStart > chunkStart ? labelStart : chunkStart;
+		destString.append(destArray + (heldStart - chunkStart), chunkLimit - heldStart, errorCode);
+		if (U_FAILURE(errorCode)) {
+			return;
 		}
 	}
-	if (info.isBiDi && U_SUCCESS(errorCode) && (info.errors & severeErrors) == 0 && (!info.isOkBiDi || (labelStart > 0 && !isASCIIOkBiDi(srcArray, labelStart)))) {
-		info.errors |= UIDNA_ERROR_BIDI;
+	info.errors |= info.labelErrors;
+	if ((info.errors & info.stopErrors) != 0) {
+		dest.Flush();
+		return;
+	}
+	// Process the rest of src in UTF-8, from the start of the current label.
+	destString.clear();
+	processUnicodeUTF8<Options, ToASCII>(StringPiece(srcArray + labelStart, srcLength - labelStart), isLabel, 0 == labelStart, destString, info, NULL, NULL, errorCode);
+	if ((info.errors & info.stopErrors) != 0) {
+		dest.Flush();
+		return;
 	}
+	dest.Append(destString.data(), destString.length());
+	dest.Flush();
+	if (ToASCII && !isLabel) {
+		checkDomainNameLength(labelStart, destString, info);
+	}
+	checkBiDiName(info, errorCode);
 }
 
-UnicodeString& UTS46::processUnicode(const UnicodeString &src, int32_t labelStart, int32_t mappingStart, UBool isLabel,
-		UBool toASCII, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const {
-	if (mappingStart == 0) {
-		uts46Norm2->normalize(src, dest, errorCode);
-	} else {
-		uts46Norm2->normalizeSecondAndAppend(dest, src.tempSubString(mappingStart), errorCode);
+template <uint32_t Options, bool ToASCII>
+void UTS46::processDualUTF8(StringPiece src, CharString &dest, IDNAInfo &info, CharString &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const {
+	// Like processUTF8Uncached() for a name, but into whole strings:
+	// the transitional result forks off from the part of dest before the first label with deviation characters.
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	const char *srcArray = src.data();
+	int32_t srcLength = src.length();
+	if (srcArray == NULL && srcLength != 0) {
+		errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	info.reset();
+	if (srcLength == 0) {
+		info.errors |= UIDNA_ERROR_EMPTY_LABEL;
+		return;
 	}
+	int32_t capacity;
+	char *destArray = dest.getAppendBuffer(srcLength, srcLength, capacity, errorCode);
 	if (U_FAILURE(errorCode)) {
-		return dest;
+		return;
 	}
-	UBool doMapDevChars = toASCII ? (options & UIDNA_NONTRANSITIONAL_TO_ASCII) == 0 : (options & UIDNA_NONTRANSITIONAL_TO_UNICODE) == 0;
-	const UChar *destArray = dest.getBuffer();
-	int32_t destLength = dest.length();
-	int32_t labelLimit = labelStart;
-	while (labelLimit < destLength) {
-		UChar c = destArray[labelLimit];
-		if (c == 0x2e && !isLabel) {
-			int32_t labelLength = labelLimit - labelStart;
-			int32_t newLength = processLabel(dest, labelStart, labelLength, toASCII, info, errorCode);
-			info.errors |= info.labelErrors;
-			info.labelErrors = 0;
-			if (U_FAILURE(errorCode)) {
-				return dest;
-			}
-			destArray = dest.getBuffer();
-			destLength += newLength - labelLength;
-			labelLimit = labelStart += newLength + 1;
+	int32_t labelStart = 0;
+	int32_t i;
+	if (processASCII<Options, ToASCII>(srcArray, srcLength, 0, srcLength, destArray, false, i, labelStart, info)) {
+		dest.append(destArray, srcLength, errorCode);
+		return;
+	}
+	info.errors |= info.labelErrors;
+	// Process the rest of src in UTF-8, from the start of the current label.
+	dest.append(destArray, labelStart, errorCode);
+	processUnicodeUTF8<Options, ToASCII>(StringPiece(srcArray + labelStart, srcLength - labelStart), false, 0 == labelStart, dest, info, &transDest, &transInfo, errorCode);
+	if (ToASCII) {
+		checkDomainNameLength(0, dest, info);
+	}
+	checkBiDiName(info, errorCode);
+	if (info.isTransDiff) {
+		if (ToASCII) {
+			checkDomainNameLength(0, transDest, transInfo);
+		}
+		checkBiDiName(transInfo, errorCode);
+	}
+}
+
+// Most non-ASCII names are all lowercase characters that uts46Norm2 leaves alone (see isUTS46Inert()):
+// copy runs of those and only normalize the segments between them.
+// Each run character has a composition boundary before it, so the segments can be normalized separately,
+// except that the last one of a run can combine with the following character and starts the next segment.
+void UTS46::normalizeAndAppend(const UnicodeString &src, int32_t start, UnicodeString &dest, UErrorCode &errorCode) const {
+	const UChar *srcArray = src.getBuffer();
+	int32_t srcLength = src.length();
+	int32_t i = start;
+	while (i < srcLength && U_SUCCESS(errorCode)) {
+		int32_t runStart = i;
+		while (i < srcLength && isUTS46Inert(srcArray[i])) {
+			++i;
+		}
+		if (i < srcLength && i > runStart) {
+			--i;
+		}
+		dest.append(srcArray, runStart, i - runStart);
+		if (i == srcLength) {
+			break;
+		}
+		int32_t segmentStart = i++;
+		while (i < srcLength && !isUTS46Inert(srcArray[i])) {
+			++i;
+		}
+		uts46Norm2->normalizeSecondAndAppend(dest, src.tempSubString(segmentStart, i - segmentStart), errorCode);
+	}
+}
+
+void UTS46::normalizeUTF8(StringPiece src, CharString &dest, UErrorCode &errorCode) const {
+	const char *srcArray = src.data();
+	int32_t srcLength = src.length();
+	CharStringByteSink sink(&dest, errorCode);
+	int32_t i = 0;
+	while (i < srcLength && U_SUCCESS(errorCode)) {
+		int32_t runStart = i;
+		int32_t lastStart = i;
+		while (i < srcLength) {
+			int32_t cpStart = i;
+			UChar32 c;
+			U8_NEXT(srcArray, i, srcLength, c);
+			if (!isUTS46Inert(c)) {  // also for ill-formed sequences, c<0
+				i = cpStart;
+				break;
+			}
+			lastStart = cpStart;
+		}
+		if (i < srcLength && i > runStart) {
+			i = lastStart;
+		}
+		sink.Append(srcArray + runStart, i - runStart);
+		if (i == srcLength) {
+			break;
+		}
+		int32_t segmentStart = i;
+		UChar32 c;
+		U8_NEXT(srcArray, i, srcLength, c);
+		while (i < srcLength) {
+			int32_t cpStart = i;
+			U8_NEXT(srcArray, i, srcLength, c);
+			if (isUTS46Inert(c)) {
+				i = cpStart;
+				break;
+			}
+		}
+		uts46Norm2->normalizeUTF8(StringPiece(srcArray + segmentStart, i - segmentStart), sink, errorCode);
+	}
+}
+
+// UIDNA_TRUSTED_NFC_INPUT: the caller promises that the input is already mapped and in NFC,
+// so it is appended as is, without any normalizer work. Instead, the label validation checks the UTS #46 status
+// of each code point: anything mapped, ignored or disallowed is reported as UIDNA_ERROR_DISALLOWED,
+// and ASCII uppercase letters are lowercased. Builds with UIDNA_VERIFY_TRUSTED_NFC assert the promise.
+void UTS46::appendTrustedNFC(const UnicodeString &src, int32_t start, UnicodeString &dest, UErrorCode &errorCode) const {
+	dest.append(src, start, src.length() - start);
+#ifdef UIDNA_VERIFY_TRUSTED_NFC
+	assert(uts46Norm2->isNormalized(dest, errorCode));
+#else
+	(void)errorCode;
+#endif
+}
+
+void UTS46::appendTrustedNFCUTF8(StringPiece src, CharString &dest, UErrorCode &errorCode) const {
+#ifdef UIDNA_VERIFY_TRUSTED_NFC
+	assert(uts46Norm2->isNormalizedUTF8(src, errorCode));
+#endif
+	dest.append(src.data(), src.length(), errorCode);
+}
+
+template <uint32_t Options, bool ToASCII>
+UnicodeString& UTS46::processUnicode(const UnicodeString &src, int32_t labelStart, int32_t mappingStart, UBool isLabel,
+		UnicodeString &dest, IDNAInfo &info, UnicodeString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const {
+	// Map and normalize the rest of the name separately, starting with the already mapped start of the current label
+	// because normalization can combine with it. Then dest is append-only:
+	// each label is appended once and processed at the end of dest,
+	// where changes of its length and the mapping of deviation characters do not move anything else.
+	UnicodeString mapped;
+	mapped.append(dest, labelStart, mappingStart - labelStart);
+	dest.truncate(labelStart);
+	if ((options & UIDNA_TRUSTED_NFC_INPUT) != 0) {
+		appendTrustedNFC(src, mappingStart, mapped, errorCode);
+	} else {
+		normalizeAndAppend(src, mappingStart, mapped, errorCode);
+	}
+	if (U_FAILURE(errorCode)) {
+		return dest;
+	}
+	// A dual conversion maps deviation characters only in transDest.
+	UBool doMapDevChars = transDest == NULL && !hasOption<Options>(ToASCII ? UIDNA_NONTRANSITIONAL_TO_ASCII : UIDNA_NONTRANSITIONAL_TO_UNICODE);
+	int32_t transLabelStart = -1;  // >=0 once transDest has forked off
+	const UChar *mappedArray = mapped.getBuffer();
+	int32_t mappedLength = mapped.length();
+	int32_t i = 0;
+	for (;;) {
+		int32_t segmentStart = i;
+		int32_t devCharIndex = -1;  // in the label, of the first deviation character
+		for (; i < mappedLength; ++i) {
+			UChar c = mappedArray[i];
+			if (c == 0x2e && !isLabel) {
+				break;
+			} else if (c < 0xdf) {
+				// pass
+			} else if (c <= 0x200d && (c == 0xdf || c == 0x3c2 || c >= 0x200c)) {
+				info.isTransDiff = true;
+				if (devCharIndex < 0) {
+					devCharIndex = i - segmentStart;
+				}
+			} else if (U16_IS_SURROGATE(c)) {
+				if (U16_IS_SURROGATE_LEAD(c) ? (i + 1) == mappedLength || !U16_IS_TRAIL(mappedArray[i + 1]) : i == segmentStart || !U16_IS_LEAD(mappedArray[i - 1])) {
+					// Map an unpaired surrogate to U+FFFD before the deviation characters
+					// so that when that removes characters we do not turn two unpaired ones into a pair.
+					info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+					mapped.setCharAt(i, 0xfffd);
+					mappedArray = mapped.getBuffer();
+				}
+			}
+		}
+		dest.append(mapped, segmentStart, i - segmentStart);
+		if (dest.isBogus()) {
+			errorCode = U_MEMORY_ALLOCATION_ERROR;
+			return dest;
+		}
+		if (doMapDevChars && devCharIndex >= 0) {
+			mapDevChars(dest, labelStart, labelStart + devCharIndex, errorCode);
+		} else if (transDest != NULL && devCharIndex >= 0) {
+			if (transLabelStart < 0) {
+				// The results were the same so far.
+				transDest->append(dest, 0, labelStart);
+				transInfo->copyState(info);
+				transLabelStart = labelStart;
+			}
+			appendSubstring(*transDest, dest, labelStart, dest.length() - labelStart, errorCode);
+			mapDevChars(*transDest, transLabelStart, transLabelStart + devCharIndex, errorCode);
+		}
+		if (U_FAILURE(errorCode)) {
+			return dest;
+		}
+		int32_t labelLength = dest.length() - labelStart;
+		if (i == mappedLength) {
+			// Permit an empty label at the end (0<labelStart==dest.length() is ok)
+			// but not an empty label elsewhere nor a completely empty domain name.
+			// processLabel() sets UIDNA_ERROR_EMPTY_LABEL when labelLength==0.
+			if (0 == labelStart || labelLength > 0) {
+				processDualLabel<Options, ToASCII>(dest, labelStart, info, transDest, transLabelStart, devCharIndex >= 0, true, transInfo, errorCode);
+				info.errors |= info.labelErrors;
+			}
+			return dest;
+		}
+		processDualLabel<Options, ToASCII>(dest, labelStart, info, transDest, transLabelStart, devCharIndex >= 0, false, transInfo, errorCode);
+		info.errors |= info.labelErrors;
+		info.labelErrors = 0;
+		if (U_FAILURE(errorCode) || (info.errors & info.stopErrors) != 0) {
+			return dest;
+		}
+		dest.append((UChar) 0x2e);
+		labelStart = dest.length();
+		if (transLabelStart >= 0) {
+			transDest->append((UChar) 0x2e);
+			transLabelStart = transDest->length();
+		}
+		++i;
+	}
+}
+
+// Appends the mapped label at mapped[i..] to dest, up to the next dot in a name, and sets i to that dot or the end.
+// Returns the dest index of the first deviation character in the label, or -1.
+static int32_t appendMappedLabel(const CharString &mapped, int32_t &i, UBool isLabel, CharString &dest, UErrorCode &errorCode) {
+	const char *mappedArray = mapped.data();
+	int32_t mappedLength = mapped.length();
+	int32_t runStart = i;
+	int32_t devCharStart = -1;
+	while (i < mappedLength) {
+		uint8_t b = mappedArray[i];
+		if (b == 0x2e && !isLabel) {
+			break;
+		} else if (b <= 0x7f) {
+			++i;
 			continue;
-		} else if (c < 0xdf) {
-			// pass
+		}
+		int32_t cpStart = i;
+		UChar32 c;
+		U8_NEXT(mappedArray, i, mappedLength, c);
+		if (c < 0) {
+			// Map an ill-formed sequence to U+FFFD, as the conversion to UTF-16 would,
+			// so that processLabel() reports it as disallowed
+			// and removing ZWNJ/ZWJ cannot join its bytes into a new character.
+			// The normalizer passed it through unchanged.
+			dest.append(mappedArray + runStart, cpStart - runStart, errorCode).append("\xef\xbf\xbd", 3, errorCode);
+			runStart = i;
 		} else if (c <= 0x200d && (c == 0xdf || c == 0x3c2 || c >= 0x200c)) {
+			if (devCharStart < 0) {
+				devCharStart = dest.length() + cpStart - runStart;
+			}
+		}
+	}
+	dest.append(mappedArray + runStart, i - runStart, errorCode);
+	return devCharStart;
+}
+
+template <uint32_t Options, bool ToASCII>
+void UTS46::processUnicodeUTF8(StringPiece src, UBool isLabel, UBool isNameStart, CharString &dest, IDNAInfo &info,
+		CharString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const {
+	// Append-only like the UTF-16 version, see there.
+	CharString mapped;
+	if ((options & UIDNA_TRUSTED_NFC_INPUT) != 0) {
+		appendTrustedNFCUTF8(src, mapped, errorCode);
+	} else {
+		normalizeUTF8(src, mapped, errorCode);
+	}
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	UBool doMapDevChars = transDest == NULL && !hasOption<Options>(ToASCII ? UIDNA_NONTRANSITIONAL_TO_ASCII : UIDNA_NONTRANSITIONAL_TO_UNICODE);
+	int32_t transLabelStart = -1;  // >=0 once transDest has forked off
+	int32_t mappedLength = mapped.length();
+	int32_t labelStart = dest.length();
+	int32_t nameStart = isNameStart ? labelStart : -1;  // dest does not always start with the name
+	int32_t i = 0;
+	for (;;) {
+		int32_t devCharStart = appendMappedLabel(mapped, i, isLabel, dest, errorCode);
+		if (devCharStart >= 0) {
 			info.isTransDiff = true;
-			if (doMapDevChars) {
-				destLength = mapDevChars(dest, labelStart, labelLimit, errorCode);
-				if (U_FAILURE(errorCode)) {
-					return dest;
-				}
-				destArray = dest.getBuffer();
-				// All deviation characters have been mapped, no need to check for them again.
-				doMapDevChars = false;
-				// Do not increment labelLimit in case c was removed.
-				continue;
+		}
+		if (doMapDevChars && devCharStart >= 0) {
+			mapDevChars(dest, labelStart, devCharStart, errorCode);
+		} else if (transDest != NULL && devCharStart >= 0) {
+			if (transLabelStart < 0) {
+				// The results were the same so far.
+				transDest->append(dest.data(), labelStart, errorCode);
+				transInfo->copyState(info);
+				transLabelStart = labelStart;
 			}
-		} else if (U16_IS_SURROGATE(c)) {
-			if (U16_IS_SURROGATE_LEAD(c) ? (labelLimit + 1) == destLength || !U16_IS_TRAIL(destArray[labelLimit + 1]) : labelLimit == labelStart || !U16_IS_LEAD(destArray[labelLimit - 1])) {
-				// Map an unpaired surrogate to U+FFFD before normalization so that when
-				// that removes characters we do not turn two unpaired ones into a pair.
-				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
-				dest.setCharAt(labelLimit, 0xfffd);
-				destArray = dest.getBuffer();
+			appendSubstring(*transDest, dest, labelStart, dest.length() - labelStart, errorCode);
+			mapDevChars(*transDest, transLabelStart, transLabelStart + (devCharStart - labelStart), errorCode);
+		}
+		if (U_FAILURE(errorCode)) {
+			return;
+		}
+		int32_t labelLength = dest.length() - labelStart;
+		if (i == mappedLength) {
+			// Permit an empty label at the end (0<labelStart==dest.length() is ok)
+			// but not an empty label elsewhere nor a completely empty domain name.
+			// processLabel() sets UIDNA_ERROR_EMPTY_LABEL when labelLength==0.
+			if (nameStart == labelStart || labelLength > 0) {
+				processDualLabel<Options, ToASCII>(dest, labelStart, info, transDest, transLabelStart, devCharStart >= 0, true, transInfo, errorCode);
+				info.errors |= info.labelErrors;
 			}
+			return;
 		}
-		++labelLimit;
-	}
-	// Permit an empty label at the end (0<labelStart==labelLimit==destLength is ok)
-	// but not an empty label elsewhere nor a completely empty domain name.
-	// processLabel() sets UIDNA_ERROR_EMPTY_LABEL when labelLength==0.
-	if (0 == labelStart || labelStart < labelLimit) {
-		processLabel(dest, labelStart, labelLimit - labelStart, toASCII, info, errorCode);
+		processDualLabel<Options, ToASCII>(dest, labelStart, info, transDest, transLabelStart, devCharStart >= 0, false, transInfo, errorCode);
 		info.errors |= info.labelErrors;
+		info.labelErrors = 0;
+		if (U_FAILURE(errorCode) || (info.errors & info.stopErrors) != 0) {
+			return;
+		}
+		dest.append('.', errorCode);
+		labelStart = dest.length();
+		if (transLabelStart >= 0) {
+			transDest->append('.', errorCode);
+			transLabelStart = transDest->length();
+		}
+		++i;
 	}
-	return dest;
+}
+
+template <uint32_t Options>
+void UTS46::processBothUTF8(StringPiece src, CharString &asciiDest, IDNAInfo &asciiInfo,
+		CharString &unicodeDest, IDNAInfo &unicodeInfo, UErrorCode &errorCode) const {
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	const char *srcArray = src.data();
+	int32_t srcLength = src.length();
+	if (srcArray == NULL && srcLength != 0) {
+		errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	asciiInfo.reset();
+	unicodeInfo.reset();
+	if (srcLength == 0) {
+		asciiInfo.errors |= UIDNA_ERROR_EMPTY_LABEL;
+		unicodeInfo.errors |= UIDNA_ERROR_EMPTY_LABEL;
+		return;
+	}
+	// The ASCII fastpath results of the two directions differ only in the length errors, which only toASCII has.
+	int32_t capacity;
+	char *destArray = asciiDest.getAppendBuffer(srcLength, srcLength, capacity, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	int32_t labelStart = 0;
+	int32_t i;
+	UBool done = processASCII<Options, true>(srcArray, srcLength, 0, srcLength, destArray, false, i, labelStart, asciiInfo);
+	asciiDest.append(destArray, done ? srcLength : labelStart, errorCode);
+	unicodeDest.append(asciiDest, errorCode);
+	asciiInfo.errors |= asciiInfo.labelErrors;
+	unicodeInfo.copyState(asciiInfo);
+	unicodeInfo.errors &= ~(UIDNA_ERROR_LABEL_TOO_LONG | UIDNA_ERROR_DOMAIN_NAME_TOO_LONG);
+	unicodeInfo.labelErrors &= ~UIDNA_ERROR_LABEL_TOO_LONG;
+	if (done || U_FAILURE(errorCode)) {
+		return;
+	}
+	// Map the rest of src from the start of the current label once, for both directions.
+	StringPiece rest(srcArray + labelStart, srcLength - labelStart);
+	CharString mapped;
+	if ((options & UIDNA_TRUSTED_NFC_INPUT) != 0) {
+		appendTrustedNFCUTF8(rest, mapped, errorCode);
+	} else {
+		normalizeUTF8(rest, mapped, errorCode);
+	}
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	// Only deviation characters are mapped per direction, according to its NONTRANSITIONAL option.
+	UBool mapUnicodeDevChars = !hasOption<Options>(UIDNA_NONTRANSITIONAL_TO_UNICODE);
+	UBool mapASCIIDevChars = (options & UIDNA_NONTRANSITIONAL_TO_ASCII) == 0;
+	int32_t asciiLabelStart = asciiDest.length();
+	int32_t unicodeLabelStart = unicodeDest.length();
+	i = 0;
+	for (;;) {
+		int32_t devCharStart = appendMappedLabel(mapped, i, false, unicodeDest, errorCode);
+		UBool hasASCIILabel = false;
+		if (devCharStart >= 0) {
+			asciiInfo.isTransDiff = unicodeInfo.isTransDiff = true;
+			if (mapASCIIDevChars != mapUnicodeDevChars) {
+				hasASCIILabel = true;
+				appendSubstring(asciiDest, unicodeDest, unicodeLabelStart, unicodeDest.length() - unicodeLabelStart, errorCode);
+				if (mapASCIIDevChars) {
+					mapDevChars(asciiDest, asciiLabelStart, asciiLabelStart + (devCharStart - unicodeLabelStart), errorCode);
+				}
+			}
+			if (mapUnicodeDevChars) {
+				mapDevChars(unicodeDest, unicodeLabelStart, devCharStart, errorCode);
+			}
+		}
+		if (U_FAILURE(errorCode)) {
+			return;
+		}
+		processBothLabel<Options>(asciiDest, asciiLabelStart, asciiInfo, unicodeDest, unicodeLabelStart, unicodeInfo,
+				hasASCIILabel, i == mapped.length(), errorCode);
+		asciiInfo.errors |= asciiInfo.labelErrors;
+		asciiInfo.labelErrors = 0;
+		unicodeInfo.errors |= unicodeInfo.labelErrors;
+		unicodeInfo.labelErrors = 0;
+		if (i == mapped.length() || U_FAILURE(errorCode)) {
+			break;
+		}
+		asciiDest.append('.', errorCode);
+		unicodeDest.append('.', errorCode);
+		asciiLabelStart = asciiDest.length();
+		unicodeLabelStart = unicodeDest.length();
+		++i;
+	}
+	checkDomainNameLength(0, asciiDest, asciiInfo);
+	checkBiDiName(asciiInfo, errorCode);
+	checkBiDiName(unicodeInfo, errorCode);
 }
 
 int32_t UTS46::mapDevChars(UnicodeString &dest, int32_t labelStart, int32_t mappingStart, UErrorCode &errorCode) const {
@@ -442,106 +1159,500 @@ int32_t UTS46::mapDevChars(UnicodeString &dest, int32_t labelStart, int32_t mapp
 	return length;
 }
 
-// Some non-ASCII characters are equivalent to sequences with
-// non-LDH ASCII characters. To find them:
-// grep disallowed_STD3_valid IdnaMappingTable.txt (or uts46.txt)
-static inline UBool isNonASCIIDisallowedSTD3Valid(UChar32 c) {
-	return c == 0x2260 || c == 0x226E || c == 0x226F;
-}
-
-// Replace the label in dest with the label string, if the label was modified.
-// If &label==&dest then the label was modified in-place and labelLength
-// is the new label length, different from label.length().
-// If &label!=&dest then labelLength==label.length().
-// Returns labelLength (= the new label length).
-static int32_t replaceLabel(UnicodeString &dest, int32_t destLabelStart, int32_t destLabelLength,
-		const UnicodeString &label, int32_t labelLength, UErrorCode &errorCode) {
+int32_t UTS46::mapDevChars(CharString &dest, int32_t labelStart, int32_t mappingStart, UErrorCode &errorCode) const {
 	if (U_FAILURE(errorCode)) {
 		return 0;
 	}
-	if (&label != &dest) {
-		dest.replace(destLabelStart, destLabelLength, label);
-		if (dest.isBogus()) {
-			errorCode = U_MEMORY_ALLOCATION_ERROR;
-			return 0;
+	// Maps the current label at the end of dest, from mappingStart on.
+	// processUnicodeUTF8() replaced ill-formed sequences with U+FFFD already; be safe anyway.
+	const char *s = dest.data();
+	int32_t length = dest.length();
+	CharString mapped;
+	mapped.append(s + labelStart, mappingStart - labelStart, errorCode);
+	for (int32_t i = mappingStart; i < length;) {
+		int32_t cpStart = i;
+		UChar32 c;
+		U8_NEXT(s, i, length, c);
+		switch (c) {
+		case U_SENTINEL:
+			mapped.append("\xef\xbf\xbd", 3, errorCode);
+			break;
+		case 0xdf:  // Map sharp s to ss.
+			mapped.append("ss", 2, errorCode);
+			break;
+		case 0x3c2:  // Map final sigma to nonfinal sigma.
+			mapped.append("\xcf\x83", 2, errorCode);
+			break;
+		case 0x200c:  // Ignore/remove ZWNJ.
+		case 0x200d:  // Ignore/remove ZWJ.
+			break;
+		default:
+			mapped.append(s + cpStart, i - cpStart, errorCode);
+			break;
 		}
 	}
-	return labelLength;
+	// Mapping deviation characters might have resulted in an un-NFC string.
+	dest.truncate(labelStart);
+	CharStringByteSink sink(&dest, errorCode);
+	uts46Norm2->normalizeUTF8(mapped.toStringPiece(), sink, errorCode);
+	return dest.length();
 }
 
-int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, UBool toASCII, IDNAInfo &info, UErrorCode &errorCode) const {
-	if (U_FAILURE(errorCode)) {
-		return 0;
+const uint32_t L_MASK = U_MASK(U_LEFT_TO_RIGHT);
+const uint32_t R_AL_MASK = U_MASK(U_RIGHT_TO_LEFT) | U_MASK(U_RIGHT_TO_LEFT_ARABIC);
+const uint32_t L_R_AL_MASK = L_MASK | R_AL_MASK;
+
+const uint32_t R_AL_AN_MASK = R_AL_MASK | U_MASK(U_ARABIC_NUMBER);
+
+const uint32_t EN_AN_MASK = U_MASK(U_EUROPEAN_NUMBER) | U_MASK(U_ARABIC_NUMBER);
+const uint32_t R_AL_EN_AN_MASK = R_AL_MASK | EN_AN_MASK;
+const uint32_t L_EN_MASK = L_MASK | U_MASK(U_EUROPEAN_NUMBER);
+
+const uint32_t ES_CS_ET_ON_BN_NSM_MASK =
+	U_MASK(U_EUROPEAN_NUMBER_SEPARATOR) |
+	U_MASK(U_COMMON_NUMBER_SEPARATOR) |
+	U_MASK(U_EUROPEAN_NUMBER_TERMINATOR) |
+	U_MASK(U_OTHER_NEUTRAL) |
+	U_MASK(U_BOUNDARY_NEUTRAL) |
+	U_MASK(U_DIR_NON_SPACING_MARK);
+const uint32_t L_EN_ES_CS_ET_ON_BN_NSM_MASK = L_EN_MASK | ES_CS_ET_ON_BN_NSM_MASK;
+const uint32_t R_AL_AN_EN_ES_CS_ET_ON_BN_NSM_MASK = R_AL_MASK | EN_AN_MASK | ES_CS_ET_ON_BN_NSM_MASK;
+
+// The contextual label checks (BiDi rule, CONTEXTJ, CONTEXTO) as state machines
+// that processLabelUncached() feeds with the code points of a label in order, together with their getIDNAProps(),
+// so that each code point is decoded and looked up once for all rules.
+// A condition on the following code point stays pending until next() or finish().
+class LabelChecker {
+public:
+	LabelChecker(UBool bidi, UBool contextJ, UBool contextO)
+	: checkBiDi(bidi), checkContextJ(contextJ), checkContextO(contextO), prevChar(0), prevProps(0),
+	  firstMask(0), lastMask(0), mask(0),
+	  lastJoiningType(U_JT_NON_JOINING), isAfterZWNJ(false), isOkContextJ(true),
+	  pendingAfter(0), arabicDigits(0), hasKatakanaMiddleDot(false), hasHiraganaKatakanaHan(false), contextOErrors(0) { }
+
+	// Whether next() looks at the properties of ASCII code points.
+	UBool needsASCIIProps() const {
+		return checkBiDi || checkContextJ || checkContextO;
+	}
+
+	void next(UChar32 c, uint16_t props) {
+		if (checkBiDi) {
+			nextBiDi(props);
+		}
+		if (checkContextJ) {
+			nextContextJ(c, props);
+		}
+		if (checkContextO) {
+			nextContextO(c, props);
+		}
+		prevChar = c;
+		prevProps = props;
 	}
-	UnicodeString fromPunycode;
-	UnicodeString *labelString;
-	const UChar *label = dest.getBuffer() + labelStart;
-	int32_t destLabelStart = labelStart;
-	int32_t destLabelLength = labelLength;
-	UBool wasPunycode;
-	if (labelLength >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
-		// Label starts with "xn--", try to un-Punycode it.
-		// In IDNA2008, labels like "xn--" (decodes to an empty string) and
-		// "xn--ASCII-" (decodes to just "ASCII") fail the round-trip validation from
-		// comparing the ToUnicode input with the back-to-ToASCII output.
-		// They are alternate encodings of the respective ASCII labels.
-		// Ignore "xn---" here: It will fail Punycode.decode() which logically comes before
-		// the round-trip verification.
-		if (labelLength == 4 || (labelLength > 5 && label[labelLength - 1] == u'-')) {
-			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
-			return markBadACELabel(dest, labelStart, labelLength, toASCII, info, errorCode);
+
+	// Adds the results to info.
+	// Only for labels without severe errors, because U+FFFD can make these checks fail.
+	void finish(IDNAInfo &info) const {
+		if (checkBiDi) {
+			finishBiDi(info);
 		}
-		wasPunycode = true;
-		UChar *unicodeBuffer = fromPunycode.getBuffer(-1);  // capacity==-1: most labels should fit
-		if (unicodeBuffer == NULL) {
-			// Should never occur if we used capacity==-1 which uses the internal buffer.
-			errorCode = U_MEMORY_ALLOCATION_ERROR;
-			return labelLength;
+		if (checkContextJ && (!isOkContextJ || isAfterZWNJ)) {
+			info.labelErrors |= UIDNA_ERROR_CONTEXTJ;
 		}
-		UErrorCode punycodeErrorCode = U_ZERO_ERROR;
-		int32_t unicodeLength = u_strFromPunycode(label + 4, labelLength - 4, unicodeBuffer, fromPunycode.getCapacity(),
-		NULL, &punycodeErrorCode);
-		if (punycodeErrorCode == U_BUFFER_OVERFLOW_ERROR) {
-			fromPunycode.releaseBuffer(0);
-			unicodeBuffer = fromPunycode.getBuffer(unicodeLength);
-			if (unicodeBuffer == NULL) {
-				errorCode = U_MEMORY_ALLOCATION_ERROR;
-				return labelLength;
+		if (checkContextO) {
+			info.labelErrors |= contextOErrors;
+			if (pendingAfter != 0 || (hasKatakanaMiddleDot && !hasHiraganaKatakanaHan)) {
+				info.labelErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
 			}
-			punycodeErrorCode = U_ZERO_ERROR;
-			unicodeLength = u_strFromPunycode(label + 4, labelLength - 4, unicodeBuffer, fromPunycode.getCapacity(),
-			NULL, &punycodeErrorCode);
 		}
-		fromPunycode.releaseBuffer(unicodeLength);
-		if (U_FAILURE(punycodeErrorCode)) {
-			info.labelErrors |= UIDNA_ERROR_PUNYCODE;
-			return markBadACELabel(dest, labelStart, labelLength, toASCII, info, errorCode);
+	}
+
+private:
+	void nextBiDi(uint16_t props) {
+		UCharDirection dir = getIDNAPropsBiDi(props);
+		uint32_t dirMask = U_MASK(dir);
+		if (firstMask == 0) {
+			firstMask = lastMask = dirMask;
+		} else if (dir != U_DIR_NON_SPACING_MARK) {
+			// the last non-NSM character
+			lastMask = dirMask;
 		}
-		// Check for NFC, and for characters that are not
-		// valid or deviation characters according to the normalizer.
-		// If there is something wrong, then the string will change.
-		// Note that the normalizer passes through non-LDH ASCII and deviation characters.
-		// Deviation characters are ok in Punycode even in transitional processing.
-		// In the code further below, if we find non-LDH ASCII and we have UIDNA_USE_STD3_RULES
-		// then we will set UIDNA_ERROR_INVALID_ACE_LABEL there too.
-		UBool isValid = uts46Norm2->isNormalized(fromPunycode, errorCode);
-		if (U_FAILURE(errorCode)) {
-			return labelLength;
+		mask |= dirMask;
+	}
+
+	// In a BiDi domain name, all labels must pass the BiDi Rule, but we might find
+	// that a domain name is a BiDi domain name (has an RTL label) only after
+	// processing several earlier labels, so every label gets both results.
+	void finishBiDi(IDNAInfo &info) const {
+		// IDNA2008 BiDi rule
+		// 1. The first character must be a character with BIDI property L, R
+		// or AL.  If it has the R or AL property, it is an RTL label; if it
+		// has the L property, it is an LTR label.
+		if ((firstMask & ~L_R_AL_MASK) != 0) {
+			info.isOkBiDi = false;
 		}
-		if (!isValid) {
-			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
-			return markBadACELabel(dest, labelStart, labelLength, toASCII, info, errorCode);
+		// 3. In an RTL label, the end of the label must be a character with
+		// BIDI property R, AL, EN or AN, followed by zero or more
+		// characters with BIDI property NSM.
+		// 6. In an LTR label, the end of the label must be a character with
+		// BIDI property L or EN, followed by zero or more characters with
+		// BIDI property NSM.
+		if ((firstMask & L_MASK) != 0 ? (lastMask & ~L_EN_MASK) != 0 : (lastMask & ~R_AL_EN_AN_MASK) != 0) {
+			info.isOkBiDi = false;
+		}
+		if (firstMask & L_MASK) {
+			// 5. In an LTR label, only characters with the BIDI properties L, EN,
+			// ES, CS, ET, ON, BN and NSM are allowed.
+			if ((mask & ~L_EN_ES_CS_ET_ON_BN_NSM_MASK) != 0) {
+				info.isOkBiDi = false;
+			}
+		} else {
+			// 2. In an RTL label, only characters with the BIDI properties R, AL,
+			// AN, EN, ES, CS, ET, ON, BN and NSM are allowed.
+			if ((mask & ~R_AL_AN_EN_ES_CS_ET_ON_BN_NSM_MASK) != 0) {
+				info.isOkBiDi = false;
+			}
+			// 4. In an RTL label, if an EN is present, no AN may be present, and
+			// vice versa.
+			if ((mask & EN_AN_MASK) == EN_AN_MASK) {
+				info.isOkBiDi = false;
+			}
+		}
+		// An RTL label is a label that contains at least one character of type
+		// R, AL or AN. [...]
+		// A "BIDI domain name" is a domain name that contains at least one RTL
+		// label. [...]
+		// The following rule, consisting of six conditions, applies to labels
+		// in BIDI domain names.
+		if ((mask & R_AL_AN_MASK) != 0) {
+			info.isBiDi = true;
 		}
-		labelString = &fromPunycode;
-		label = fromPunycode.getBuffer();
-		labelStart = 0;
-		labelLength = fromPunycode.length();
-	} else {
-		wasPunycode = false;
-		labelString = &dest;
 	}
-	// Validity check
-	if (labelLength == 0) {
+
+	void nextContextJ(UChar32 c, uint16_t props) {
+		// [IDNA2008-Tables]
+		// 200C..200D  ; CONTEXTJ    # ZERO WIDTH NON-JOINER..ZERO WIDTH JOINER
+		UJoiningType type = getIDNAPropsJoiningType(props);
+		if (isAfterZWNJ && type != U_JT_TRANSPARENT) {
+			// postcontext of a ZWNJ: (Joining_Type:T)*(Joining_Type:{R,D})
+			if (type != U_JT_RIGHT_JOINING && type != U_JT_DUAL_JOINING) {
+				isOkContextJ = false;
+			}
+			isAfterZWNJ = false;
+		}
+		if (c == 0x200c) {
+			// Appendix A.1. ZERO WIDTH NON-JOINER
+			// Rule Set:
+			//  False;
+			//  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
+			//  If RegExpMatch((Joining_Type:{L,D})(Joining_Type:T)*\u200C
+			//     (Joining_Type:T)*(Joining_Type:{R,D})) Then True;
+			if ((prevProps & IDNAPropsVirama) == 0) {
+				// precontext (Joining_Type:{L,D})(Joining_Type:T)*, false at the start of the label
+				if (lastJoiningType != U_JT_LEFT_JOINING && lastJoiningType != U_JT_DUAL_JOINING) {
+					isOkContextJ = false;
+				}
+				isAfterZWNJ = true;
+			}
+		} else if (c == 0x200d) {
+			// Appendix A.2. ZERO WIDTH JOINER (U+200D)
+			// Rule Set:
+			//  False;
+			//  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
+			if ((prevProps & IDNAPropsVirama) == 0) {
+				isOkContextJ = false;
+			}
+		}
+		if (type != U_JT_TRANSPARENT) {
+			lastJoiningType = type;
+		}
+	}
+
+	void nextContextO(UChar32 c, uint16_t props) {
+		if (pendingAfter != 0) {
+			if (pendingAfter == 0xb7 ? c != 0x6c : getIDNAPropsScript(props) != IDNAScriptClass::Greek) {
+				contextOErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
+			}
+			pendingAfter = 0;
+		}
+		if (c < 0xb7) {
+			// ASCII fastpath
+		} else if (c <= 0x6f9) {
+			if (c == 0xb7) {
+				// Appendix A.3. MIDDLE DOT (U+00B7)
+				// Rule Set:
+				//  False;
+				//  If Before(cp) .eq.  U+006C And
+				//     After(cp) .eq.  U+006C Then True;
+				if (prevChar != 0x6c) {
+					contextOErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
+				}
+				pendingAfter = c;
+			} else if (c == 0x375) {
+				// Appendix A.4. GREEK LOWER NUMERAL SIGN (KERAIA) (U+0375)
+				// Rule Set:
+				//  False;
+				//  If Script(After(cp)) .eq.  Greek Then True;
+				pendingAfter = c;
+			} else if (c == 0x5f3 || c == 0x5f4) {
+				// Appendix A.5. HEBREW PUNCTUATION GERESH (U+05F3)
+				// Rule Set:
+				//  False;
+				//  If Script(Before(cp)) .eq.  Hebrew Then True;
+				//
+				// Appendix A.6. HEBREW PUNCTUATION GERSHAYIM (U+05F4)
+				// Rule Set:
+				//  False;
+				//  If Script(Before(cp)) .eq.  Hebrew Then True;
+				if (getIDNAPropsScript(prevProps) != IDNAScriptClass::Hebrew) {
+					contextOErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
+				}
+			} else if (0x660 <= c /* && c<=0x6f9 */) {
+				// Appendix A.8. ARABIC-INDIC DIGITS (0660..0669)
+				// Rule Set:
+				//  True;
+				//  For All Characters:
+				//    If cp .in. 06F0..06F9 Then False;
+				//  End For;
+				//
+				// Appendix A.9. EXTENDED ARABIC-INDIC DIGITS (06F0..06F9)
+				// Rule Set:
+				//  True;
+				//  For All Characters:
+				//    If cp .in. 0660..0669 Then False;
+				//  End For;
+				if (c <= 0x669) {
+					if (arabicDigits > 0) {
+						contextOErrors |= UIDNA_ERROR_CONTEXTO_DIGITS;
+					}
+					arabicDigits = -1;
+				} else if (0x6f0 <= c) {
+					if (arabicDigits < 0) {
+						contextOErrors |= UIDNA_ERROR_CONTEXTO_DIGITS;
+					}
+					arabicDigits = 1;
+				}
+			}
+		} else if (c == 0x30fb) {
+			// Appendix A.7. KATAKANA MIDDLE DOT (U+30FB)
+			// Rule Set:
+			//  False;
+			//  For All Characters:
+			//    If Script(cp) .in. {Hiragana, Katakana, Han} Then True;
+			//  End For;
+			hasKatakanaMiddleDot = true;
+		}
+		if (getIDNAPropsScript(props) == IDNAScriptClass::HiraganaKatakanaHan) {
+			hasHiraganaKatakanaHan = true;
+		}
+	}
+
+	UBool checkBiDi, checkContextJ, checkContextO;
+	UChar32 prevChar;  // 0 and no properties at the start of the label
+	uint16_t prevProps;
+	// BiDi rule: directionalities of the first character, of the last non-NSM one, and of all of them
+	uint32_t firstMask, lastMask, mask;
+	// CONTEXTJ
+	UJoiningType lastJoiningType;  // of the last non-transparent character
+	UBool isAfterZWNJ;  // the postcontext of a ZWNJ is pending
+	UBool isOkContextJ;
+	// CONTEXTO
+	UChar32 pendingAfter;  // U+00B7 or U+0375 that waits for the following character
+	int32_t arabicDigits;  // -1 for 066x, +1 for 06Fx
+	UBool hasKatakanaMiddleDot, hasHiraganaKatakanaHan;
+	uint32_t contextOErrors;
+};
+
+// Replace the label in dest with the label string, if the label was modified.
+// If &label==&dest then the label was modified in-place and labelLength
+// is the new label length, different from label.length().
+// If &label!=&dest then labelLength==label.length().
+// Returns labelLength (= the new label length).
+static int32_t replaceLabel(UnicodeString &dest, int32_t destLabelStart, int32_t destLabelLength,
+		const UnicodeString &label, int32_t labelLength, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	if (&label != &dest) {
+		dest.replace(destLabelStart, destLabelLength, label);
+		if (dest.isBogus()) {
+			errorCode = U_MEMORY_ALLOCATION_ERROR;
+			return 0;
+		}
+	}
+	return labelLength;
+}
+
+// Labels worth memoizing: the Punycode decoding and encoding and the validation are the expensive parts.
+template <typename Char>
+static UBool isLabelCacheable(const Char *label, int32_t labelLength) {
+	if (labelLength >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
+		return true;
+	}
+	for (int32_t i = 0; i < labelLength; ++i) {
+		if ((uint32_t)(uint16_t) label[i] > 0x7f) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void UTS46::mergeLabelInfo(IDNAInfo &info, uint32_t labelErrors, uint32_t flags) {
+	// Same as running the label checks on info itself: the BiDi rule only ever sets isBiDi
+	// and clears isOkBiDi.
+	info.labelErrors |= labelErrors;
+	if ((flags & LabelCacheBiDi) != 0) {
+		info.isBiDi = true;
+	}
+	if ((flags & LabelCacheNotOkBiDi) != 0) {
+		info.isOkBiDi = false;
+	}
+}
+
+template <uint32_t Options, bool ToASCII, typename String>
+void UTS46::processDualLabel(String &dest, int32_t labelStart, IDNAInfo &info,
+		String *transDest, int32_t transLabelStart, UBool hasDevChars, UBool atEnd, IDNAInfo *transInfo, UErrorCode &errorCode) const {
+	if (transLabelStart < 0) {
+		processLabel<Options, ToASCII>(dest, labelStart, dest.length() - labelStart, info, errorCode);
+		return;
+	}
+	if (hasDevChars) {
+		// The labels differ, process both.
+		transInfo->labelErrors |= info.labelErrors;
+		processLabel<Options, ToASCII>(dest, labelStart, dest.length() - labelStart, info, errorCode);
+		// Removing ZWJ/ZWNJ can empty the transitional label: at the end of the name that is the permitted
+		// empty last label, as in processUnicode() without a dual result.
+		int32_t transLabelLength = transDest->length() - transLabelStart;
+		if (!atEnd || 0 == transLabelStart || transLabelLength > 0) {
+			processLabel<Options, ToASCII>(*transDest, transLabelStart, transLabelLength, *transInfo, errorCode);
+		}
+	} else {
+		// Process the same label once, with fresh label state as for the label cache, and add the results to both.
+		IDNAInfo labelInfo;
+		labelInfo.labelErrors = info.labelErrors;
+		processLabel<Options, ToASCII>(dest, labelStart, dest.length() - labelStart, labelInfo, errorCode);
+		appendSubstring(*transDest, dest, labelStart, dest.length() - labelStart, errorCode);
+		uint32_t flags = (labelInfo.isBiDi ? LabelCacheBiDi : 0) | (labelInfo.isOkBiDi ? 0 : LabelCacheNotOkBiDi);
+		mergeLabelInfo(info, labelInfo.labelErrors, flags);
+		mergeLabelInfo(*transInfo, labelInfo.labelErrors, flags);
+	}
+	transInfo->errors |= transInfo->labelErrors;
+	transInfo->labelErrors = 0;
+}
+
+template <uint32_t Options, bool ToASCII>
+int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const {
+	const UChar *label = dest.getBuffer() + labelStart;
+	if (labelCache == NULL || U_FAILURE(errorCode) || labelLength > LabelCacheMaxKeyLength / 2 || (info.labelErrors & severeErrors) != 0
+			|| !isLabelCacheable(label, labelLength)) {
+		return processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+	}
+	uint32_t operation = (options << 2) | 2 | (ToASCII ? 1 : 0);  // 2: UTF-16
+	CharString bytes;
+	uint32_t labelErrors, flags;
+	UBool found;
+	{
+		CharStringByteSink sink(&bytes, errorCode);
+		found = labelCache->find(operation, StringPiece((const char *) label, labelLength * 2), sink, labelErrors, flags);
+	}
+	if (U_FAILURE(errorCode)) {
+		return labelLength;
+	}
+	if (found) {
+		mergeLabelInfo(info, labelErrors, flags);
+		dest.replace(labelStart, labelLength, (const UChar *) bytes.data(), bytes.length() / 2);
+		return bytes.length() / 2;
+	}
+	if (info.checkOnly) {
+		return processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);  // no result to memoize
+	}
+	// Process with fresh label state, so that the result does not depend on the previous labels.
+	bytes.append((const char *) label, labelLength * 2, errorCode);
+	IDNAInfo labelInfo;
+	int32_t newLength = processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, labelInfo, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return newLength;
+	}
+	flags = (labelInfo.isBiDi ? LabelCacheBiDi : 0) | (labelInfo.isOkBiDi ? 0 : LabelCacheNotOkBiDi);
+	labelCache->insert(operation, bytes.toStringPiece(), StringPiece((const char *) (dest.getBuffer() + labelStart), newLength * 2),
+			labelInfo.labelErrors, flags);
+	mergeLabelInfo(info, labelInfo.labelErrors, flags);
+	return newLength;
+}
+
+template <uint32_t Options, bool ToASCII>
+int32_t UTS46::processLabelUncached(UnicodeString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const {
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	UnicodeString fromPunycode;
+	UnicodeString *labelString;
+	const UChar *label = dest.getBuffer() + labelStart;
+	int32_t destLabelStart = labelStart;
+	int32_t destLabelLength = labelLength;
+	UBool wasPunycode;
+	if (labelLength >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
+		// Label starts with "xn--", try to un-Punycode it.
+		// In IDNA2008, labels like "xn--" (decodes to an empty string) and
+		// "xn--ASCII-" (decodes to just "ASCII") fail the round-trip validation from
+		// comparing the ToUnicode input with the back-to-ToASCII output.
+		// They are alternate encodings of the respective ASCII labels.
+		// Ignore "xn---" here: It will fail Punycode.decode() which logically comes before
+		// the round-trip verification.
+		if (labelLength == 4 || (labelLength > 5 && label[labelLength - 1] == u'-')) {
+			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		wasPunycode = true;
+		UChar *unicodeBuffer = fromPunycode.getBuffer(-1);  // capacity==-1: most labels should fit
+		if (unicodeBuffer == NULL) {
+			// Should never occur if we used capacity==-1 which uses the internal buffer.
+			errorCode = U_MEMORY_ALLOCATION_ERROR;
+			return labelLength;
+		}
+		UErrorCode punycodeErrorCode = U_ZERO_ERROR;
+		int32_t unicodeLength = u_strFromPunycode(label + 4, labelLength - 4, unicodeBuffer, fromPunycode.getCapacity(),
+		NULL, &punycodeErrorCode);
+		if (punycodeErrorCode == U_BUFFER_OVERFLOW_ERROR) {
+			fromPunycode.releaseBuffer(0);
+			unicodeBuffer = fromPunycode.getBuffer(unicodeLength);
+			if (unicodeBuffer == NULL) {
+				errorCode = U_MEMORY_ALLOCATION_ERROR;
+				return labelLength;
+			}
+			punycodeErrorCode = U_ZERO_ERROR;
+			unicodeLength = u_strFromPunycode(label + 4, labelLength - 4, unicodeBuffer, fromPunycode.getCapacity(),
+			NULL, &punycodeErrorCode);
+		}
+		fromPunycode.releaseBuffer(unicodeLength);
+		if (U_FAILURE(punycodeErrorCode)) {
+			info.labelErrors |= UIDNA_ERROR_PUNYCODE;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		// Check for NFC, and for characters that are not
+		// valid or deviation characters according to the normalizer.
+		// If there is something wrong, then the string will change.
+		// Note that the normalizer passes through non-LDH ASCII and deviation characters.
+		// Deviation characters are ok in Punycode even in transitional processing.
+		// In the code further below, if we find non-LDH ASCII and we have UIDNA_USE_STD3_RULES
+		// then we will set UIDNA_ERROR_INVALID_ACE_LABEL there too.
+		UBool isValid = uts46Norm2->isNormalized(fromPunycode, errorCode);
+		if (U_FAILURE(errorCode)) {
+			return labelLength;
+		}
+		if (!isValid) {
+			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		labelString = &fromPunycode;
+		label = fromPunycode.getBuffer();
+		labelStart = 0;
+		labelLength = fromPunycode.length();
+	} else {
+		wasPunycode = false;
+		labelString = &dest;
+	}
+	// Validity check
+	if (labelLength == 0) {
 		info.labelErrors |= UIDNA_ERROR_EMPTY_LABEL;
 		return replaceLabel(dest, destLabelStart, destLabelLength, *labelString, labelLength, errorCode);
 	}
@@ -558,6 +1669,9 @@ int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t lab
 		// label ends with "-"
 		info.labelErrors |= UIDNA_ERROR_TRAILING_HYPHEN;
 	}
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return destLabelLength;  // invalid already, the rest does not matter
+	}
 	// If the label was not a Punycode label, then it was the result of
 	// mapping, normalization and label segmentation.
 	// If the label was in Punycode, then we mapped it again above
@@ -566,69 +1680,109 @@ int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t lab
 	// and we look for U+FFFD which indicates disallowed characters
 	// in a non-Punycode label or U+FFFD itself in a Punycode label.
 	// We also check for dots which can come from the input to a single-label function.
+	// The same pass feeds the contextual checks.
 	// Ok to cast away const because we own the UnicodeString.
 	UChar *s = (UChar*) label;
-	const UChar *limit = label + labelLength;
-	UChar oredChars = 0;
+	UBool isASCII = true;
 	// If we enforce STD3 rules, then ASCII characters other than LDH and dot are disallowed.
-	UBool disallowNonLDHDot = (options & UIDNA_USE_STD3_RULES) != 0;
-	do {
-		UChar c = *s;
+	UBool disallowNonLDHDot = hasOption<Options>(UIDNA_USE_STD3_RULES);
+	LabelChecker checker(hasOption<Options>(UIDNA_CHECK_BIDI), hasOption<Options>(UIDNA_CHECK_CONTEXTJ), hasOption<Options>(UIDNA_CHECK_CONTEXTO));
+	UBool needsASCIIProps = checker.needsASCIIProps();
+	// UIDNA_TRUSTED_NFC_INPUT skipped the mapping, so check the UTS #46 status of each code point instead.
+	UBool checkStatus = !wasPunycode && (options & UIDNA_TRUSTED_NFC_INPUT) != 0;
+	int32_t leadingMarkLength = 0;
+	for (int32_t i = 0; i < labelLength;) {
+		int32_t cpStart = i;
+		UChar32 c;
+		U16_NEXT(label, i, labelLength, c);
+		uint16_t props = 0;
 		if (c <= 0x7f) {
 			if (c == 0x2e) {
 				info.labelErrors |= UIDNA_ERROR_LABEL_HAS_DOT;
-				*s = 0xfffd;
+				s[cpStart] = 0xfffd;
 			} else if (disallowNonLDHDot && asciiData[c] < 0) {
 				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
-				*s = 0xfffd;
+				s[cpStart] = 0xfffd;
+			} else if (checkStatus && asciiData[c] > 0) {
+				// Map uppercase letters like the normalizer does.
+				c += 0x20;
+				s[cpStart] = (UChar) c;
+			}
+			if (needsASCIIProps) {
+				props = getIDNAProps(c);
 			}
 		} else {
-			oredChars |= c;
-			if (disallowNonLDHDot && isNonASCIIDisallowedSTD3Valid(c)) {
+			isASCII = false;
+			props = getIDNAProps(c);
+			// Some non-ASCII characters (all in the BMP) are equivalent to sequences with non-LDH ASCII characters.
+			if (disallowNonLDHDot && (props & IDNAPropsDisallowedSTD3Valid) != 0) {
 				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
-				*s = 0xfffd;
+				s[cpStart] = 0xfffd;
 			} else if (c == 0xfffd) {
 				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+			} else if (checkStatus && getIDNAPropsStatus(props) != UTS46Status::Valid) {
+				// Mapped, ignored or disallowed, none of which can occur in mapped input.
+				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+				if (i - cpStart == 1) {
+					s[cpStart] = 0xfffd;
+				} else {
+					labelString->replace(labelStart + cpStart, 2, (UChar) 0xfffd);
+					label = labelString->getBuffer() + labelStart;
+					s = (UChar*) label;
+					--labelLength;
+					--i;
+					if (labelString == &dest) {
+						destLabelLength = labelLength;
+					}
+				}
+			} else if (cpStart == 0 && (props & IDNAPropsMark) != 0) {
+				leadingMarkLength = i;
 			}
 		}
-		++s;
-	} while (s < limit);
-	// Check for a leading combining mark after other validity checks
+		checker.next(c, props);
+	}
+	// Replace a leading combining mark after the other validity checks
 	// so that we don't report UIDNA_ERROR_DISALLOWED for the U+FFFD from here.
-	UChar32 c;
-	int32_t cpLength = 0;
-	// "Unsafe" is ok because unpaired surrogates were mapped to U+FFFD.
-	U16_NEXT_UNSAFE(label, cpLength, c);
-	if ((U_GET_GC_MASK(c) & U_GC_M_MASK) != 0) {
+	if (leadingMarkLength != 0) {
 		info.labelErrors |= UIDNA_ERROR_LEADING_COMBINING_MARK;
-		labelString->replace(labelStart, cpLength, (UChar) 0xfffd);
+		labelString->replace(labelStart, leadingMarkLength, (UChar) 0xfffd);
 		label = labelString->getBuffer() + labelStart;
-		labelLength += 1 - cpLength;
+		labelLength += 1 - leadingMarkLength;
 		if (labelString == &dest) {
 			destLabelLength = labelLength;
 		}
 	}
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return destLabelLength;  // invalid already, the rest does not matter
+	}
 	if ((info.labelErrors & severeErrors) == 0) {
-		// Do contextual checks only if we do not have U+FFFD from a severe error
+		// Apply the contextual checks only if we do not have U+FFFD from a severe error
 		// because U+FFFD can make these checks fail.
-		if ((options & UIDNA_CHECK_BIDI) != 0 && (!info.isBiDi || info.isOkBiDi)) {
-			checkLabelBiDi(label, labelLength, info);
-		}
-		if ((options & UIDNA_CHECK_CONTEXTJ) != 0 && (oredChars & 0x200c) == 0x200c && !isLabelOkContextJ(label, labelLength)) {
-			info.labelErrors |= UIDNA_ERROR_CONTEXTJ;
-		}
-		if ((options & UIDNA_CHECK_CONTEXTO) != 0 && oredChars >= 0xb7) {
-			checkLabelContextO(label, labelLength, info);
-		}
-		if (toASCII) {
+		checker.finish(info);
+		if (ToASCII) {
 			if (wasPunycode) {
 				// Leave a Punycode label unchanged if it has no severe errors.
 				if (destLabelLength > 63) {
 					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 				}
 				return destLabelLength;
-			} else if (oredChars >= 0x80) {
+			} else if (!isASCII) {
 				// Contains non-ASCII characters.
+				if (info.checkOnly) {
+					// Validation only: the label stays in dest, only the length of its Punycode matters.
+					UErrorCode punycodeErrorCode = U_ZERO_ERROR;
+					int32_t punycodeLength = 4 + u_strToPunycode(label, labelLength, NULL, 0, NULL, &punycodeErrorCode);
+					if (punycodeErrorCode != U_BUFFER_OVERFLOW_ERROR) {
+						errorCode = punycodeErrorCode;
+						return destLabelLength;
+					}
+					if (punycodeLength > 63) {
+						info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
+					}
+					info.skippedLengthDelta += punycodeLength - labelLength;
+					info.skippedNonASCII += countNonASCII(label, labelLength);
+					return destLabelLength;
+				}
 				UnicodeString punycode;
 				UChar *buffer = punycode.getBuffer(63);  // 63==maximum DNS label length
 				if (buffer == NULL) {
@@ -673,7 +1827,7 @@ int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t lab
 		// then leave it but make sure it does not look valid.
 		if (wasPunycode) {
 			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
-			return markBadACELabel(dest, destLabelStart, destLabelLength, toASCII, info, errorCode);
+			return markBadACELabel<Options, ToASCII>(dest, destLabelStart, destLabelLength, info, errorCode);
 		}
 	}
 	return replaceLabel(dest, destLabelStart, destLabelLength, *labelString, labelLength, errorCode);
@@ -682,12 +1836,16 @@ int32_t UTS46::processLabel(UnicodeString &dest, int32_t labelStart, int32_t lab
 // Make sure an ACE label does not look valid.
 // Append U+FFFD if the label has only LDH characters.
 // If UIDNA_USE_STD3_RULES, also replace disallowed ASCII characters with U+FFFD.
+template <uint32_t Options, bool ToASCII>
 int32_t UTS46::markBadACELabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength,
-		UBool toASCII, IDNAInfo &info, UErrorCode &errorCode) const {
+		IDNAInfo &info, UErrorCode &errorCode) const {
 	if (U_FAILURE(errorCode)) {
 		return 0;
 	}
-	UBool disallowNonLDHDot = (options & UIDNA_USE_STD3_RULES) != 0;
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return labelLength;  // invalid already, no need to make it look so
+	}
+	UBool disallowNonLDHDot = hasOption<Options>(UIDNA_USE_STD3_RULES);
 	UBool isASCII = true;
 	UBool onlyLDH = true;
 	const UChar *label = dest.getBuffer() + labelStart;
@@ -720,358 +1878,540 @@ int32_t UTS46::markBadACELabel(UnicodeString &dest, int32_t labelStart, int32_t
 		}
 		++labelLength;
 	} else {
-		if (toASCII && isASCII && labelLength > 63) {
+		if (ToASCII && isASCII && labelLength > 63) {
 			info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 		}
 	}
 	return labelLength;
 }
 
-const uint32_t L_MASK = U_MASK(U_LEFT_TO_RIGHT);
-const uint32_t R_AL_MASK = U_MASK(U_RIGHT_TO_LEFT) | U_MASK(U_RIGHT_TO_LEFT_ARABIC);
-const uint32_t L_R_AL_MASK = L_MASK | R_AL_MASK;
-
-const uint32_t R_AL_AN_MASK = R_AL_MASK | U_MASK(U_ARABIC_NUMBER);
+// UTF-8 version of replaceLabel().
+static int32_t replaceLabel(CharString &dest, int32_t destLabelStart, int32_t destLabelLength,
+		const CharString &label, int32_t labelLength, UErrorCode &errorCode) {
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	if (&label != &dest) {
+		dest.replace(destLabelStart, destLabelLength, label.data(), labelLength, errorCode);
+		if (U_FAILURE(errorCode)) {
+			return 0;
+		}
+	}
+	return labelLength;
+}
 
-const uint32_t EN_AN_MASK = U_MASK(U_EUROPEAN_NUMBER) | U_MASK(U_ARABIC_NUMBER);
-const uint32_t R_AL_EN_AN_MASK = R_AL_MASK | EN_AN_MASK;
-const uint32_t L_EN_MASK = L_MASK | U_MASK(U_EUROPEAN_NUMBER);
+// Replaces the length bytes at start with U+FFFD and returns the change in length.
+static inline int32_t replaceWithFFFD(CharString &s, int32_t start, int32_t length, UErrorCode &errorCode) {
+	s.replace(start, length, "\xef\xbf\xbd", 3, errorCode);
+	return 3 - length;
+}
 
-const uint32_t ES_CS_ET_ON_BN_NSM_MASK =
-	U_MASK(U_EUROPEAN_NUMBER_SEPARATOR) |
-	U_MASK(U_COMMON_NUMBER_SEPARATOR) |
-	U_MASK(U_EUROPEAN_NUMBER_TERMINATOR) |
-	U_MASK(U_OTHER_NEUTRAL) |
-	U_MASK(U_BOUNDARY_NEUTRAL) |
-	U_MASK(U_DIR_NON_SPACING_MARK);
-const uint32_t L_EN_ES_CS_ET_ON_BN_NSM_MASK = L_EN_MASK | ES_CS_ET_ON_BN_NSM_MASK;
-const uint32_t R_AL_AN_EN_ES_CS_ET_ON_BN_NSM_MASK = R_AL_MASK | EN_AN_MASK | ES_CS_ET_ON_BN_NSM_MASK;
-
-// We scan the whole label and check both for whether it contains RTL characters
-// and whether it passes the BiDi Rule.
-// In a BiDi domain name, all labels must pass the BiDi Rule, but we might find
-// that a domain name is a BiDi domain name (has an RTL label) only after
-// processing several earlier labels.
-void UTS46::checkLabelBiDi(const UChar *label, int32_t labelLength, IDNAInfo &info) const {
-	// IDNA2008 BiDi rule
-	// Get the directionality of the first character.
-	UChar32 c;
-	int32_t i = 0;
-	U16_NEXT_UNSAFE(label, i, c);
-	uint32_t firstMask = U_MASK(u_charDirection(c));
-	// 1. The first character must be a character with BIDI property L, R
-	// or AL.  If it has the R or AL property, it is an RTL label; if it
-	// has the L property, it is an LTR label.
-	if ((firstMask & ~L_R_AL_MASK) != 0) {
-		info.isOkBiDi = false;
+// Appends "xn--" and the Punycode of the label to dest, returns the length of the appended ACE label.
+static int32_t appendACELabel(const char *label, int32_t labelLength, CharString &dest, UErrorCode &errorCode) {
+	dest.append("xn--", 4, errorCode);
+	int32_t capacity;
+	char *buffer = dest.getAppendBuffer(59, 59, capacity, errorCode);  // 63==maximum DNS label length
+	if (U_FAILURE(errorCode)) {
+		return 0;
 	}
-	// Get the directionality of the last non-NSM character.
-	uint32_t lastMask;
-	for (;;) {
-		if (i >= labelLength) {
-			lastMask = firstMask;
-			break;
-		}
-		U16_PREV_UNSAFE(label, labelLength, c);
-		UCharDirection dir = u_charDirection(c);
-		if (dir != U_DIR_NON_SPACING_MARK) {
-			lastMask = U_MASK(dir);
-			break;
+	int32_t punycodeLength = u_strToPunycodeUTF8(label, labelLength, buffer, capacity, &errorCode);
+	if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+		errorCode = U_ZERO_ERROR;
+		buffer = dest.getAppendBuffer(punycodeLength, punycodeLength, capacity, errorCode);
+		if (U_FAILURE(errorCode)) {
+			return 0;
 		}
+		punycodeLength = u_strToPunycodeUTF8(label, labelLength, buffer, capacity, &errorCode);
 	}
-	// 3. In an RTL label, the end of the label must be a character with
-	// BIDI property R, AL, EN or AN, followed by zero or more
-	// characters with BIDI property NSM.
-	// 6. In an LTR label, the end of the label must be a character with
-	// BIDI property L or EN, followed by zero or more characters with
-	// BIDI property NSM.
-	if ((firstMask & L_MASK) != 0 ? (lastMask & ~L_EN_MASK) != 0 : (lastMask & ~R_AL_EN_AN_MASK) != 0) {
-		info.isOkBiDi = false;
+	if (U_FAILURE(errorCode)) {
+		return 0;
 	}
-	// Add the directionalities of the intervening characters.
-	uint32_t mask = firstMask | lastMask;
-	while (i < labelLength) {
-		U16_NEXT_UNSAFE(label, i, c);
-		mask |= U_MASK(u_charDirection(c));
+	if (errorCode == U_STRING_NOT_TERMINATED_WARNING) {
+		errorCode = U_ZERO_ERROR;  // CharString terminates itself.
 	}
-	if (firstMask & L_MASK) {
-		// 5. In an LTR label, only characters with the BIDI properties L, EN,
-		// ES, CS, ET, ON, BN and NSM are allowed.
-		if ((mask & ~L_EN_ES_CS_ET_ON_BN_NSM_MASK) != 0) {
-			info.isOkBiDi = false;
-		}
-	} else {
-		// 2. In an RTL label, only characters with the BIDI properties R, AL,
-		// AN, EN, ES, CS, ET, ON, BN and NSM are allowed.
-		if ((mask & ~R_AL_AN_EN_ES_CS_ET_ON_BN_NSM_MASK) != 0) {
-			info.isOkBiDi = false;
+	dest.append(buffer, punycodeLength, errorCode);
+	return 4 + punycodeLength;
+}
+
+// The UTF-16 version checks the third and fourth code units,
+// so skip the first two UTF-16 code units' worth of characters here.
+static UBool hasHyphen3_4(const char *label, int32_t labelLength) {
+	int32_t i = 0, units = 0;
+	while (units < 2 && i < labelLength) {
+		UChar32 c;
+		U8_NEXT(label, i, labelLength, c);
+		units += c < 0 ? 1 : U16_LENGTH(c);
+	}
+	return units == 2 && (i + 1) < labelLength && label[i] == 0x2d && label[i + 1] == 0x2d;
+}
+
+template <uint32_t Options>
+void UTS46::processBothLabel(CharString &asciiDest, int32_t asciiLabelStart, IDNAInfo &asciiInfo,
+		CharString &unicodeDest, int32_t unicodeLabelStart, IDNAInfo &unicodeInfo, UBool hasASCIILabel, UBool atEnd,
+		UErrorCode &errorCode) const {
+	// Permit an empty label at the end, see processUnicodeUTF8(). Removing ZWJ/ZWNJ can empty
+	// the label of one direction only.
+	int32_t labelLength = unicodeDest.length() - unicodeLabelStart;
+	UBool isUnicodeRoot = atEnd && 0 < unicodeLabelStart && labelLength == 0;
+	if (hasASCIILabel) {
+		// The mapped labels differ, process both.
+		int32_t asciiLabelLength = asciiDest.length() - asciiLabelStart;
+		if (!(atEnd && 0 < asciiLabelStart && asciiLabelLength == 0)) {
+			processLabel<Options, true>(asciiDest, asciiLabelStart, asciiLabelLength, asciiInfo, errorCode);
 		}
-		// 4. In an RTL label, if an EN is present, no AN may be present, and
-		// vice versa.
-		if ((mask & EN_AN_MASK) == EN_AN_MASK) {
-			info.isOkBiDi = false;
+		if (!isUnicodeRoot) {
+			processLabel<Options, false>(unicodeDest, unicodeLabelStart, labelLength, unicodeInfo, errorCode);
 		}
+		return;
 	}
-	// An RTL label is a label that contains at least one character of type
-	// R, AL or AN. [...]
-	// A "BIDI domain name" is a domain name that contains at least one RTL
-	// label. [...]
-	// The following rule, consisting of six conditions, applies to labels
-	// in BIDI domain names.
-	if ((mask & R_AL_AN_MASK) != 0) {
-		info.isBiDi = true;
+	if (isUnicodeRoot) {
+		return;
 	}
-}
-
-// Special code for the ASCII prefix of a BiDi domain name.
-// The ASCII prefix is all-LTR.
-
-// IDNA2008 BiDi rule, parts relevant to ASCII labels:
-// 1. The first character must be a character with BIDI property L [...]
-// 5. In an LTR label, only characters with the BIDI properties L, EN,
-// ES, CS, ET, ON, BN and NSM are allowed.
-// 6. In an LTR label, the end of the label must be a character with
-// BIDI property L or EN [...]
-
-// UTF-16 version, called for mapped ASCII prefix.
-// Cannot contain uppercase A-Z.
-// s[length-1] must be the trailing dot.
-static UBool isASCIIOkBiDi(const UChar *s, int32_t length) {
-	int32_t labelStart = 0;
-	for (int32_t i = 0; i < length; ++i) {
-		UChar c = s[i];
-		if (c == 0x2e) {  // dot
-			if (i > labelStart) {
-				c = s[i - 1];
-				if (!(0x61 <= c && c <= 0x7a) && !(0x30 <= c && c <= 0x39)) {
-					// Last character in the label is not an L or EN.
-					return false;
-				}
-			}
-			labelStart = i + 1;
-		} else if (i == labelStart) {
-			if (!(0x61 <= c && c <= 0x7a)) {
-				// First character in the label is not an L.
-				return false;
-			}
+	// toASCII processing differs from toUnicode only for a label without severe errors:
+	// it leaves a Punycode label as is instead of decoding it, encodes a non-ASCII label,
+	// and checks the label length (that of a bad ACE label too, see markBadACELabel()).
+	// Otherwise a non-Punycode label comes out of the toUnicode processing unchanged.
+	const char *label = unicodeDest.data() + unicodeLabelStart;
+	UBool isACE = labelLength >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d;
+	if (isACE) {
+		appendSubstring(asciiDest, unicodeDest, unicodeLabelStart, labelLength, errorCode);
+	}
+	// Fresh label state as for the label cache, so that it can be added to both infos.
+	IDNAInfo labelInfo;
+	processLabel<Options, false>(unicodeDest, unicodeLabelStart, labelLength, labelInfo, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return;
+	}
+	label = unicodeDest.data() + unicodeLabelStart;
+	labelLength = unicodeDest.length() - unicodeLabelStart;
+	UBool isValid = (labelInfo.labelErrors & severeErrors) == 0;
+	if (!isValid || !isACE) {
+		asciiDest.truncate(asciiLabelStart);
+		if (isValid && countNonASCII(label, labelLength) != 0) {
+			appendACELabel(label, labelLength, asciiDest, errorCode);
 		} else {
-			if (c <= 0x20 && (c >= 0x1c || (9 <= c && c <= 0xd))) {
-				// Intermediate character in the label is a B, S or WS.
-				return false;
-			}
+			asciiDest.append(label, labelLength, errorCode);
 		}
 	}
-	return true;
+	uint32_t asciiLabelErrors = labelInfo.labelErrors;
+	int32_t asciiLabelLength = asciiDest.length() - asciiLabelStart;
+	if (asciiLabelLength > 63 && (isValid || (isACE && countNonASCII(asciiDest.data() + asciiLabelStart, asciiLabelLength) == 0))) {
+		asciiLabelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
+	}
+	uint32_t flags = (labelInfo.isBiDi ? LabelCacheBiDi : 0) | (labelInfo.isOkBiDi ? 0 : LabelCacheNotOkBiDi);
+	mergeLabelInfo(asciiInfo, asciiLabelErrors, flags);
+	mergeLabelInfo(unicodeInfo, labelInfo.labelErrors, flags);
 }
 
-// UTF-8 version, called for source ASCII prefix.
-// Can contain uppercase A-Z.
-// s[length-1] must be the trailing dot.
-static UBool isASCIIOkBiDi(const char *s, int32_t length) {
-	int32_t labelStart = 0;
-	for (int32_t i = 0; i < length; ++i) {
-		char c = s[i];
-		if (c == 0x2e) {  // dot
-			if (i > labelStart) {
-				c = s[i - 1];
-				if (!(0x61 <= c && c <= 0x7a) && !(0x41 <= c && c <= 0x5a) && !(0x30 <= c && c <= 0x39)) {
-					// Last character in the label is not an L or EN.
-					return false;
-				}
-			}
-			labelStart = i + 1;
-		} else if (i == labelStart) {
-			if (!(0x61 <= c && c <= 0x7a) && !(0x41 <= c && c <= 0x5a)) {
-				// First character in the label is not an L.
-				return false;
-			}
-		} else {
-			if (c <= 0x20 && (c >= 0x1c || (9 <= c && c <= 0xd))) {
-				// Intermediate character in the label is a B, S or WS.
-				return false;
-			}
-		}
+template <uint32_t Options, bool ToASCII>
+int32_t UTS46::processLabel(CharString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const {
+	const char *label = dest.data() + labelStart;
+	if (labelCache == NULL || U_FAILURE(errorCode) || labelLength > LabelCacheMaxKeyLength || (info.labelErrors & severeErrors) != 0
+			|| !isLabelCacheable(label, labelLength)) {
+		return processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+	}
+	uint32_t operation = (options << 2) | (ToASCII ? 1 : 0);
+	CharString bytes;
+	uint32_t labelErrors, flags;
+	UBool found;
+	{
+		CharStringByteSink sink(&bytes, errorCode);
+		found = labelCache->find(operation, StringPiece(label, labelLength), sink, labelErrors, flags);
 	}
-	return true;
+	if (U_FAILURE(errorCode)) {
+		return labelLength;
+	}
+	if (found) {
+		mergeLabelInfo(info, labelErrors, flags);
+		return replaceLabel(dest, labelStart, labelLength, bytes, bytes.length(), errorCode);
+	}
+	if (info.checkOnly) {
+		return processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);  // no result to memoize
+	}
+	// Process with fresh label state, see the UTF-16 version.
+	bytes.append(label, labelLength, errorCode);
+	IDNAInfo labelInfo;
+	int32_t newLength = processLabelUncached<Options, ToASCII>(dest, labelStart, labelLength, labelInfo, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return newLength;
+	}
+	flags = (labelInfo.isBiDi ? LabelCacheBiDi : 0) | (labelInfo.isOkBiDi ? 0 : LabelCacheNotOkBiDi);
+	labelCache->insert(operation, bytes.toStringPiece(), StringPiece(dest.data() + labelStart, newLength), labelInfo.labelErrors, flags);
+	mergeLabelInfo(info, labelInfo.labelErrors, flags);
+	return newLength;
 }
 
-UBool UTS46::isLabelOkContextJ(const UChar *label, int32_t labelLength) const {
-	// [IDNA2008-Tables]
-	// 200C..200D  ; CONTEXTJ    # ZERO WIDTH NON-JOINER..ZERO WIDTH JOINER
-	for (int32_t i = 0; i < labelLength; ++i) {
-		if (label[i] == 0x200c) {
-			// Appendix A.1. ZERO WIDTH NON-JOINER
-			// Rule Set:
-			//  False;
-			//  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
-			//  If RegExpMatch((Joining_Type:{L,D})(Joining_Type:T)*\u200C
-			//     (Joining_Type:T)*(Joining_Type:{R,D})) Then True;
-			if (i == 0) {
-				return false;
-			}
-			UChar32 c;
-			int32_t j = i;
-			U16_PREV_UNSAFE(label, j, c);
-			if (uts46Norm2->getCombiningClass(c) == 9) {
-				continue;
+template <uint32_t Options, bool ToASCII>
+int32_t UTS46::processLabelUncached(CharString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const {
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	CharString fromPunycode;
+	CharString *labelString;
+	const char *label = dest.data() + labelStart;
+	int32_t destLabelStart = labelStart;
+	int32_t destLabelLength = labelLength;
+	UBool wasPunycode;
+	if (labelLength >= 4 && label[0] == 0x78 && label[1] == 0x6e && label[2] == 0x2d && label[3] == 0x2d) {
+		// Label starts with "xn--", try to un-Punycode it.
+		// See the UTF-16 version for the handling of "xn--" and "xn--ASCII-".
+		if (labelLength == 4 || (labelLength > 5 && label[labelLength - 1] == '-')) {
+			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		wasPunycode = true;
+		int32_t capacity;
+		char *unicodeBuffer = fromPunycode.getAppendBuffer(1, labelLength, capacity, errorCode);  // most labels should fit
+		if (U_FAILURE(errorCode)) {
+			return labelLength;
+		}
+		UErrorCode punycodeErrorCode = U_ZERO_ERROR;
+		int32_t unicodeLength = u_strFromPunycodeUTF8(label + 4, labelLength - 4, unicodeBuffer, capacity, &punycodeErrorCode);
+		if (punycodeErrorCode == U_BUFFER_OVERFLOW_ERROR) {
+			unicodeBuffer = fromPunycode.getAppendBuffer(unicodeLength, unicodeLength, capacity, errorCode);
+			if (U_FAILURE(errorCode)) {
+				return labelLength;
 			}
-			// check precontext (Joining_Type:{L,D})(Joining_Type:T)*
-			for (;;) {
-				UJoiningType type = ubidi_getJoiningType(c);
-				if (type == U_JT_TRANSPARENT) {
-					if (j == 0) {
-						return false;
-					}
-					U16_PREV_UNSAFE(label, j, c);
-				} else if (type == U_JT_LEFT_JOINING || type == U_JT_DUAL_JOINING) {
-					break;  // precontext fulfilled
-				} else {
-					return false;
-				}
+			punycodeErrorCode = U_ZERO_ERROR;
+			unicodeLength = u_strFromPunycodeUTF8(label + 4, labelLength - 4, unicodeBuffer, capacity, &punycodeErrorCode);
+		}
+		if (U_FAILURE(punycodeErrorCode)) {
+			info.labelErrors |= UIDNA_ERROR_PUNYCODE;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		fromPunycode.append(unicodeBuffer, unicodeLength, errorCode);
+		// Check for NFC, and for characters that are not
+		// valid or deviation characters according to the normalizer.
+		UBool isValid = uts46Norm2->isNormalizedUTF8(fromPunycode.toStringPiece(), errorCode);
+		if (U_FAILURE(errorCode)) {
+			return labelLength;
+		}
+		if (!isValid) {
+			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
+			return markBadACELabel<Options, ToASCII>(dest, labelStart, labelLength, info, errorCode);
+		}
+		labelString = &fromPunycode;
+		label = fromPunycode.data();
+		labelStart = 0;
+		labelLength = fromPunycode.length();
+	} else {
+		wasPunycode = false;
+		labelString = &dest;
+	}
+	// Validity check
+	if (labelLength == 0) {
+		info.labelErrors |= UIDNA_ERROR_EMPTY_LABEL;
+		return replaceLabel(dest, destLabelStart, destLabelLength, *labelString, labelLength, errorCode);
+	}
+	// labelLength>0
+	if (labelLength >= 4 && hasHyphen3_4(label, labelLength)) {
+		// label starts with "??--"
+		info.labelErrors |= UIDNA_ERROR_HYPHEN_3_4;
+	}
+	if (label[0] == 0x2d) {
+		// label starts with "-"
+		info.labelErrors |= UIDNA_ERROR_LEADING_HYPHEN;
+	}
+	if (label[labelLength - 1] == 0x2d) {
+		// label ends with "-"
+		info.labelErrors |= UIDNA_ERROR_TRAILING_HYPHEN;
+	}
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return destLabelLength;  // invalid already, the rest does not matter
+	}
+	// Same checks as in the UTF-16 version.
+	// A replacement U+FFFD is longer than an ASCII character,
+	// so track indexes and refresh the label pointer after each replacement.
+	UBool isASCII = true;
+	// If we enforce STD3 rules, then ASCII characters other than LDH and dot are disallowed.
+	UBool disallowNonLDHDot = hasOption<Options>(UIDNA_USE_STD3_RULES);
+	LabelChecker checker(hasOption<Options>(UIDNA_CHECK_BIDI), hasOption<Options>(UIDNA_CHECK_CONTEXTJ), hasOption<Options>(UIDNA_CHECK_CONTEXTO));
+	UBool needsASCIIProps = checker.needsASCIIProps();
+	UBool checkStatus = !wasPunycode && (options & UIDNA_TRUSTED_NFC_INPUT) != 0;
+	int32_t leadingMarkLength = 0;
+	for (int32_t i = 0; i < labelLength;) {
+		int32_t cpStart = i;
+		UChar32 c;
+		U8_NEXT(label, i, labelLength, c);
+		uint16_t props = 0;
+		int32_t delta = 0;
+		if (c < 0) {
+			// Ill-formed sequences were replaced before; be safe anyway.
+			info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+			delta = replaceWithFFFD(*labelString, labelStart + cpStart, i - cpStart, errorCode);
+		} else if (c <= 0x7f) {
+			if (c == 0x2e) {
+				info.labelErrors |= UIDNA_ERROR_LABEL_HAS_DOT;
+				delta = replaceWithFFFD(*labelString, labelStart + cpStart, 1, errorCode);
+			} else if (disallowNonLDHDot && asciiData[c] < 0) {
+				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+				delta = replaceWithFFFD(*labelString, labelStart + cpStart, 1, errorCode);
+			} else if (checkStatus && asciiData[c] > 0) {
+				c += 0x20;
+				labelString->data()[labelStart + cpStart] = (char) c;
 			}
-			// check postcontext (Joining_Type:T)*(Joining_Type:{R,D})
-			for (j = i + 1;;) {
-				if (j == labelLength) {
-					return false;
-				}
-				U16_NEXT_UNSAFE(label, j, c);
-				UJoiningType type = ubidi_getJoiningType(c);
-				if (type == U_JT_TRANSPARENT) {
-					// just skip this character
-				} else if (type == U_JT_RIGHT_JOINING || type == U_JT_DUAL_JOINING) {
-					break;  // postcontext fulfilled
-				} else {
-					return false;
-				}
+			if (needsASCIIProps) {
+				props = getIDNAProps(c);
 			}
-		} else if (label[i] == 0x200d) {
-			// Appendix A.2. ZERO WIDTH JOINER (U+200D)
-			// Rule Set:
-			//  False;
-			//  If Canonical_Combining_Class(Before(cp)) .eq.  Virama Then True;
-			if (i == 0) {
-				return false;
+		} else {
+			isASCII = false;
+			props = getIDNAProps(c);
+			if (disallowNonLDHDot && (props & IDNAPropsDisallowedSTD3Valid) != 0) {
+				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+				delta = replaceWithFFFD(*labelString, labelStart + cpStart, i - cpStart, errorCode);
+			} else if (c == 0xfffd) {
+				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+			} else if (checkStatus && getIDNAPropsStatus(props) != UTS46Status::Valid) {
+				info.labelErrors |= UIDNA_ERROR_DISALLOWED;
+				delta = replaceWithFFFD(*labelString, labelStart + cpStart, i - cpStart, errorCode);
+			} else if (cpStart == 0 && (props & IDNAPropsMark) != 0) {
+				leadingMarkLength = i;
 			}
-			UChar32 c;
-			int32_t j = i;
-			U16_PREV_UNSAFE(label, j, c);
-			if (uts46Norm2->getCombiningClass(c) != 9) {
-				return false;
+		}
+		if (U_FAILURE(errorCode)) {
+			return destLabelLength;
+		}
+		if (delta != 0) {
+			i += delta;
+			labelLength += delta;
+			label = labelString->data() + labelStart;
+			if (labelString == &dest) {
+				destLabelLength = labelLength;
 			}
 		}
+		checker.next(c, props);
 	}
-	return true;
-}
-
-void UTS46::checkLabelContextO(const UChar *label, int32_t labelLength, IDNAInfo &info) const {
-	int32_t labelEnd = labelLength - 1;  // inclusive
-	int32_t arabicDigits = 0;  // -1 for 066x, +1 for 06Fx
-	for (int32_t i = 0; i <= labelEnd; ++i) {
-		UChar32 c = label[i];
-		if (c < 0xb7) {
-			// ASCII fastpath
-		} else if (c <= 0x6f9) {
-			if (c == 0xb7) {
-				// Appendix A.3. MIDDLE DOT (U+00B7)
-				// Rule Set:
-				//  False;
-				//  If Before(cp) .eq.  U+006C And
-				//     After(cp) .eq.  U+006C Then True;
-				if (!(0 < i && label[i - 1] == 0x6c && i < labelEnd && label[i + 1] == 0x6c)) {
-					info.labelErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
-				}
-			} else if (c == 0x375) {
-				// Appendix A.4. GREEK LOWER NUMERAL SIGN (KERAIA) (U+0375)
-				// Rule Set:
-				//  False;
-				//  If Script(After(cp)) .eq.  Greek Then True;
-				UScriptCode script = USCRIPT_INVALID_CODE;
-				if (i < labelEnd) {
-					UErrorCode errorCode = U_ZERO_ERROR;
-					int32_t j = i + 1;
-					U16_NEXT(label, j, labelLength, c);
-					script = uscript_getScript(c, &errorCode);
+	// Replace a leading combining mark after the other validity checks
+	// so that we don't report UIDNA_ERROR_DISALLOWED for the U+FFFD from here.
+	if (leadingMarkLength != 0) {
+		info.labelErrors |= UIDNA_ERROR_LEADING_COMBINING_MARK;
+		labelLength += replaceWithFFFD(*labelString, labelStart, leadingMarkLength, errorCode);
+		if (U_FAILURE(errorCode)) {
+			return destLabelLength;
+		}
+		label = labelString->data() + labelStart;
+		if (labelString == &dest) {
+			destLabelLength = labelLength;
+		}
+	}
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return destLabelLength;  // invalid already, the rest does not matter
+	}
+	if ((info.labelErrors & severeErrors) == 0) {
+		// Apply the contextual checks only if we do not have U+FFFD from a severe error
+		// because U+FFFD can make these checks fail.
+		checker.finish(info);
+		if (ToASCII) {
+			if (wasPunycode) {
+				// Leave a Punycode label unchanged if it has no severe errors.
+				if (destLabelLength > 63) {
+					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 				}
-				if (script != USCRIPT_GREEK) {
-					info.labelErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
+				return destLabelLength;
+			} else if (!isASCII) {
+				// Contains non-ASCII characters.
+				if (info.checkOnly) {
+					// Validation only, see the UTF-16 version.
+					UErrorCode punycodeErrorCode = U_ZERO_ERROR;
+					int32_t punycodeLength = 4 + u_strToPunycodeUTF8(label, labelLength, NULL, 0, &punycodeErrorCode);
+					if (punycodeErrorCode != U_BUFFER_OVERFLOW_ERROR) {
+						errorCode = punycodeErrorCode;
+						return destLabelLength;
+					}
+					if (punycodeLength > 63) {
+						info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
+					}
+					info.skippedLengthDelta += punycodeLength - labelLength;
+					info.skippedNonASCII += countNonASCII(label, labelLength);
+					return destLabelLength;
 				}
-			} else if (c == 0x5f3 || c == 0x5f4) {
-				// Appendix A.5. HEBREW PUNCTUATION GERESH (U+05F3)
-				// Rule Set:
-				//  False;
-				//  If Script(Before(cp)) .eq.  Hebrew Then True;
-				//
-				// Appendix A.6. HEBREW PUNCTUATION GERSHAYIM (U+05F4)
-				// Rule Set:
-				//  False;
-				//  If Script(Before(cp)) .eq.  Hebrew Then True;
-				UScriptCode script = USCRIPT_INVALID_CODE;
-				if (0 < i) {
-					UErrorCode errorCode = U_ZERO_ERROR;
-					int32_t j = i;
-					U16_PREV(label, 0, j, c);
-					script = uscript_getScript(c, &errorCode);
+				CharString punycode;
+				int32_t punycodeLength = appendACELabel(label, labelLength, punycode, errorCode);
+				if (U_FAILURE(errorCode)) {
+					return destLabelLength;
 				}
-				if (script != USCRIPT_HEBREW) {
-					info.labelErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
+				if (punycodeLength > 63) {
+					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 				}
-			} else if (0x660 <= c /* && c<=0x6f9 */) {
-				// Appendix A.8. ARABIC-INDIC DIGITS (0660..0669)
-				// Rule Set:
-				//  True;
-				//  For All Characters:
-				//    If cp .in. 06F0..06F9 Then False;
-				//  End For;
-				//
-				// Appendix A.9. EXTENDED ARABIC-INDIC DIGITS (06F0..06F9)
-				// Rule Set:
-				//  True;
-				//  For All Characters:
-				//    If cp .in. 0660..0669 Then False;
-				//  End For;
-				if (c <= 0x669) {
-					if (arabicDigits > 0) {
-						info.labelErrors |= UIDNA_ERROR_CONTEXTO_DIGITS;
-					}
-					arabicDigits = -1;
-				} else if (0x6f0 <= c) {
-					if (arabicDigits < 0) {
-						info.labelErrors |= UIDNA_ERROR_CONTEXTO_DIGITS;
-					}
-					arabicDigits = 1;
+				return replaceLabel(dest, destLabelStart, destLabelLength, punycode, punycodeLength, errorCode);
+			} else {
+				// all-ASCII label
+				if (labelLength > 63) {
+					info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 				}
 			}
-		} else if (c == 0x30fb) {
-			// Appendix A.7. KATAKANA MIDDLE DOT (U+30FB)
-			// Rule Set:
-			//  False;
-			//  For All Characters:
-			//    If Script(cp) .in. {Hiragana, Katakana, Han} Then True;
-			//  End For;
-			UErrorCode errorCode = U_ZERO_ERROR;
-			for (int j = 0;;) {
-				if (j > labelEnd) {
-					info.labelErrors |= UIDNA_ERROR_CONTEXTO_PUNCTUATION;
-					break;
-				}
-				U16_NEXT(label, j, labelLength, c);
-				UScriptCode script = uscript_getScript(c, &errorCode);
-				if (script == USCRIPT_HIRAGANA || script == USCRIPT_KATAKANA || script == USCRIPT_HAN) {
-					break;
+		}
+	} else {
+		// If a Punycode label has severe errors,
+		// then leave it but make sure it does not look valid.
+		if (wasPunycode) {
+			info.labelErrors |= UIDNA_ERROR_INVALID_ACE_LABEL;
+			return markBadACELabel<Options, ToASCII>(dest, destLabelStart, destLabelLength, info, errorCode);
+		}
+	}
+	return replaceLabel(dest, destLabelStart, destLabelLength, *labelString, labelLength, errorCode);
+}
+
+template <uint32_t Options, bool ToASCII>
+int32_t UTS46::markBadACELabel(CharString &dest, int32_t labelStart, int32_t labelLength,
+		IDNAInfo &info, UErrorCode &errorCode) const {
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	if ((info.labelErrors & info.stopErrors) != 0) {
+		return labelLength;  // invalid already, no need to make it look so
+	}
+	UBool disallowNonLDHDot = hasOption<Options>(UIDNA_USE_STD3_RULES);
+	UBool isASCII = true;
+	UBool onlyLDH = true;
+	// Start after the initial "xn--".
+	for (int32_t i = labelStart + 4; i < labelStart + labelLength; ++i) {
+		uint8_t c = dest[i];
+		if (c <= 0x7f) {
+			if (c == 0x2e) {
+				info.labelErrors |= UIDNA_ERROR_LABEL_HAS_DOT;
+				replaceWithFFFD(dest, i, 1, errorCode);
+				labelLength += 2;
+				i += 2;
+				isASCII = onlyLDH = false;
+			} else if (asciiData[c] < 0) {
+				onlyLDH = false;
+				if (disallowNonLDHDot) {
+					replaceWithFFFD(dest, i, 1, errorCode);
+					labelLength += 2;
+					i += 2;
+					isASCII = false;
 				}
 			}
+		} else {
+			isASCII = onlyLDH = false;
+		}
+	}
+	if (onlyLDH) {
+		replaceWithFFFD(dest, labelStart + labelLength, 0, errorCode);
+		labelLength += 3;
+	} else {
+		if (ToASCII && isASCII && labelLength > 63) {
+			info.labelErrors |= UIDNA_ERROR_LABEL_TOO_LONG;
 		}
 	}
+	if (U_FAILURE(errorCode)) {
+		return 0;
+	}
+	return labelLength;
 }
 
 U_CAPI UIDNA *uidna_open(uint32_t options, UErrorCode *pErrorCode) {
-	return (UIDNA *)new UTS46(options, *pErrorCode);
+	UTS46 *uts46 = new UTS46(options, *pErrorCode);
+	if (uts46 == NULL) {
+		*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+	}
+	return (UIDNA *)uts46;
 }
 
 U_CAPI void uidna_close(UIDNA *idna) {
 	delete reinterpret_cast<UTS46*>(idna);
 }
 
+U_CAPI void uidna_setCache(UIDNA *idna, int64_t memoryBudget, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if (idna == NULL || memoryBudget < 0) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	IDNACache *cache = NULL;
+	if (memoryBudget > 0) {
+		cache = new IDNACache(size_t(memoryBudget));
+		if (cache == NULL || !cache->isValid()) {
+			delete cache;
+			*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+			return;
+		}
+	}
+	reinterpret_cast<UTS46*>(idna)->setCache(cache);
+}
+
+U_CAPI void uidna_setLabelCache(UIDNA *idna, int64_t memoryBudget, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if (idna == NULL || memoryBudget < 0) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	IDNACache *cache = NULL;
+	if (memoryBudget > 0) {
+		cache = new IDNACache(size_t(memoryBudget));
+		if (cache == NULL || !cache->isValid()) {
+			delete cache;
+			*pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+			return;
+		}
+	}
+	reinterpret_cast<UTS46*>(idna)->setLabelCache(cache);
+}
+
+U_CAPI void uidna_setCallArena(UIDNA *idna, int32_t capacity, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if (idna == NULL || capacity < 0) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	reinterpret_cast<UTS46*>(idna)->setCallArenaSize(capacity);
+}
+
+U_CAPI void uidna_setFailFastErrors(UIDNA *idna, uint32_t errors, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if (idna == NULL) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	reinterpret_cast<UTS46*>(idna)->setFailFastErrors(errors);
+}
+
+static void getCacheStats(const IDNACache *cache, UIDNACacheStats *pStats, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return;
+	}
+	if (pStats == NULL) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	if (cache == NULL) {
+		pStats->hits = pStats->misses = pStats->evictions = pStats->entries = pStats->memoryUsed = 0;
+		return;
+	}
+	uint64_t hits, misses, evictions, entries, memoryUsed;
+	cache->getStats(hits, misses, evictions, entries, memoryUsed);
+	pStats->hits = hits;
+	pStats->misses = misses;
+	pStats->evictions = evictions;
+	pStats->entries = entries;
+	pStats->memoryUsed = memoryUsed;
+}
+
+U_CAPI void uidna_getCacheStats(const UIDNA *idna, UIDNACacheStats *pStats, UErrorCode *pErrorCode) {
+	if (idna == NULL && U_SUCCESS(*pErrorCode)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	getCacheStats(idna != NULL ? reinterpret_cast<const UTS46*>(idna)->getCache() : NULL, pStats, pErrorCode);
+}
+
+U_CAPI void uidna_getLabelCacheStats(const UIDNA *idna, UIDNACacheStats *pStats, UErrorCode *pErrorCode) {
+	if (idna == NULL && U_SUCCESS(*pErrorCode)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return;
+	}
+	getCacheStats(idna != NULL ? reinterpret_cast<const UTS46*>(idna)->getLabelCache() : NULL, pStats, pErrorCode);
+}
+
 static UBool checkArgs(const void *label, int32_t length, void *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
 	if (U_FAILURE(*pErrorCode)) {
 		return false;
@@ -1095,11 +2435,18 @@ static void idnaInfoToStruct(IDNAInfo &info, UIDNAInfo *pInfo) {
 	}
 }
 
+// The length of a UTF-8 result, 0 for one that stopped at a fail-fast error:
+// a sink may have received its completed labels before the error.
+static int32_t resultLength(const UIDNA *idna, const IDNAInfo &info, const CheckedArrayByteSink &sink) {
+	return reinterpret_cast<const UTS46*>(idna)->hasFailFastError(info) ? 0 : sink.NumberOfBytesAppended();
+}
+
 U_CAPI int32_t uidna_labelToASCII(const UIDNA *idna, const UChar *label, int32_t length,
 		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
 	if (!checkArgs(label, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	UnicodeString src((UBool) (length < 0), label, length);
 	UnicodeString destString(dest, 0, capacity);
 	IDNAInfo info;
@@ -1113,6 +2460,7 @@ U_CAPI int32_t uidna_labelToUnicode(const UIDNA *idna, const UChar *label, int32
 	if (!checkArgs(label, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	UnicodeString src((UBool) (length < 0), label, length);
 	UnicodeString destString(dest, 0, capacity);
 	IDNAInfo info;
@@ -1126,6 +2474,7 @@ U_CAPI int32_t uidna_nameToASCII(const UIDNA *idna, const UChar *name, int32_t l
 	if (!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	UnicodeString src((UBool) (length < 0), name, length);
 	UnicodeString destString(dest, 0, capacity);
 	IDNAInfo info;
@@ -1139,6 +2488,7 @@ U_CAPI int32_t uidna_nameToUnicode(const UIDNA *idna, const UChar *name, int32_t
 	if (!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	UnicodeString src((UBool) (length < 0), name, length);
 	UnicodeString destString(dest, 0, capacity);
 	IDNAInfo info;
@@ -1152,12 +2502,13 @@ U_CAPI int32_t uidna_labelToASCII_UTF8(const UIDNA *idna, const char *label, int
 	if (!checkArgs(label, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	StringPiece src(label, length < 0 ? static_cast<int32_t>(uprv_strlen(label)) : length);
 	CheckedArrayByteSink sink(dest, capacity);
 	IDNAInfo info;
 	reinterpret_cast<const UTS46*>(idna)->labelToASCII_UTF8(src, sink, info, *pErrorCode);
 	idnaInfoToStruct(info, pInfo);
-	return u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
+	return u_terminateChars(dest, capacity, resultLength(idna, info, sink), pErrorCode);
 }
 
 U_CAPI int32_t uidna_labelToUnicodeUTF8(const UIDNA *idna, const char *label, int32_t length,
@@ -1165,12 +2516,13 @@ U_CAPI int32_t uidna_labelToUnicodeUTF8(const UIDNA *idna, const char *label, in
 	if (!checkArgs(label, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	StringPiece src(label, length < 0 ? static_cast<int32_t>(uprv_strlen(label)) : length);
 	CheckedArrayByteSink sink(dest, capacity);
 	IDNAInfo info;
 	reinterpret_cast<const UTS46*>(idna)->labelToUnicodeUTF8(src, sink, info, *pErrorCode);
 	idnaInfoToStruct(info, pInfo);
-	return u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
+	return u_terminateChars(dest, capacity, resultLength(idna, info, sink), pErrorCode);
 }
 
 U_CAPI int32_t uidna_nameToASCII_UTF8(const UIDNA *idna, const char *name, int32_t length,
@@ -1178,12 +2530,13 @@ U_CAPI int32_t uidna_nameToASCII_UTF8(const UIDNA *idna, const char *name, int32
 	if (!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
 	CheckedArrayByteSink sink(dest, capacity);
 	IDNAInfo info;
 	reinterpret_cast<const UTS46*>(idna)->nameToASCII_UTF8(src, sink, info, *pErrorCode);
 	idnaInfoToStruct(info, pInfo);
-	return u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
+	return u_terminateChars(dest, capacity, resultLength(idna, info, sink), pErrorCode);
 }
 
 U_CAPI int32_t uidna_nameToUnicodeUTF8(const UIDNA *idna, const char *name, int32_t length,
@@ -1191,14 +2544,352 @@ U_CAPI int32_t uidna_nameToUnicodeUTF8(const UIDNA *idna, const char *name, int3
 	if (!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
 		return 0;
 	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
 	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
 	CheckedArrayByteSink sink(dest, capacity);
 	IDNAInfo info;
 	reinterpret_cast<const UTS46*>(idna)->nameToUnicodeUTF8(src, sink, info, *pErrorCode);
 	idnaInfoToStruct(info, pInfo);
+	return u_terminateChars(dest, capacity, resultLength(idna, info, sink), pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToASCII_UTF8_view(const UIDNA *idna, const char *name, int32_t length,
+		char *dest, int32_t capacity, const char **pResult, UBool *pIsUnchanged, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (pResult == NULL && U_SUCCESS(*pErrorCode)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+	}
+	if (pIsUnchanged) {
+		*pIsUnchanged = false;
+	}
+	if (!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
+		return 0;
+	}
+	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
+	if (reinterpret_cast<const UTS46*>(idna)->isCanonicalASCIIName(src)) {
+		*pResult = name;
+		if (pIsUnchanged) {
+			*pIsUnchanged = true;
+		}
+		return src.length();
+	}
+	*pResult = dest;
+	return uidna_nameToASCII_UTF8(idna, src.data(), src.length(), dest, capacity, pInfo, pErrorCode);
+}
+
+// The second output of the dual conversions.
+static UBool checkDualArgs(const void *name, const void *dest, void *transDest, int32_t transCapacity, int32_t *pTransLength,
+		UIDNAInfo *pInfo, UIDNAInfo *pTransInfo, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return false;
+	}
+	if (pInfo == NULL || pTransLength == NULL || (transDest == NULL ? transCapacity != 0 : transCapacity < 0)
+			|| (transDest != NULL && (transDest == name || transDest == dest))) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return false;
+	}
+	*pTransLength = -1;
+	if (pTransInfo) {
+		pTransInfo->isTransitionalDifferent = false;
+		pTransInfo->errors = 0;
+	}
+	return true;
+}
+
+// Reports a U_BUFFER_OVERFLOW_ERROR or U_STRING_NOT_TERMINATED_WARNING of the transitional result
+// unless the nontransitional one already has a failure.
+static void mergeDualErrorCode(UErrorCode transErrorCode, UErrorCode *pErrorCode) {
+	if (transErrorCode != U_ZERO_ERROR && (U_FAILURE(transErrorCode) || *pErrorCode == U_ZERO_ERROR)) {
+		*pErrorCode = transErrorCode;
+	}
+}
+
+U_CAPI int32_t uidna_nameToASCIIDual(const UIDNA *idna, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo,
+		UChar *transDest, int32_t transCapacity, int32_t *pTransLength, UIDNAInfo *pTransInfo, UErrorCode *pErrorCode) {
+	if (!checkDualArgs(name, dest, transDest, transCapacity, pTransLength, pInfo, pTransInfo, pErrorCode) ||
+			!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	UnicodeString src((UBool) (length < 0), name, length);
+	UnicodeString destString(dest, 0, capacity), transString(transDest, 0, transCapacity);
+	IDNAInfo info, transInfo;
+	reinterpret_cast<const UTS46*>(idna)->nameToASCIIDual(src, destString, info, transString, transInfo, *pErrorCode);
+	idnaInfoToStruct(info, pInfo);
+	idnaInfoToStruct(transInfo, pTransInfo);
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	if (info.isTransitionalDifferent()) {
+		UErrorCode transErrorCode = U_ZERO_ERROR;
+		*pTransLength = transString.extract(transDest, transCapacity, transErrorCode);
+		int32_t destLength = destString.extract(dest, capacity, *pErrorCode);
+		mergeDualErrorCode(transErrorCode, pErrorCode);
+		return destLength;
+	}
+	return destString.extract(dest, capacity, *pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToASCIIDual_UTF8(const UIDNA *idna, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo,
+		char *transDest, int32_t transCapacity, int32_t *pTransLength, UIDNAInfo *pTransInfo, UErrorCode *pErrorCode) {
+	if (!checkDualArgs(name, dest, transDest, transCapacity, pTransLength, pInfo, pTransInfo, pErrorCode) ||
+			!checkArgs(name, length, dest, capacity, pInfo, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
+	CheckedArrayByteSink sink(dest, capacity), transSink(transDest, transCapacity);
+	IDNAInfo info, transInfo;
+	reinterpret_cast<const UTS46*>(idna)->nameToASCIIDual_UTF8(src, sink, info, transSink, transInfo, *pErrorCode);
+	idnaInfoToStruct(info, pInfo);
+	idnaInfoToStruct(transInfo, pTransInfo);
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	if (info.isTransitionalDifferent()) {
+		UErrorCode transErrorCode = U_ZERO_ERROR;
+		*pTransLength = u_terminateChars(transDest, transCapacity, transSink.NumberOfBytesAppended(), &transErrorCode);
+		int32_t destLength = u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
+		mergeDualErrorCode(transErrorCode, pErrorCode);
+		return destLength;
+	}
 	return u_terminateChars(dest, capacity, sink.NumberOfBytesAppended(), pErrorCode);
 }
 
+U_CAPI int32_t uidna_nameToASCIIAndUnicodeUTF8(const UIDNA *idna, const char *name, int32_t length,
+		char *asciiDest, int32_t asciiCapacity, char *unicodeDest, int32_t unicodeCapacity, int32_t *pUnicodeLength,
+		UIDNAASCIIAndUnicodeInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkArgs(name, length, asciiDest, asciiCapacity, NULL, pErrorCode)) {
+		return 0;
+	}
+	if (pUnicodeLength == NULL || (unicodeDest == NULL ? unicodeCapacity != 0 : unicodeCapacity < 0)
+			|| (unicodeDest != NULL && (unicodeDest == name || unicodeDest == asciiDest))) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return 0;
+	}
+	*pUnicodeLength = -1;
+	if (pInfo) {
+		pInfo->isTransitionalDifferent = false;
+		pInfo->errors = pInfo->asciiErrors = pInfo->unicodeErrors = 0;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
+	CheckedArrayByteSink asciiSink(asciiDest, asciiCapacity), unicodeSink(unicodeDest, unicodeCapacity);
+	IDNAInfo asciiInfo, unicodeInfo;
+	reinterpret_cast<const UTS46*>(idna)->nameToASCIIAndUnicodeUTF8(src, asciiSink, asciiInfo, unicodeSink, unicodeInfo, *pErrorCode);
+	if (pInfo) {
+		uint32_t asciiErrors = asciiInfo.getErrors(), unicodeErrors = unicodeInfo.getErrors();
+		pInfo->isTransitionalDifferent = asciiInfo.isTransitionalDifferent();
+		pInfo->errors = asciiErrors & unicodeErrors;
+		pInfo->asciiErrors = asciiErrors & ~unicodeErrors;
+		pInfo->unicodeErrors = unicodeErrors & ~asciiErrors;
+	}
+	if (U_FAILURE(*pErrorCode)) {
+		return 0;
+	}
+	UErrorCode unicodeErrorCode = U_ZERO_ERROR;
+	*pUnicodeLength = u_terminateChars(unicodeDest, unicodeCapacity, unicodeSink.NumberOfBytesAppended(), &unicodeErrorCode);
+	int32_t asciiLength = u_terminateChars(asciiDest, asciiCapacity, asciiSink.NumberOfBytesAppended(), pErrorCode);
+	mergeDualErrorCode(unicodeErrorCode, pErrorCode);
+	return asciiLength;
+}
+
+U_CAPI UBool uidna_checkName(const UIDNA *idna, const UChar *name, int32_t length,
+		UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkArgs(name, length, NULL, 0, pInfo, pErrorCode)) {
+		return false;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	UnicodeString src((UBool) (length < 0), name, length);
+	IDNAInfo info;
+	reinterpret_cast<const UTS46*>(idna)->checkName(src, false, info, *pErrorCode);
+	idnaInfoToStruct(info, pInfo);
+	return U_SUCCESS(*pErrorCode) && !info.hasErrors();
+}
+
+U_CAPI UBool uidna_checkNameUTF8(const UIDNA *idna, const char *name, int32_t length,
+		UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkArgs(name, length, NULL, 0, pInfo, pErrorCode)) {
+		return false;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
+	IDNAInfo info;
+	reinterpret_cast<const UTS46*>(idna)->checkNameUTF8(src, false, info, *pErrorCode);
+	idnaInfoToStruct(info, pInfo);
+	return U_SUCCESS(*pErrorCode) && !info.hasErrors();
+}
+
+U_CAPI UBool uidna_isValidName(const UIDNA *idna, const UChar *name, int32_t length, UErrorCode *pErrorCode) {
+	if (!checkArgs(name, length, NULL, 0, NULL, pErrorCode)) {
+		return false;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	UnicodeString src((UBool) (length < 0), name, length);
+	IDNAInfo info;
+	reinterpret_cast<const UTS46*>(idna)->checkName(src, true, info, *pErrorCode);
+	return U_SUCCESS(*pErrorCode) && !info.hasErrors();
+}
+
+U_CAPI UBool uidna_isValidNameUTF8(const UIDNA *idna, const char *name, int32_t length, UErrorCode *pErrorCode) {
+	if (!checkArgs(name, length, NULL, 0, NULL, pErrorCode)) {
+		return false;
+	}
+	CallArenaScope arena(reinterpret_cast<const UTS46*>(idna)->getCallArenaSize());
+	StringPiece src(name, length < 0 ? static_cast<int32_t>(uprv_strlen(name)) : length);
+	IDNAInfo info;
+	reinterpret_cast<const UTS46*>(idna)->checkNameUTF8(src, true, info, *pErrorCode);
+	return U_SUCCESS(*pErrorCode) && !info.hasErrors();
+}
+
+static UBool checkContext(UIDNAContext *context, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return false;
+	}
+	if (context == NULL) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return false;
+	}
+	return true;
+}
+
+// The temporaries of the call are taken from the context's arena.
+U_CAPI int32_t uidna_labelToASCII_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *label, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_labelToASCII(idna, label, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_labelToUnicode_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *label, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_labelToUnicode(idna, label, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToASCII_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_nameToASCII(idna, name, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToUnicode_WithContext(const UIDNA *idna, UIDNAContext *context, const UChar *name, int32_t length,
+		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_nameToUnicode(idna, name, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_labelToASCII_UTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *label, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_labelToASCII_UTF8(idna, label, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_labelToUnicodeUTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *label, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_labelToUnicodeUTF8(idna, label, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToASCII_UTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_nameToASCII_UTF8(idna, name, length, dest, capacity, pInfo, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToUnicodeUTF8_WithContext(const UIDNA *idna, UIDNAContext *context, const char *name, int32_t length,
+		char *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
+	if (!checkContext(context, pErrorCode)) {
+		return 0;
+	}
+	CallArenaScope arena(*reinterpret_cast<CallArenaState *>(context));
+	return uidna_nameToUnicodeUTF8(idna, name, length, dest, capacity, pInfo, pErrorCode);
+}
+
+static UBool checkBatchArgs(const UIDNAName *names, int32_t count, char *arena, int32_t arenaCapacity,
+		int32_t *offsets, int32_t *lengths, UErrorCode *pErrorCode) {
+	if (U_FAILURE(*pErrorCode)) {
+		return false;
+	}
+	if (count < 0 || (count > 0 && (names == NULL || offsets == NULL || lengths == NULL))
+			|| (arena == NULL ? arenaCapacity != 0 : arenaCapacity < 0)) {
+		*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+		return false;
+	}
+	return true;
+}
+
+static int32_t processUTF8Batch(const UTS46 *uts46, UBool toASCII, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, UErrorCode *pErrorCode) {
+	if (!checkBatchArgs(names, count, arena, arenaCapacity, offsets, lengths, pErrorCode)) {
+		return 0;
+	}
+	CheckedArrayByteSink sink(arena, arenaCapacity);
+	IDNAInfo info;
+	for (int32_t i = 0; i < count; ++i) {
+		const UIDNAName &name = names[i];
+		if (name.data == NULL ? name.length != 0 : name.length < -1) {
+			*pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+			return 0;
+		}
+		CallArenaScope callArena(uts46->getCallArenaSize());
+		StringPiece src(name.data, name.length < 0 ? static_cast<int32_t>(uprv_strlen(name.data)) : name.length);
+		int32_t offset = sink.NumberOfBytesAppended();
+		if (toASCII) {
+			uts46->nameToASCII_UTF8(src, sink, info, *pErrorCode);
+		} else {
+			uts46->nameToUnicodeUTF8(src, sink, info, *pErrorCode);
+		}
+		if (U_FAILURE(*pErrorCode)) {
+			return 0;
+		}
+		if (uts46->hasFailFastError(info)) {
+			sink.Truncate(offset);  // a rejected name takes no arena space
+		}
+		offsets[i] = offset;
+		lengths[i] = sink.NumberOfBytesAppended() - offset;
+		idnaInfoToStruct(info, pInfos ? pInfos + i : NULL);
+	}
+	int32_t length = sink.NumberOfBytesAppended();
+	if (length > arenaCapacity) {
+		*pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+	}
+	return length;
+}
+
+U_CAPI int32_t uidna_nameToASCII_UTF8_batch(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, UErrorCode *pErrorCode) {
+	return processUTF8Batch(reinterpret_cast<const UTS46*>(idna), true, names, count,
+			arena, arenaCapacity, offsets, lengths, pInfos, pErrorCode);
+}
+
+U_CAPI int32_t uidna_nameToUnicodeUTF8_batch(const UIDNA *idna, const UIDNAName *names, int32_t count,
+		char *arena, int32_t arenaCapacity, int32_t *offsets, int32_t *lengths, UIDNAInfo *pInfos, UErrorCode *pErrorCode) {
+	return processUTF8Batch(reinterpret_cast<const UTS46*>(idna), false, names, count,
+			arena, arenaCapacity, offsets, lengths, pInfos, pErrorCode);
+}
+
 U_CAPI int32_t u_labelToASCII(uint32_t options, const UChar *label, int32_t length,
 		UChar *dest, int32_t capacity, UIDNAInfo *pInfo, UErrorCode *pErrorCode) {
 	*pErrorCode = U_ZERO_ERROR;
@@ -19,13 +19,18 @@
 
 #include "u_unistr.h"
 #include "u_norm2.h"
+#include "u_arena.h"
 
 namespace uidna {
 
 class IDNAInfo;
+class IDNACache;
 class UnicodeString;
 
-class UTS46 {
+// Template argument of the UTS46 processing functions for options that are only known at runtime.
+static constexpr uint32_t GenericOptions = 0xffffffff;
+
+class UTS46 : public HeapObject {
 public:
     UTS46(uint32_t options, UErrorCode &errorCode);
     ~UTS46();
@@ -40,28 +45,157 @@ public:
 	void nameToASCII_UTF8(StringPiece name, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
 	void nameToUnicodeUTF8(StringPiece name, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
 
+	// Nontransitional and transitional nameToASCII() in one pass, whatever the UIDNA_NONTRANSITIONAL_TO_ASCII option:
+	// the name is mapped and normalized once, and only labels with deviation characters are processed twice.
+	// dest and info get the nontransitional result, transDest and transInfo the transitional one,
+	// but transDest is only written if info.isTransitionalDifferent(), otherwise dest is the result of both.
+	UnicodeString& nameToASCIIDual(const UnicodeString &name, UnicodeString &dest, IDNAInfo &info,
+			UnicodeString &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const;
+	void nameToASCIIDual_UTF8(StringPiece name, ByteSink &dest, IDNAInfo &info,
+			ByteSink &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const;
+
+	// nameToASCII_UTF8() and nameToUnicodeUTF8() in one pass: mapping, normalization, Punycode decoding and validation
+	// are shared, only the toASCII result encodes Punycode and checks the lengths.
+	void nameToASCIIAndUnicodeUTF8(StringPiece name, ByteSink &asciiDest, IDNAInfo &asciiInfo,
+			ByteSink &unicodeDest, IDNAInfo &unicodeInfo, UErrorCode &errorCode) const;
+
+	// Validation only: the same errors as nameToASCII(), without building the result.
+	// With stopOnError, returns at the first error found, otherwise at the first fail-fast error;
+	// info then has only some of the errors.
+	void checkName(const UnicodeString &name, UBool stopOnError, IDNAInfo &info, UErrorCode &errorCode) const;
+	void checkNameUTF8(StringPiece name, UBool stopOnError, IDNAInfo &info, UErrorCode &errorCode) const;
+
+	// Returns true if nameToASCII_UTF8() would return the name unchanged and without errors:
+	// lowercase ASCII that passes the fastpath checks, so the caller can use the input as the result.
+	UBool isCanonicalASCIIName(StringPiece name) const;
+
+	// Takes ownership of the cache for the UTF-8 functions, NULL to remove it.
+	// Must not be called while other threads use this object.
+	void setCache(IDNACache *cache);
+	const IDNACache *getCache() const { return cache; }
+
+	// Size of the per-thread arena for the temporaries of each call, 0 for none, see uidna_setCallArena().
+	void setCallArenaSize(int32_t size) { callArenaSize = size; }
+	int32_t getCallArenaSize() const { return callArenaSize; }
+
+	// Same for the memo of Punycode and non-ASCII label results, used by both UTF-8 and UTF-16 functions.
+	void setLabelCache(IDNACache *cache);
+	const IDNACache *getLabelCache() const { return labelCache; }
+
+	// UIDNA_FAIL_FAST: the errors at which a conversion stops with an incomplete result, see uidna_setFailFastErrors().
+	// The UTF-16 functions then return an empty dest; the UTF-8 ones may have appended completed labels to theirs.
+	void setFailFastErrors(uint32_t errors);
+	// true if info has one of the fail-fast errors, so that the result is incomplete
+	UBool hasFailFastError(const IDNAInfo &info) const;
+
 private:
+	// The processing functions below are instantiated for an option set and direction (toASCII or not),
+	// so that the option tests are compile-time constants, see hasOption().
+	// An Engine holds the entry points of one instantiation; the constructor selects one per direction,
+	// a specialized one for common option sets, otherwise the one for GenericOptions.
+	struct Engine;
+	template <uint32_t Options, bool ToASCII>
+	static const Engine *makeEngine();
+	template <bool ToASCII>
+	static const Engine *getEngine(uint32_t options);
+
+	template <uint32_t Options>
+	bool hasOption(uint32_t option) const { return ((Options == GenericOptions ? options : Options) & option) != 0; }
+
+	// Dispatch to the engine for the direction.
 	UnicodeString& process(const UnicodeString &src, UBool isLabel, UBool toASCII, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const;
 	void processUTF8(StringPiece src, UBool isLabel, UBool toASCII, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
-	UnicodeString& processUnicode(const UnicodeString &src, int32_t labelStart, int32_t mappingStart, UBool isLabel, UBool toASCII, UnicodeString &dest, IDNAInfo &info, UErrorCode &errorCode) const;
+	void processUTF8Uncached(StringPiece src, UBool isLabel, UBool toASCII, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
+
+	// With transDest, a dual conversion: dest is the nontransitional result, and at the first label
+	// with deviation characters the transitional result forks off into transDest, see nameToASCIIDual().
+	template <uint32_t Options, bool ToASCII>
+	UnicodeString& process(const UnicodeString &src, UBool isLabel, UnicodeString &dest, IDNAInfo &info,
+			UnicodeString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const;
+	template <uint32_t Options, bool ToASCII>
+	void processUTF8Uncached(StringPiece src, UBool isLabel, ByteSink &dest, IDNAInfo &info, UErrorCode &errorCode) const;
+	// Dual conversion of a name in UTF-8, not streamed.
+	template <uint32_t Options, bool ToASCII>
+	void processDualUTF8(StringPiece src, CharString &dest, IDNAInfo &info, CharString &transDest, IDNAInfo &transInfo, UErrorCode &errorCode) const;
+	// toASCII and toUnicode of a name in UTF-8, see nameToASCIIAndUnicodeUTF8(); Options are those of the toUnicode engine.
+	template <uint32_t Options>
+	void processBothUTF8(StringPiece src, CharString &asciiDest, IDNAInfo &asciiInfo,
+			CharString &unicodeDest, IDNAInfo &unicodeInfo, UErrorCode &errorCode) const;
+	// ASCII fastpath of process() and processUTF8() for src[start..limit[, written to dest[0..limit-start[:
+	// returns true if all of it was handled, otherwise i is where the full processing has to continue.
+	// Also returns true when it stops at a fail-fast error (info.errors & info.stopErrors), with incomplete output.
+	template <uint32_t Options, bool ToASCII, typename Char>
+	UBool processASCII(const Char *src, int32_t srcLength, int32_t start, int32_t limit, Char *dest,
+			UBool isLabel, int32_t &i, int32_t &labelStart, IDNAInfo &info) const;
+	template <uint32_t Options, bool ToASCII>
+	UnicodeString& processUnicode(const UnicodeString &src, int32_t labelStart, int32_t mappingStart, UBool isLabel, UnicodeString &dest, IDNAInfo &info,
+			UnicodeString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const;
+
+	// uts46Norm2 normalization of src[start..] appended to dest, resp. of src to dest,
+	// which copies runs of characters that normalization would not change.
+	void normalizeAndAppend(const UnicodeString &src, int32_t start, UnicodeString &dest, UErrorCode &errorCode) const;
+	void normalizeUTF8(StringPiece src, CharString &dest, UErrorCode &errorCode) const;
+	// UIDNA_TRUSTED_NFC_INPUT: append the input unchanged instead of normalizing it.
+	void appendTrustedNFC(const UnicodeString &src, int32_t start, UnicodeString &dest, UErrorCode &errorCode) const;
+	void appendTrustedNFCUTF8(StringPiece src, CharString &dest, UErrorCode &errorCode) const;
 
 	// returns the new dest.length()
 	int32_t mapDevChars(UnicodeString &dest, int32_t labelStart, int32_t mappingStart, UErrorCode &errorCode) const;
 
 	// returns the new label length
-	int32_t processLabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, UBool toASCII, IDNAInfo &info, UErrorCode &errorCode) const;
-	int32_t markBadACELabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, UBool toASCII, IDNAInfo &info, UErrorCode &errorCode) const;
-	void checkLabelBiDi(const UChar *label, int32_t labelLength, IDNAInfo &info) const;
-	UBool isLabelOkContextJ(const UChar *label, int32_t labelLength) const;
-	void checkLabelContextO(const UChar *label, int32_t labelLength, IDNAInfo &info) const;
+	template <uint32_t Options, bool ToASCII>
+	int32_t processLabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
+	template <uint32_t Options, bool ToASCII>
+	int32_t processLabelUncached(UnicodeString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
+	template <uint32_t Options, bool ToASCII>
+	int32_t markBadACELabel(UnicodeString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
+
+	// UTF-8 versions of the above, working on the mapped and normalized bytes in dest.
+	// isNameStart: src starts the name, not just its label at the end of dest.
+	template <uint32_t Options, bool ToASCII>
+	void processUnicodeUTF8(StringPiece src, UBool isLabel, UBool isNameStart, CharString &dest, IDNAInfo &info,
+			CharString *transDest, IDNAInfo *transInfo, UErrorCode &errorCode) const;
+	int32_t mapDevChars(CharString &dest, int32_t labelStart, int32_t mappingStart, UErrorCode &errorCode) const;
+	template <uint32_t Options, bool ToASCII>
+	int32_t processLabel(CharString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
+	template <uint32_t Options, bool ToASCII>
+	int32_t processLabelUncached(CharString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
+	// processLabel() of the label at the end of dest; in a dual conversion that has forked (transLabelStart>=0)
+	// also of the one at the end of transDest, which is a copy of the processed dest label unless hasDevChars.
+	// atEnd is true for the last label of the name.
+	template <uint32_t Options, bool ToASCII, typename String>
+	void processDualLabel(String &dest, int32_t labelStart, IDNAInfo &info,
+			String *transDest, int32_t transLabelStart, UBool hasDevChars, UBool atEnd, IDNAInfo *transInfo, UErrorCode &errorCode) const;
+	// The label at the end of unicodeDest for processBothUTF8(), and with hasASCIILabel its differently mapped
+	// version at the end of asciiDest; otherwise the toASCII label is derived from the toUnicode processing.
+	// atEnd is true for the last label of the name, which may be empty.
+	template <uint32_t Options>
+	void processBothLabel(CharString &asciiDest, int32_t asciiLabelStart, IDNAInfo &asciiInfo,
+			CharString &unicodeDest, int32_t unicodeLabelStart, IDNAInfo &unicodeInfo, UBool hasASCIILabel, UBool atEnd,
+			UErrorCode &errorCode) const;
+	// adds the label errors and BiDi state of a separately processed label
+	static void mergeLabelInfo(IDNAInfo &info, uint32_t labelErrors, uint32_t flags);
+	// sets UIDNA_ERROR_DOMAIN_NAME_TOO_LONG for a too long toASCII result
+	template <typename String>
+	static void checkDomainNameLength(int32_t prefixLength, const String &dest, IDNAInfo &info);
+	// sets UIDNA_ERROR_BIDI at the end of a name that has an RTL label and fails the BiDi rule
+	static void checkBiDiName(IDNAInfo &info, UErrorCode &errorCode);
+	template <uint32_t Options, bool ToASCII>
+	int32_t markBadACELabel(CharString &dest, int32_t labelStart, int32_t labelLength, IDNAInfo &info, UErrorCode &errorCode) const;
 
 	const ComposeNormalizer2 *uts46Norm2;  // uts46.nrm
 	uint32_t options;
+	const Engine *engines[2];  // [toASCII]
+	IDNACache *cache;
+	IDNACache *labelCache;
+	int32_t callArenaSize;
+	uint32_t failFastErrors;  // 0 without UIDNA_FAIL_FAST
 };
 
 class IDNAInfo {
 public:
-	IDNAInfo() : errors(0), labelErrors(0), isTransDiff(false), isBiDi(false), isOkBiDi(true) {}
+	IDNAInfo() : errors(0), labelErrors(0), isTransDiff(false), isBiDi(false), isOkBiDi(true),
+			checkOnly(false), stopErrors(0), skippedLengthDelta(0), skippedNonASCII(0) {}
 
 	bool hasErrors() const { return errors!=0; }
 	uint32_t getErrors() const { return errors; }
@@ -70,6 +204,7 @@ public:
 
 private:
 	friend class UTS46;
+	friend class LabelChecker;
 
 	IDNAInfo(const IDNAInfo &other);  // no copying
 	IDNAInfo &operator=(const IDNAInfo &other);  // no copying
@@ -79,12 +214,32 @@ private:
 		isTransDiff=false;
 		isBiDi=false;
 		isOkBiDi=true;
+		skippedLengthDelta=skippedNonASCII=0;
+	}
+
+	// The state of a conversion so far, where the transitional result of a dual conversion forks off.
+	void copyState(const IDNAInfo &other) {
+		errors=other.errors;
+		labelErrors=other.labelErrors;
+		isTransDiff=other.isTransDiff;
+		isBiDi=other.isBiDi;
+		isOkBiDi=other.isOkBiDi;
 	}
 
 	uint32_t errors, labelErrors;
 	bool isTransDiff;
 	bool isBiDi;
 	bool isOkBiDi;
+
+	// Validation only (checkName()), not reset: labels are not converted to Punycode,
+	// only the change in length and the non-ASCII units they leave behind in dest are counted,
+	// for the domain name length check.
+	bool checkOnly;
+	// Errors that end the processing as soon as they are found, not reset either:
+	// all of them for checkName() with stopOnError, the fail-fast errors of the UTS46 object for conversions.
+	uint32_t stopErrors;
+	int32_t skippedLengthDelta;
+	int32_t skippedNonASCII;
 };
 
 }
@@ -1,16 +1,21 @@
 
 #ifdef UIDNA_SOURCES 
 #include "u_types.cc"
+#include "u_arena.cc"
 #include "u_punycode.cc"
 #include "u_trie.cc"
 #include "u_bidi.cc"
 #include "u_char.cc"
 #include "u_uts46data.cc"
+#include "u_idnaprops.cc"
 
 #include "u_unistr.cc"
 #include "u_edits.cc"
 #include "u_norm2.cc"
+#include "u_ascii.cc"
+#include "u_cache.cc"
 #include "u_uts46.cc"
+#include "u_parallel.cc"
 #endif
 
 #include "u_idn2.cc"
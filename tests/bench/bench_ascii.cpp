@@ -0,0 +1,103 @@
+
+// Benchmark for the ASCII fastpath kernels of uidna_nameToASCII_UTF8() and uidna_nameToASCII()
+//
+// Usage: bench-ascii [names]
+// Prints CSV: kernel,api,names,ns_per_op,names_per_sec
+
+#include "unicode/uidna.h"
+#include "u_ascii.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Pure-ASCII LDH hostnames of typical lengths, some with uppercase letters.
+static std::vector<std::string> makeCorpus(int32_t count) {
+	static const char *const labels[] = {
+		"www", "mail", "api", "cdn", "static", "Images", "login", "example", "google", "Wikipedia",
+		"my-service", "eu-west-1", "s3", "k8s", "internal", "com", "net", "org", "co", "uk", "DE"
+	};
+	std::vector<std::string> corpus(count);
+	uint32_t seed = 12345;
+	for (int32_t i = 0; i < count; ++i) {
+		seed = seed * 1103515245 + 12345;
+		int32_t labelCount = 2 + (seed >> 16) % 4;
+		for (int32_t j = 0; j < labelCount; ++j) {
+			seed = seed * 1103515245 + 12345;
+			if (j > 0) {
+				corpus[i] += '.';
+			}
+			corpus[i] += labels[(seed >> 16) % (sizeof(labels) / sizeof(labels[0]))];
+		}
+	}
+	return corpus;
+}
+
+int main(int argc, const char *argv[]) {
+	int32_t count = argc > 1 ? atoi(argv[1]) : 1000000;
+	if (count <= 0) {
+		fprintf(stderr, "Usage: %s [names]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::string> corpus = makeCorpus(count);
+	std::vector<std::vector<UChar>> corpus16(count);
+	for (int32_t i = 0; i < count; ++i) {
+		corpus16[i].assign(corpus[i].begin(), corpus[i].end());
+	}
+
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(UIDNA_USE_STD3_RULES | UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII, &errorCode);
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "uidna_open() failed: %s\n", u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	static const struct {
+		uidna::ASCIIKernelType type;
+		const char *name;
+	} kernels[] = {
+		{ uidna::ASCIIKernelType::Scalar, "scalar" },
+		{ uidna::ASCIIKernelType::SSE2, "sse2" },
+		{ uidna::ASCIIKernelType::AVX2, "avx2" },
+	};
+
+	printf("kernel,api,names,ns_per_op,names_per_sec\n");
+	for (const auto &kernel : kernels) {
+		if (!uidna::setASCIIBlockKernel(kernel.type)) {
+			continue;
+		}
+		for (int utf16 = 0; utf16 < 2; ++utf16) {
+			double best = 0.0;
+			for (int32_t run = 0; run < 3; ++run) {
+				char dest8[256];
+				UChar dest16[256];
+				size_t checksum = 0;
+				auto start = std::chrono::steady_clock::now();
+				for (int32_t i = 0; i < count; ++i) {
+					UIDNAInfo info = { false, 0 };
+					errorCode = U_ZERO_ERROR;
+					if (utf16) {
+						checksum += uidna_nameToASCII(idna, corpus16[i].data(), int32_t(corpus16[i].size()), dest16, 256, &info, &errorCode);
+					} else {
+						checksum += uidna_nameToASCII_UTF8(idna, corpus[i].data(), int32_t(corpus[i].size()), dest8, 256, &info, &errorCode);
+					}
+					checksum += info.errors;
+				}
+				std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+				if (checksum == 0) {
+					fprintf(stderr, "unexpected empty output\n");
+				}
+				if (run == 0 || elapsed.count() < best) {
+					best = elapsed.count();
+				}
+			}
+			printf("%s,%s,%d,%.1f,%.0f\n", kernel.name, utf16 ? "utf16" : "utf8", count, best * 1e9 / count, count / best);
+		}
+	}
+
+	uidna_close(idna);
+	return EXIT_SUCCESS;
+}
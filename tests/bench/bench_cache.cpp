@@ -0,0 +1,105 @@
+
+// Benchmark for the result cache of uidna_setCache() and the label memo of uidna_setLabelCache()
+//
+// Usage: bench-cache [lookups] [distinct names] [budget bytes]
+// Prints CSV: mode,lookups,ns_per_op,hits,misses,evictions,memory
+
+#include "unicode/uidna.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Lookup sequence over distinct names with Zipf(1) popularity.
+static std::vector<int32_t> makeSequence(int32_t lookups, int32_t distinct) {
+	std::vector<double> cdf(distinct);
+	double sum = 0.0;
+	for (int32_t i = 0; i < distinct; ++i) {
+		sum += 1.0 / (i + 1);
+		cdf[i] = sum;
+	}
+	std::vector<int32_t> sequence(lookups);
+	uint64_t seed = 12345;
+	for (int32_t i = 0; i < lookups; ++i) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		double x = double(seed >> 11) / double(1ULL << 53) * sum;
+		int32_t lo = 0, hi = distinct - 1;
+		while (lo < hi) {
+			int32_t mid = (lo + hi) / 2;
+			if (cdf[mid] < x) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+		sequence[i] = lo;
+	}
+	return sequence;
+}
+
+int main(int argc, const char *argv[]) {
+	int32_t lookups = argc > 1 ? atoi(argv[1]) : 2000000;
+	int32_t distinct = argc > 2 ? atoi(argv[2]) : 100000;
+	int64_t budget = argc > 3 ? atoll(argv[3]) : 4 << 20;
+	if (lookups <= 0 || distinct <= 0 || budget <= 0) {
+		fprintf(stderr, "Usage: %s [lookups] [distinct names] [budget bytes]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	static const char *const suffixes[] = {
+		".example.com", ".B\xc3\xbc" "cher.de", ".xn--p1ai", ".\xe4\xbe\x8b\xe5\xad\x90.\xe4\xb8\xad\xe5\x9b\xbd", ".Static-CDN.net"
+	};
+	std::vector<std::string> names(distinct);
+	for (int32_t i = 0; i < distinct; ++i) {
+		names[i] = "host" + std::to_string(i) + suffixes[i % (sizeof(suffixes) / sizeof(suffixes[0]))];
+	}
+	std::vector<int32_t> sequence = makeSequence(lookups, distinct);
+
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII, &errorCode);
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "uidna_open() failed: %s\n", u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	printf("mode,lookups,ns_per_op,hits,misses,evictions,memory\n");
+	// Modes: uncached, whole names cached, only labels memoized (the names differ, their IDN labels repeat).
+	static const char *const modes[] = { "uncached", "cached", "labels" };
+	for (int mode = 0; mode < 3; ++mode) {
+		if (mode == 1) {
+			uidna_setCache(idna, budget, &errorCode);
+		} else if (mode == 2) {
+			uidna_setCache(idna, 0, &errorCode);
+			uidna_setLabelCache(idna, budget, &errorCode);
+		}
+		char dest[256];
+		size_t checksum = 0;
+		auto start = std::chrono::steady_clock::now();
+		for (int32_t i = 0; i < lookups; ++i) {
+			const std::string &name = names[sequence[i]];
+			UIDNAInfo info = { false, 0 };
+			errorCode = U_ZERO_ERROR;
+			checksum += uidna_nameToASCII_UTF8(idna, name.data(), int32_t(name.size()), dest, sizeof(dest), &info, &errorCode);
+		}
+		std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		if (checksum == 0) {
+			fprintf(stderr, "unexpected empty output\n");
+		}
+		UIDNACacheStats stats;
+		errorCode = U_ZERO_ERROR;
+		if (mode == 2) {
+			uidna_getLabelCacheStats(idna, &stats, &errorCode);
+		} else {
+			uidna_getCacheStats(idna, &stats, &errorCode);
+		}
+		printf("%s,%d,%.1f,%llu,%llu,%llu,%llu\n", modes[mode], lookups, elapsed.count() * 1e9 / lookups,
+				(unsigned long long) stats.hits, (unsigned long long) stats.misses,
+				(unsigned long long) stats.evictions, (unsigned long long) stats.memoryUsed);
+	}
+
+	uidna_close(idna);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+
+// Scaling benchmark for uidna_nameToASCII_UTF8_batchParallel()
+//
+// Usage: bench-parallel [names] [max threads]
+// Prints CSV: threads,names,seconds,names_per_sec,speedup
+
+#include "unicode/uidna.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Skewed corpus: mostly short ASCII hostnames with long Punycode-heavy names in between.
+static std::vector<std::string> makeCorpus(int32_t count) {
+	static const char *const ascii[] = {
+		"www.example.com", "mail.google.com", "cdn.Static-Assets.net", "api.service.internal", "a.b.c.d.e.org"
+	};
+	static const char *const heavy[] = {
+		"xn--bcher-kva.xn--p1ai", "b\xc3\xbc" "cher.\xd0\xbf\xd1\x80\xd0\xb8\xd0\xbc\xd0\xb5\xd1\x80.de",
+		"\xe4\xbe\x8b\xe5\xad\x90.\xe6\xb5\x8b\xe8\xaf\x95.\xe4\xb8\xad\xe5\x9b\xbd",
+		"\xd7\x90\xd7\x91\xd7\x92.\xd7\x93\xd7\x94\xd7\x95.com", "xn--mgbh0fb.xn--kgbechtv"
+	};
+	std::vector<std::string> corpus(count);
+	uint32_t seed = 12345;
+	for (int32_t i = 0; i < count; ++i) {
+		seed = seed * 1103515245 + 12345;
+		if ((seed >> 16) % 10 == 0) {
+			std::string &name = corpus[i];
+			int32_t labels = 2 + (seed >> 8) % 6;
+			for (int32_t j = 0; j < labels; ++j) {
+				if (j > 0) {
+					name += '.';
+				}
+				name += heavy[(seed >> (j + 4)) % (sizeof(heavy) / sizeof(heavy[0]))];
+			}
+		} else {
+			corpus[i] = ascii[(seed >> 16) % (sizeof(ascii) / sizeof(ascii[0]))];
+		}
+	}
+	return corpus;
+}
+
+int main(int argc, const char *argv[]) {
+	int32_t count = argc > 1 ? atoi(argv[1]) : 1000000;
+	int32_t maxThreads = argc > 2 ? atoi(argv[2]) : int32_t(std::thread::hardware_concurrency());
+	if (count <= 0 || maxThreads <= 0) {
+		fprintf(stderr, "Usage: %s [names] [max threads]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	std::vector<std::string> corpus = makeCorpus(count);
+	std::vector<UIDNAName> names(count);
+	size_t inputSize = 0;
+	for (int32_t i = 0; i < count; ++i) {
+		names[i].data = corpus[i].data();
+		names[i].length = int32_t(corpus[i].size());
+		inputSize += corpus[i].size();
+	}
+
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO | UIDNA_NONTRANSITIONAL_TO_ASCII, &errorCode);
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "uidna_open() failed: %s\n", u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	std::vector<char> arena(inputSize * 4 + 1024);
+	std::vector<int32_t> offsets(count), lengths(count);
+	std::vector<UIDNAInfo> infos(count);
+
+	// Reference output of the serial batch, every thread count must reproduce it byte for byte.
+	std::vector<char> expected(arena.size());
+	int32_t expectedLength = uidna_nameToASCII_UTF8_batch(idna, names.data(), count, expected.data(), int32_t(expected.size()),
+			offsets.data(), lengths.data(), infos.data(), &errorCode);
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "serial batch conversion failed: %s\n", u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	printf("threads,names,seconds,names_per_sec,speedup\n");
+	double baseline = 0.0;
+	for (int32_t threads = 1; threads <= maxThreads; threads = threads < maxThreads && threads * 2 > maxThreads ? maxThreads : threads * 2) {
+		double best = 0.0;
+		for (int32_t run = 0; run < 3; ++run) {
+			errorCode = U_ZERO_ERROR;
+			auto start = std::chrono::steady_clock::now();
+			int32_t length = uidna_nameToASCII_UTF8_batchParallel(idna, names.data(), count, arena.data(), int32_t(arena.size()),
+					offsets.data(), lengths.data(), infos.data(), threads, &errorCode);
+			std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+			if (errorCode > U_ZERO_ERROR) {
+				fprintf(stderr, "batch conversion failed: %s\n", u_errorName(errorCode));
+				return EXIT_FAILURE;
+			}
+			if (length != expectedLength || memcmp(arena.data(), expected.data(), length) != 0) {
+				fprintf(stderr, "output with %d threads differs from the serial batch\n", threads);
+				return EXIT_FAILURE;
+			}
+			if (run == 0 || elapsed.count() < best) {
+				best = elapsed.count();
+			}
+		}
+		if (threads == 1) {
+			baseline = best;
+		}
+		printf("%d,%d,%.6f,%.0f,%.2f\n", threads, count, best, count / best, baseline / best);
+		if (threads == maxThreads) {
+			break;
+		}
+	}
+
+	uidna_close(idna);
+	return EXIT_SUCCESS;
+}
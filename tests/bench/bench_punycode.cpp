@@ -0,0 +1,207 @@
+
+// Benchmark for the Punycode encoder: u_strToPunycode() against the previous
+// quadratic implementation of RFC 3492, kept here as the reference. Also checks that both agree.
+//
+// Usage: bench-punycode [iterations]
+// Prints CSV: input,code_points,reference_ns,ns,speedup
+
+#include "unicode/uidna.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static bool isLead(UChar c) { return (c & 0xfc00) == 0xd800; }
+static bool isTrail(UChar c) { return (c & 0xfc00) == 0xdc00; }
+
+namespace reference {
+
+static constexpr int32_t BASE = 36, TMIN = 1, TMAX = 26, SKEW = 38, DAMP = 700, INITIAL_BIAS = 72, INITIAL_N = 0x80;
+
+static int32_t adaptBias(int32_t delta, int32_t length, bool firstTime) {
+	int32_t count;
+	delta = firstTime ? delta / DAMP : delta / 2;
+	delta += delta / length;
+	for (count = 0; delta > ((BASE - TMIN) * TMAX) / 2; count += BASE) {
+		delta /= (BASE - TMIN);
+	}
+	return count + (((BASE - TMIN + 1) * delta) / (delta + SKEW));
+}
+
+static char digitToBasic(int32_t digit) {
+	return digit < 26 ? char('a' + digit) : char('0' - 26 + digit);
+}
+
+// Previous encoder without case flags: one scan of all code points per distinct non-basic code point.
+static int32_t toPunycode(const UChar *src, int32_t srcLength, UChar *dest, int32_t destCapacity) {
+	int32_t cpBuffer[1000];
+	int32_t n, delta, handledCPCount, basicLength, destLength, bias, j, m, q, k, t, srcCPCount;
+
+	srcCPCount = destLength = 0;
+	for (j = 0; j < srcLength; ++j) {
+		UChar c = src[j];
+		if (c < 0x80) {
+			cpBuffer[srcCPCount++] = 0;
+			if (destLength < destCapacity) {
+				dest[destLength] = c;
+			}
+			++destLength;
+		} else if (isLead(c) && j + 1 < srcLength && isTrail(src[j + 1])) {
+			cpBuffer[srcCPCount++] = 0x10000 + ((c - 0xd800) << 10) + (src[j + 1] - 0xdc00);
+			++j;
+		} else {
+			cpBuffer[srcCPCount++] = c;
+		}
+	}
+	basicLength = destLength;
+	if (basicLength > 0) {
+		if (destLength < destCapacity) {
+			dest[destLength] = '-';
+		}
+		++destLength;
+	}
+
+	n = INITIAL_N;
+	delta = 0;
+	bias = INITIAL_BIAS;
+	for (handledCPCount = basicLength; handledCPCount < srcCPCount;) {
+		for (m = 0x7fffffff, j = 0; j < srcCPCount; ++j) {
+			q = cpBuffer[j];
+			if (n <= q && q < m) {
+				m = q;
+			}
+		}
+		if (m - n > (0x7fffffff - handledCPCount - delta) / (handledCPCount + 1)) {
+			return -1;
+		}
+		delta += (m - n) * (handledCPCount + 1);
+		n = m;
+		for (j = 0; j < srcCPCount; ++j) {
+			q = cpBuffer[j];
+			if (q < n) {
+				++delta;
+			} else if (q == n) {
+				for (q = delta, k = BASE;; k += BASE) {
+					t = k - bias;
+					if (t < TMIN) {
+						t = TMIN;
+					} else if (k >= (bias + TMAX)) {
+						t = TMAX;
+					}
+					if (q < t) {
+						break;
+					}
+					if (destLength < destCapacity) {
+						dest[destLength] = digitToBasic(t + (q - t) % (BASE - t));
+					}
+					++destLength;
+					q = (q - t) / (BASE - t);
+				}
+				if (destLength < destCapacity) {
+					dest[destLength] = digitToBasic(q);
+				}
+				++destLength;
+				bias = adaptBias(delta, handledCPCount + 1, handledCPCount == basicLength);
+				delta = 0;
+				++handledCPCount;
+			}
+		}
+		++delta;
+		++n;
+	}
+	return destLength;
+}
+
+}
+
+// Label of about the given length in UTF-16 code units, from a repeating pattern of code points.
+static std::u16string makeInput(const char *shape, int32_t length) {
+	std::u16string s;
+	uint32_t seed = 1;
+	while (int32_t(s.size()) < length) {
+		seed = seed * 1103515245 + 12345;
+		uint32_t r = seed >> 16;
+		if (strcmp(shape, "latin") == 0) {
+			// mostly ASCII, some accented letters
+			s.push_back(r % 5 == 0 ? char16_t(0xe0 + r % 28) : char16_t('a' + r % 26));
+		} else if (strcmp(shape, "cyrillic") == 0) {
+			// a small alphabet, many repeats
+			s.push_back(char16_t(0x430 + r % 32));
+		} else if (strcmp(shape, "cjk") == 0) {
+			// mostly distinct code points
+			s.push_back(char16_t(0x4e00 + r % 20000));
+		} else {
+			// "emoji": supplementary code points
+			if (int32_t(s.size()) + 2 > length) {
+				break;
+			}
+			int32_t c = 0x1f300 + r % 700 - 0x10000;
+			s.push_back(char16_t(0xd800 + (c >> 10)));
+			s.push_back(char16_t(0xdc00 + (c & 0x3ff)));
+		}
+	}
+	return s;
+}
+
+template <typename Encode>
+static double measure(int32_t iterations, Encode encode) {
+	size_t checksum = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int32_t i = 0; i < iterations; ++i) {
+		checksum += encode();
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	if (checksum == 0) {
+		fprintf(stderr, "unexpected empty output\n");
+	}
+	return elapsed.count() * 1e9 / iterations;
+}
+
+int main(int argc, const char *argv[]) {
+	int32_t iterations = argc > 1 ? atoi(argv[1]) : 20000;
+	if (iterations <= 0) {
+		fprintf(stderr, "Usage: %s [iterations]\n", argv[0]);
+		return EXIT_FAILURE;
+	}
+
+	static const char *const shapes[] = { "latin", "cyrillic", "cjk", "emoji" };
+	static const int32_t lengths[] = { 16, 59, 250, 1000 };
+	int status = EXIT_SUCCESS;
+
+	printf("input,code_points,reference_ns,ns,speedup\n");
+	for (const char *shape : shapes) {
+		for (int32_t length : lengths) {
+			std::u16string input = makeInput(shape, length);
+			const UChar *src = reinterpret_cast<const UChar *>(input.data());
+			int32_t srcLength = int32_t(input.size());
+			UChar expected[4096], actual[4096];
+
+			int32_t expectedLength = reference::toPunycode(src, srcLength, expected, 4096);
+			UErrorCode errorCode = U_ZERO_ERROR;
+			int32_t actualLength = u_strToPunycode(src, srcLength, actual, 4096, NULL, &errorCode);
+			if (errorCode > U_ZERO_ERROR || actualLength != expectedLength
+					|| memcmp(actual, expected, expectedLength * sizeof(UChar)) != 0) {
+				fprintf(stderr, "%s/%d: u_strToPunycode() differs from the reference: %s\n", shape, length, u_errorName(errorCode));
+				status = EXIT_FAILURE;
+				continue;
+			}
+
+			double referenceNs = measure(iterations, [&] {
+				return reference::toPunycode(src, srcLength, expected, 4096);
+			});
+			double ns = measure(iterations, [&] {
+				UErrorCode status = U_ZERO_ERROR;
+				return u_strToPunycode(src, srcLength, actual, 4096, NULL, &status);
+			});
+			int32_t cpCount = 0;
+			for (int32_t i = 0; i < srcLength; ++i) {
+				cpCount += !isTrail(src[i]);
+			}
+			printf("%s,%d,%.1f,%.1f,%.2f\n", shape, cpCount, referenceNs, ns, referenceNs / ns);
+		}
+	}
+	return status;
+}
@@ -0,0 +1,414 @@
+// End-to-end benchmark of the public entry points over realistic corpora
+//
+// Usage: bench-suite [-f csv|json] [-t seconds per case] [-d IdnaTestV2.txt]
+// Prints one record per (entry point, corpus) with ns_per_op, names_per_sec and allocs_per_op,
+// where an op is the conversion of one name. Allocations are counted by wrapping malloc (glibc only, -1 otherwise).
+
+#include "unicode/uidna.h"
+#include "idn2.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#ifdef __GLIBC__
+
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+
+}
+
+// Single-threaded benchmark, no atomics needed.
+static uint64_t s_allocations = 0;
+
+extern "C" void *malloc(size_t size) {
+	++s_allocations;
+	return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t count, size_t size) {
+	++s_allocations;
+	return __libc_calloc(count, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+	++s_allocations;
+	return __libc_realloc(ptr, size);
+}
+
+extern "C" void free(void *ptr) {
+	__libc_free(ptr);
+}
+
+static constexpr bool s_countAllocations = true;
+
+#else
+
+static uint64_t s_allocations = 0;
+static constexpr bool s_countAllocations = false;
+
+#endif
+
+static const uint32_t BenchOptions = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ
+		| UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE;
+
+struct Corpus {
+	std::string name;
+	std::vector<std::string> names;
+	std::vector<std::u16string> names16;
+};
+
+static Corpus makeCorpus(const char *name, const char *const *hosts, size_t hostCount, const char *const *zones, size_t zoneCount) {
+	// Every host label with every zone, with a few case variants for the mapping.
+	Corpus corpus;
+	corpus.name = name;
+	for (size_t i = 0; i < hostCount; ++i) {
+		for (size_t j = 0; j < zoneCount; ++j) {
+			std::string host = hosts[i];
+			if ((i + j) % 3 == 0 && !host.empty() && host[0] >= 'a' && host[0] <= 'z') {
+				host[0] -= 0x20;
+			}
+			corpus.names.push_back(host + "." + zones[j]);
+		}
+	}
+	return corpus;
+}
+
+// Minimal UTF-8 to UTF-16 conversion for the inputs of the UTF-16 entry points, ill-formed bytes become U+FFFD.
+static std::u16string toUTF16(const std::string &s) {
+	std::u16string result;
+	for (size_t i = 0; i < s.size();) {
+		uint8_t b = uint8_t(s[i]);
+		int32_t trail = b < 0x80 ? 0 : b >= 0xf0 && b < 0xf5 ? 3 : b >= 0xe0 ? 2 : b >= 0xc2 && b < 0xe0 ? 1 : -1;
+		uint32_t c = trail == 0 ? b : trail > 0 ? b & (0x3f >> trail) : 0xfffd;
+		size_t j = i + 1;
+		for (int32_t k = 0; k < trail; ++k, ++j) {
+			if (j >= s.size() || (uint8_t(s[j]) & 0xc0) != 0x80) {
+				c = 0xfffd;
+				break;
+			}
+			c = (c << 6) | (uint8_t(s[j]) & 0x3f);
+		}
+		if (c > 0xffff) {
+			result.push_back(char16_t(0xd7c0 + (c >> 10)));
+			result.push_back(char16_t(0xdc00 | (c & 0x3ff)));
+		} else {
+			result.push_back(char16_t(c));
+		}
+		i = j;
+	}
+	return result;
+}
+
+// Names with errors: the IdnaTestV2 source strings with a toUnicode status, plus typical malformed input.
+static Corpus makeInvalidCorpus(const char *path) {
+	static const char *const malformed[] = {
+		"a..b", "-abc.com", "abc-.com", "ab--cd.com", "xn--a.com", "xn--ab-.net", "\xe2\x80\x8d" "a.com", "\xd7\x90" "a.com",
+		"under_score.example", ".", "a.b.c.d.e.f.g.h.i.j.k.l.m.n.o.p.q.r.s.t.u.v.w.x.y.z.",
+		"\xcc\x81" "accent.com", "\xef\xbf\xbd.de", "toolonglabeltoolonglabeltoolonglabeltoolonglabeltoolonglabel1234.com"
+	};
+	Corpus corpus;
+	corpus.name = "invalid";
+	for (const char *name : malformed) {
+		corpus.names.push_back(name);
+	}
+	FILE *file = path != NULL ? fopen(path, "r") : NULL;
+	if (file == NULL) {
+		if (path != NULL) {
+			fprintf(stderr, "cannot open %s, using only the built-in invalid names\n", path);
+		}
+		return corpus;
+	}
+	char line[4096];
+	while (fgets(line, sizeof(line), file) != NULL) {
+		// source; toUnicode; toUnicodeStatus; toAsciiN; toAsciiNStatus; toAsciiT; toAsciiTStatus # comment
+		if (line[0] == '#' || strchr(line, '\\') != NULL) {
+			continue;
+		}
+		char *fields[3];
+		char *p = line;
+		int32_t n = 0;
+		for (; n < 3; ++n) {
+			fields[n] = p;
+			p = strchr(p, ';');
+			if (p == NULL) {
+				break;
+			}
+			*p++ = 0;
+		}
+		if (n < 3) {
+			continue;
+		}
+		const char *status = fields[2];
+		while (*status == ' ') {
+			++status;
+		}
+		if (*status == '[') {
+			corpus.names.push_back(fields[0]);
+		}
+	}
+	fclose(file);
+	return corpus;
+}
+
+static std::vector<Corpus> makeCorpora(const char *testDataPath) {
+	static const char *const asciiHosts[] = {
+		"www", "mail", "api", "cdn-edge-01", "static", "login", "example", "my-very-long-subdomain-name", "a", "shop"
+	};
+	static const char *const asciiZones[] = {
+		"example.com", "example.org", "service.internal.corp.net", "co.uk", "github.io", "s3.amazonaws.com"
+	};
+	static const char *const latinHosts[] = {
+		"caf\xc3\xa9", "b\xc3\xbc" "cher", "m\xc3\xbcnchen", "fa\xc3\x9f", "gar\xc3\xa7on", "se\xc3\xb1or", "\xc3\xa5ngstr\xc3\xb6m", "na\xc3\xafve"
+	};
+	static const char *const latinZones[] = {
+		"de", "fr", "example.com", "stra\xc3\x9f" "e.at", "\xc3\xa9t\xc3\xa9.ca"
+	};
+	static const char *const cjkHosts[] = {
+		"\xe4\xbe\x8b\xe5\xad\x90", "\xe6\xb5\x8b\xe8\xaf\x95", "\xe3\x83\x86\xe3\x82\xb9\xe3\x83\x88", "\xed\x95\x9c\xea\xb5\xad",
+		"\xe7\xbd\x91\xe7\xbb\x9c", "\xe3\x81\xbb\xe3\x82\x93\xe3\x81\xa8\xe3\x81\x86"
+	};
+	static const char *const cjkZones[] = {
+		"\xe4\xb8\xad\xe5\x9b\xbd", "\xe5\x85\xac\xe5\x8f\xb8", "\xe6\x97\xa5\xe6\x9c\xac", "com", "\xed\x95\x9c\xea\xb5\xad"
+	};
+	static const char *const bidiHosts[] = {
+		"\xd9\x85\xd8\xab\xd8\xa7\xd9\x84", "\xd8\xa7\xd8\xae\xd8\xaa\xd8\xa8\xd8\xa7\xd8\xb1", "\xd7\x93\xd7\x95\xd7\x92\xd7\x9e\xd7\x94",
+		"\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d" "1", "\xd9\x85\xd9\x88\xd9\x82\xd8\xb9"
+	};
+	static const char *const bidiZones[] = {
+		"\xd9\x85\xd8\xb5\xd8\xb1", "\xd8\xa7\xd9\x84\xd8\xb3\xd8\xb9\xd9\x88\xd8\xaf\xd9\x8a\xd8\xa9", "\xd7\xa7\xd7\x95\xd7\x9d", "com"
+	};
+
+	std::vector<Corpus> corpora;
+	corpora.push_back(makeCorpus("ascii", asciiHosts, sizeof(asciiHosts) / sizeof(asciiHosts[0]), asciiZones, sizeof(asciiZones) / sizeof(asciiZones[0])));
+	corpora.push_back(makeCorpus("latin1", latinHosts, sizeof(latinHosts) / sizeof(latinHosts[0]), latinZones, sizeof(latinZones) / sizeof(latinZones[0])));
+	corpora.push_back(makeCorpus("cjk", cjkHosts, sizeof(cjkHosts) / sizeof(cjkHosts[0]), cjkZones, sizeof(cjkZones) / sizeof(cjkZones[0])));
+	corpora.push_back(makeCorpus("bidi", bidiHosts, sizeof(bidiHosts) / sizeof(bidiHosts[0]), bidiZones, sizeof(bidiZones) / sizeof(bidiZones[0])));
+
+	// The A-label forms of the non-ASCII corpora.
+	Corpus punycode;
+	punycode.name = "punycode";
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(BenchOptions, &errorCode);
+	for (size_t i = 1; i < corpora.size(); ++i) {
+		for (const std::string &name : corpora[i].names) {
+			char dest[256];
+			UIDNAInfo info = { false, 0 };
+			errorCode = U_ZERO_ERROR;
+			int32_t length = uidna_nameToASCII_UTF8(idna, name.data(), int32_t(name.size()), dest, sizeof(dest), &info, &errorCode);
+			if (errorCode <= U_ZERO_ERROR && info.errors == 0) {
+				punycode.names.push_back(std::string(dest, length));
+			}
+		}
+	}
+	uidna_close(idna);
+	corpora.push_back(punycode);
+
+	corpora.push_back(makeInvalidCorpus(testDataPath));
+
+	for (Corpus &corpus : corpora) {
+		for (const std::string &name : corpus.names) {
+			corpus.names16.push_back(toUTF16(name));
+		}
+	}
+	return corpora;
+}
+
+// Converts name i of the corpus, returns the output length.
+typedef std::function<int32_t (const Corpus &corpus, size_t i)> EntryPoint;
+
+struct Result {
+	std::string entry;
+	std::string corpus;
+	uint64_t ops;
+	double nsPerOp;
+	double allocsPerOp;
+};
+
+static Result run(const char *entry, const EntryPoint &fn, const Corpus &corpus, double minSeconds) {
+	size_t checksum = 0;
+	for (size_t i = 0; i < corpus.names.size(); ++i) {
+		checksum += fn(corpus, i);  // warm-up
+	}
+	uint64_t ops = 0;
+	uint64_t allocations = s_allocations;
+	auto start = std::chrono::steady_clock::now();
+	std::chrono::duration<double> elapsed;
+	do {
+		for (size_t i = 0; i < corpus.names.size(); ++i) {
+			checksum += fn(corpus, i);
+		}
+		ops += corpus.names.size();
+		elapsed = std::chrono::steady_clock::now() - start;
+	} while (elapsed.count() < minSeconds);
+	allocations = s_allocations - allocations;
+	if (checksum == 0) {
+		fprintf(stderr, "%s on %s: unexpected empty output\n", entry, corpus.name.c_str());
+	}
+	return Result{ entry, corpus.name, ops, elapsed.count() * 1e9 / ops, s_countAllocations ? double(allocations) / ops : -1.0 };
+}
+
+int main(int argc, const char *argv[]) {
+	bool json = false;
+	double minSeconds = 0.2;
+	const char *testDataPath = NULL;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+			json = strcmp(argv[++i], "json") == 0;
+		} else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+			minSeconds = atof(argv[++i]);
+		} else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+			testDataPath = argv[++i];
+		} else {
+			fprintf(stderr, "Usage: %s [-f csv|json] [-t seconds per case] [-d IdnaTestV2.txt]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::vector<Corpus> corpora = makeCorpora(testDataPath);
+
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(BenchOptions, &errorCode);
+	UIDNA *arenaIdna = uidna_open(BenchOptions, &errorCode);
+	uidna_setCallArena(arenaIdna, 16 * 1024, &errorCode);
+	// Stops at any error, compare with uidna_nameToASCII_UTF8 on the invalid corpus.
+	UIDNA *failFastIdna = uidna_open(BenchOptions | UIDNA_FAIL_FAST, &errorCode);
+	// Skips normalization, compare with uidna_nameToASCII_UTF8 on the normalized corpora (all but invalid).
+	UIDNA *trustedIdna = uidna_open(BenchOptions | UIDNA_TRUSTED_NFC_INPUT, &errorCode);
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "uidna_open() failed: %s\n", u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	static char dest[1024];
+	static UChar dest16[1024];
+	auto info = [] { return UIDNAInfo{ false, 0 }; };
+
+	std::vector<std::pair<const char *, EntryPoint>> entries = {
+		{ "uidna_nameToASCII", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToASCII(idna, reinterpret_cast<const UChar *>(c.names16[i].data()), int32_t(c.names16[i].size()), dest16, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToUnicode", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToUnicode(idna, reinterpret_cast<const UChar *>(c.names16[i].data()), int32_t(c.names16[i].size()), dest16, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToASCII+arena", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToASCII(arenaIdna, reinterpret_cast<const UChar *>(c.names16[i].data()), int32_t(c.names16[i].size()), dest16, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToASCII_UTF8", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToASCII_UTF8(idna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToASCII_UTF8+failfast", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			// Names that stop early have no output, count them as work done.
+			return uidna_nameToASCII_UTF8(failFastIdna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status) + 1;
+		} },
+		{ "uidna_nameToASCII_UTF8+trusted", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToASCII_UTF8(trustedIdna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToASCII_UTF8_view", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			const char *result;
+			int32_t length = uidna_nameToASCII_UTF8_view(idna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &result, NULL, &pInfo, &status);
+			return length + result[0];
+		} },
+		{ "uidna_nameToUnicodeUTF8", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToUnicodeUTF8(idna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "uidna_nameToUnicodeUTF8+failfast", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToUnicodeUTF8(failFastIdna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status) + 1;
+		} },
+		{ "uidna_nameToUnicodeUTF8+trusted", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return uidna_nameToUnicodeUTF8(trustedIdna, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "uidna_checkNameUTF8", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return int32_t(uidna_checkNameUTF8(idna, c.names[i].data(), int32_t(c.names[i].size()), &pInfo, &status));
+		} },
+		{ "uidna_isValidNameUTF8", [&] (const Corpus &c, size_t i) {
+			UErrorCode status = U_ZERO_ERROR;
+			return int32_t(uidna_isValidNameUTF8(idna, c.names[i].data(), int32_t(c.names[i].size()), &status));
+		} },
+		{ "u_nameToASCII_UTF8", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return u_nameToASCII_UTF8(BenchOptions, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "u_nameToUnicodeUTF8", [&] (const Corpus &c, size_t i) {
+			UIDNAInfo pInfo = info();
+			UErrorCode status = U_ZERO_ERROR;
+			return u_nameToUnicodeUTF8(BenchOptions, c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &pInfo, &status);
+		} },
+		{ "u_strToPunycode", [&] (const Corpus &c, size_t i) {
+			UErrorCode status = U_ZERO_ERROR;
+			return u_strToPunycode(reinterpret_cast<const UChar *>(c.names16[i].data()), int32_t(c.names16[i].size()), dest16, 1024, NULL, &status);
+		} },
+		{ "u_strToPunycodeUTF8", [&] (const Corpus &c, size_t i) {
+			UErrorCode status = U_ZERO_ERROR;
+			return u_strToPunycodeUTF8(c.names[i].data(), int32_t(c.names[i].size()), dest, 1024, &status);
+		} },
+		{ "idn2_lookup_u8", [&] (const Corpus &c, size_t i) {
+			uint8_t *lookupname = NULL;
+			int32_t length = 0;
+			if (idn2_lookup_u8(reinterpret_cast<const uint8_t *>(c.names[i].c_str()), &lookupname, IDN2_NONTRANSITIONAL) == IDN2_OK) {
+				length = int32_t(strlen(reinterpret_cast<const char *>(lookupname)));
+			}
+			idn2_free(lookupname);
+			return length + 1;  // invalid names count as work done, too
+		} },
+	};
+
+	std::vector<Result> results;
+	for (auto &entry : entries) {
+		for (const Corpus &corpus : corpora) {
+			results.push_back(run(entry.first, entry.second, corpus, minSeconds));
+		}
+	}
+	uidna_close(idna);
+	uidna_close(arenaIdna);
+	uidna_close(failFastIdna);
+	uidna_close(trustedIdna);
+
+	if (json) {
+		printf("{\n  \"library\": \"libuidna\",\n  \"version\": \"%s\",\n  \"results\": [\n", IDN2_VERSION);
+		for (size_t i = 0; i < results.size(); ++i) {
+			const Result &r = results[i];
+			printf("    { \"entry\": \"%s\", \"corpus\": \"%s\", \"ops\": %llu, \"ns_per_op\": %.1f, \"names_per_sec\": %.0f, \"allocs_per_op\": %.2f }%s\n",
+					r.entry.c_str(), r.corpus.c_str(), (unsigned long long) r.ops, r.nsPerOp, 1e9 / r.nsPerOp, r.allocsPerOp,
+					i + 1 < results.size() ? "," : "");
+		}
+		printf("  ]\n}\n");
+	} else {
+		printf("entry,corpus,ops,ns_per_op,names_per_sec,allocs_per_op\n");
+		for (const Result &r : results) {
+			printf("%s,%s,%llu,%.1f,%.0f,%.2f\n", r.entry.c_str(), r.corpus.c_str(), (unsigned long long) r.ops, r.nsPerOp, 1e9 / r.nsPerOp, r.allocsPerOp);
+		}
+	}
+	return EXIT_SUCCESS;
+}
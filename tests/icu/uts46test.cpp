@@ -18,10 +18,14 @@
 #ifdef UIDNA_SOURCES
 #include "u_macro.h"
 #include "u_norm2.h"
+#include "u_ascii.h"
+#include "u_idnaprops.h"
 #endif
 #include <unistd.h>
 #include <stdio.h>
 #include <limits.h>
+#include <vector>
+#include <thread>
 
 namespace uidna {
 
@@ -468,6 +472,28 @@ void UTS46Test::runIndexedTest(int32_t index, UBool exec, const char *&name) {
 		TESTCASE_AUTO(TestACELabelEdgeCases);
 		TESTCASE_AUTO(TestTooLong);
 		TESTCASE_AUTO(TestSomeCases);
+		TESTCASE_AUTO(TestUTF8IllFormed);
+		TESTCASE_AUTO(TestBatch);
+		TESTCASE_AUTO(TestBatchParallel);
+		TESTCASE_AUTO(TestASCIIKernels);
+		TESTCASE_AUTO(TestLongUTF8);
+		TESTCASE_AUTO(TestCache);
+		TESTCASE_AUTO(TestLabelCache);
+		TESTCASE_AUTO(TestAllocator);
+		TESTCASE_AUTO(TestContext);
+		TESTCASE_AUTO(TestPunycodeEncoder);
+		TESTCASE_AUTO(TestPunycodeUTF8);
+		TESTCASE_AUTO(TestCheckName);
+		TESTCASE_AUTO(TestNameToASCIIView);
+		TESTCASE_AUTO(TestEngines);
+		TESTCASE_AUTO(TestIDNAProps);
+		TESTCASE_AUTO(TestInertRuns);
+		TESTCASE_AUTO(TestContextualChecks);
+		TESTCASE_AUTO(TestLabelsAppended);
+		TESTCASE_AUTO(TestTrustedNFCInput);
+		TESTCASE_AUTO(TestDualConversion);
+		TESTCASE_AUTO(TestASCIIAndUnicode);
+		TESTCASE_AUTO(TestFailFast);
 		TESTCASE_AUTO(IdnaTest);
 		TESTCASE_AUTO_END
 	;
@@ -1293,6 +1319,49 @@ void UTS46Test::idnaTestOneLine(char *fields[][2], UErrorCode &errorCode) {
 	checkIdnaTestResult(fields[0][0], "toASCIINontrans", toAsciiN, aN, toAsciiNStatus.c_str(), aNInfo);
 	trans.nameToASCII(source, aT, aTInfo, errorCode);
 	checkIdnaTestResult(fields[0][0], "toASCIITrans", toAsciiT, aT, toAsciiTStatus.c_str(), aTInfo);
+
+	// Validation only must find the same errors as toASCII.
+	IDNAInfo cNInfo, cTInfo, vNInfo;
+	nontrans.checkName(source, false, cNInfo, errorCode);
+	trans.checkName(source, false, cTInfo, errorCode);
+	nontrans.checkName(source, true, vNInfo, errorCode);
+	if (cNInfo.getErrors() != aNInfo.getErrors() || cTInfo.getErrors() != aTInfo.getErrors() || vNInfo.hasErrors() != aNInfo.hasErrors()) {
+		errln("checkName() errors %04lx/%04lx vs. toASCII %04lx/%04lx\n    %s",
+				(long) cNInfo.getErrors(), (long) cTInfo.getErrors(), (long) aNInfo.getErrors(), (long) aTInfo.getErrors(), fields[0][0]);
+	}
+
+	// The UTF-8 API must match the UTF-16 API,
+	// except for sources with unpaired surrogates which UTF-8 cannot represent.
+	std::string source8, uN8, aN8, aT8;
+	source.toUTF8String(source8);
+	if (UnicodeString::fromUTF8(source8) != source) {
+		return;
+	}
+	StringByteSink<std::string> uN8Sink(&uN8), aN8Sink(&aN8), aT8Sink(&aT8);
+	IDNAInfo uN8Info, aN8Info, aT8Info;
+	nontrans.nameToUnicodeUTF8(source8, uN8Sink, uN8Info, errorCode);
+	nontrans.nameToASCII_UTF8(source8, aN8Sink, aN8Info, errorCode);
+	trans.nameToASCII_UTF8(source8, aT8Sink, aT8Info, errorCode);
+	if (UnicodeString::fromUTF8(uN8) != uN || uN8Info.getErrors() != uNInfo.getErrors()) {
+		errln("toUnicodeNontrans UTF-8 vs. UTF-16 different result or errors %04lx vs. %04lx\n    %s", (long) uN8Info.getErrors(), (long) uNInfo.getErrors(), fields[0][0]);
+	}
+	if (UnicodeString::fromUTF8(aN8) != aN || aN8Info.getErrors() != aNInfo.getErrors()) {
+		errln("toASCIINontrans UTF-8 vs. UTF-16 different result or errors %04lx vs. %04lx\n    %s", (long) aN8Info.getErrors(), (long) aNInfo.getErrors(), fields[0][0]);
+	}
+	if (UnicodeString::fromUTF8(aT8) != aT || aT8Info.getErrors() != aTInfo.getErrors()) {
+		errln("toASCIITrans UTF-8 vs. UTF-16 different result or errors %04lx vs. %04lx\n    %s", (long) aT8Info.getErrors(), (long) aTInfo.getErrors(), fields[0][0]);
+	}
+	IDNAInfo cN8Info, cT8Info, vN8Info;
+	nontrans.checkNameUTF8(source8, false, cN8Info, errorCode);
+	trans.checkNameUTF8(source8, false, cT8Info, errorCode);
+	nontrans.checkNameUTF8(source8, true, vN8Info, errorCode);
+	if (cN8Info.getErrors() != aNInfo.getErrors() || cT8Info.getErrors() != aTInfo.getErrors() || vN8Info.hasErrors() != aNInfo.hasErrors()) {
+		errln("checkNameUTF8() errors %04lx/%04lx vs. toASCII %04lx/%04lx\n    %s",
+				(long) cN8Info.getErrors(), (long) cT8Info.getErrors(), (long) aNInfo.getErrors(), (long) aTInfo.getErrors(), fields[0][0]);
+	}
+	if (nontrans.isCanonicalASCIIName(source8) && (aN8 != source8 || aN8Info.hasErrors())) {
+		errln("isCanonicalASCIIName() but toASCII changes the name or has errors %04lx\n    %s", (long) aN8Info.getErrors(), fields[0][0]);
+	}
 }
 
 // TODO: de-duplicate
@@ -1450,6 +1519,1785 @@ static void u_parseDelimitedFile(const char *filename, char delimiter, char *fie
 }
 
 // http://www.unicode.org/Public/idna/latest/IdnaTest.txt
+void UTS46Test::TestUTF8IllFormed() {
+	// Ill-formed UTF-8 must be processed as if each maximal subpart
+	// were converted to U+FFFD first, as by the UTF-16 API.
+	static const char *const cases[] = {
+		"a\x80" "b.com",
+		"\xc3.example",
+		"ab\xe2\x82.de",
+		"\xf0\x9f\x98",
+		"xn--\xff",
+		"\xed\xa0\x80" "abc",
+		"\xc0\xafx.org",
+		"\xc3\xe2\x80\x8d\x9f.de",  // ill-formed, ZWJ, ill-formed
+		"fa\xc3\x9f\xe2\x80\x8c\xcc.de",  // deviation characters then an ill-formed sequence
+		"a\xcc\x81\xf4\x90\x80\x80\xcc\x81",
+		"\xd7\x90\x80.\xd7\x91",
+		"ABC.D\xe9" "F.\xce\xb1\xcf\x82"
+	};
+	for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+		IcuTestErrorCode errorCode(*this, "TestUTF8IllFormed()");
+		std::string input8(cases[i]);
+		UnicodeString input = UnicodeString::fromUTF8(input8);
+		const UTS46 *const processors[] = { &trans, &nontrans };
+		for (const UTS46 *uts46 : processors) {
+			UnicodeString a16, u16;
+			std::string a8, u8;
+			StringByteSink<std::string> a8Sink(&a8), u8Sink(&u8);
+			IDNAInfo a16Info, u16Info, a8Info, u8Info;
+			uts46->nameToASCII(input, a16, a16Info, errorCode);
+			uts46->nameToUnicode(input, u16, u16Info, errorCode);
+			uts46->nameToASCII_UTF8(input8, a8Sink, a8Info, errorCode);
+			uts46->nameToUnicodeUTF8(input8, u8Sink, u8Info, errorCode);
+			if (errorCode.errIfFailureAndReset("processing case %d", (int) i)) {
+				continue;
+			}
+			if (UnicodeString::fromUTF8(a8) != a16 || a8Info.getErrors() != a16Info.getErrors()) {
+				errln("nameToASCII_UTF8(case %d) vs. UTF-16 different result or errors %04lx vs. %04lx", (int) i, (long) a8Info.getErrors(), (long) a16Info.getErrors());
+			}
+			if (UnicodeString::fromUTF8(u8) != u16 || u8Info.getErrors() != u16Info.getErrors()) {
+				errln("nameToUnicodeUTF8(case %d) vs. UTF-16 different result or errors %04lx vs. %04lx", (int) i, (long) u8Info.getErrors(), (long) u16Info.getErrors());
+			}
+			if (!u8Info.hasErrors()) {
+				errln("nameToUnicodeUTF8(case %d) did not report the ill-formed sequence", (int) i);
+			}
+		}
+	}
+}
+
+void UTS46Test::TestBatch() {
+#ifdef UIDNA_SOURCES
+	// The batch functions must match single calls, with results packed into the arena.
+	static const char *const inputs[] = {
+		"www.eXample.cOm", "Bücher.de", "faß.de", "", "a..b", "xn--ab-", "אב.com", "\xc3x"
+	};
+	const int32_t count = UPRV_LENGTHOF(inputs);
+	UIDNAName names[count];
+	for (int32_t i = 0; i < count; ++i) {
+		names[i].data = inputs[i];
+		names[i].length = i % 2 ? -1 : (int32_t) strlen(inputs[i]);
+	}
+	const UIDNA *idna = reinterpret_cast<const UIDNA*>(&nontrans);
+	for (UBool toASCII : { true, false }) {
+		IcuTestErrorCode errorCode(*this, "TestBatch()");
+		char arena[400];
+		int32_t offsets[count], lengths[count];
+		UIDNAInfo infos[count];
+		int32_t total = toASCII
+				? uidna_nameToASCII_UTF8_batch(idna, names, count, arena, UPRV_LENGTHOF(arena), offsets, lengths, infos, errorCode)
+				: uidna_nameToUnicodeUTF8_batch(idna, names, count, arena, UPRV_LENGTHOF(arena), offsets, lengths, infos, errorCode);
+		if (errorCode.errIfFailureAndReset("batch toASCII=%d", toASCII)) {
+			continue;
+		}
+		int32_t expectedOffset = 0;
+		for (int32_t i = 0; i < count; ++i) {
+			char single[100];
+			UIDNAInfo info = { false, 0 };
+			int32_t length = toASCII
+					? uidna_nameToASCII_UTF8(idna, inputs[i], -1, single, UPRV_LENGTHOF(single), &info, errorCode)
+					: uidna_nameToUnicodeUTF8(idna, inputs[i], -1, single, UPRV_LENGTHOF(single), &info, errorCode);
+			errorCode.errIfFailureAndReset("single toASCII=%d [%d]", toASCII, (int) i);
+			if (offsets[i] != expectedOffset || lengths[i] != length || 0 != memcmp(arena + offsets[i], single, length)) {
+				errln("batch toASCII=%d [%d] %s: result differs from the single call", toASCII, (int) i, inputs[i]);
+			}
+			if (infos[i].errors != info.errors || infos[i].isTransitionalDifferent != info.isTransitionalDifferent) {
+				errln("batch toASCII=%d [%d] %s: errors %04lx vs. %04lx", toASCII, (int) i, inputs[i], (long) infos[i].errors, (long) info.errors);
+			}
+			expectedOffset += length;
+		}
+		assertEquals("batch total length", expectedOffset, total);
+
+		// Preflighting with a short arena.
+		int32_t required = uidna_nameToASCII_UTF8_batch(idna, names, count, arena, 10, offsets, lengths, NULL, errorCode);
+		errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+		if (toASCII) {
+			assertEquals("batch preflight length", total, required);
+		}
+	}
+#endif
+}
+
+void UTS46Test::TestBatchParallel() {
+#ifdef UIDNA_SOURCES
+	// The parallel batch must produce exactly the serial batch results, in input order,
+	// for any number of threads and with a mix of cheap and expensive names.
+	static const char *const inputs[] = {
+		"www.example.com", "B\xc3\xbc" "cher.de", "xn--bcher-kva.xn--p1ai", "fa\xc3\x9f.de",
+		"\xd7\x90\xd7\x91.com", "a..b", "\xe2\x98\x83.net", "-x.y", "\xc3x", ""
+	};
+	const int32_t count = 1000;
+	std::vector<std::string> storage(count);
+	std::vector<UIDNAName> names(count);
+	for (int32_t i = 0; i < count; ++i) {
+		storage[i] = inputs[(i * 7) % UPRV_LENGTHOF(inputs)];
+		if (i % 13 == 0) {
+			// occasional long names
+			for (int32_t j = 0; j < 5; ++j) {
+				storage[i] += ".\xe4\xbe\x8b\xe5\xad\x90" "label";
+			}
+		}
+		names[i].data = storage[i].data();
+		names[i].length = (int32_t) storage[i].size();
+	}
+	const UIDNA *idna = reinterpret_cast<const UIDNA*>(&trans);
+	for (UBool toASCII : { true, false }) {
+		IcuTestErrorCode errorCode(*this, "TestBatchParallel()");
+		std::vector<char> arena(count * 100);
+		std::vector<int32_t> offsets(count), lengths(count);
+		std::vector<UIDNAInfo> infos(count);
+		int32_t total = toASCII
+				? uidna_nameToASCII_UTF8_batch(idna, names.data(), count, arena.data(), (int32_t) arena.size(), offsets.data(), lengths.data(), infos.data(), errorCode)
+				: uidna_nameToUnicodeUTF8_batch(idna, names.data(), count, arena.data(), (int32_t) arena.size(), offsets.data(), lengths.data(), infos.data(), errorCode);
+		if (errorCode.errIfFailureAndReset("serial batch toASCII=%d", toASCII)) {
+			continue;
+		}
+		for (int32_t threads : { 1, 2, 3, 8, 0 }) {
+			std::vector<char> pArena(count * 100);
+			std::vector<int32_t> pOffsets(count), pLengths(count);
+			std::vector<UIDNAInfo> pInfos(count);
+			int32_t pTotal = toASCII
+					? uidna_nameToASCII_UTF8_batchParallel(idna, names.data(), count, pArena.data(), (int32_t) pArena.size(), pOffsets.data(), pLengths.data(), pInfos.data(), threads, errorCode)
+					: uidna_nameToUnicodeUTF8_batchParallel(idna, names.data(), count, pArena.data(), (int32_t) pArena.size(), pOffsets.data(), pLengths.data(), pInfos.data(), threads, errorCode);
+			if (errorCode.errIfFailureAndReset("parallel batch toASCII=%d threads=%d", toASCII, threads)) {
+				continue;
+			}
+			if (pTotal != total || 0 != memcmp(arena.data(), pArena.data(), total) || offsets != pOffsets || lengths != pLengths) {
+				errln("parallel batch toASCII=%d threads=%d: results differ from the serial batch", toASCII, threads);
+			}
+			for (int32_t i = 0; i < count; ++i) {
+				if (infos[i].errors != pInfos[i].errors || infos[i].isTransitionalDifferent != pInfos[i].isTransitionalDifferent) {
+					errln("parallel batch toASCII=%d threads=%d [%d]: different errors", toASCII, threads, (int) i);
+					break;
+				}
+			}
+			// Preflighting with a short arena.
+			int32_t required = toASCII
+					? uidna_nameToASCII_UTF8_batchParallel(idna, names.data(), count, pArena.data(), 100, pOffsets.data(), pLengths.data(), NULL, threads, errorCode)
+					: uidna_nameToUnicodeUTF8_batchParallel(idna, names.data(), count, pArena.data(), 100, pOffsets.data(), pLengths.data(), NULL, threads, errorCode);
+			errorCode.expectErrorAndReset(U_BUFFER_OVERFLOW_ERROR);
+			assertEquals("parallel batch preflight length", total, required);
+			if (0 != memcmp(arena.data(), pArena.data(), 100)) {
+				errln("parallel batch toASCII=%d threads=%d: short arena prefix differs", toASCII, threads);
+			}
+		}
+	}
+#endif
+}
+
+void UTS46Test::TestASCIIKernels() {
+#ifdef UIDNA_SOURCES
+	// Every SIMD kernel of the ASCII fastpath must give the same results as the scalar kernel,
+	// block by block and for whole names.
+	static const char alphabet[] = "abcxyzABCXYZ0189-.-..@_ \x7f\x80\xc3";
+	static const UChar extra16[] = { 0x00df, 0x0130, 0x3002, 0x8000, 0xd800, 0xff0e, 0xffff };
+	const ASCIIBlockKernel *scalar = getASCIIBlockKernel(ASCIIKernelType::Scalar);
+	const ASCIIKernelType defaultType = getASCIIBlockKernel().type;
+	uint32_t seed = 1;
+	auto next = [&] (uint32_t limit) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % limit;
+	};
+	for (ASCIIKernelType type : { ASCIIKernelType::SSE2, ASCIIKernelType::AVX2 }) {
+		const ASCIIBlockKernel *kernel = getASCIIBlockKernel(type);
+		if (kernel == NULL) {
+			logln("ASCII kernel %d is not available", (int) type);
+			continue;
+		}
+		for (int32_t n = 0; n < 2000; ++n) {
+			char src8[ASCIIBlockSize], expected8[ASCIIBlockSize], actual8[ASCIIBlockSize];
+			UChar src16[ASCIIBlockSize], expected16[ASCIIBlockSize], actual16[ASCIIBlockSize];
+			for (int32_t i = 0; i < ASCIIBlockSize; ++i) {
+				// Mostly ASCII letters and digits, sometimes anything.
+				src8[i] = next(4) ? alphabet[next(UPRV_LENGTHOF(alphabet) - 1)] : char(next(256));
+				src16[i] = next(8) ? (uint8_t) src8[i] : extra16[next(UPRV_LENGTHOF(extra16))];
+			}
+			for (UBool disallowNonLDHDot : { false, true }) {
+				ASCIIBlockMasks expected = processASCIIBlock(*scalar, src8, expected8, disallowNonLDHDot);
+				ASCIIBlockMasks actual = processASCIIBlock(*kernel, src8, actual8, disallowNonLDHDot);
+				int32_t valid = expected.stop ? countTrailingZeros(expected.stop) : ASCIIBlockSize;
+				if (actual.stop != expected.stop || actual.special != expected.special || 0 != memcmp(expected8, actual8, valid)) {
+					errln("ASCII kernel %d UTF-8 block %d STD3=%d differs from the scalar kernel", (int) type, (int) n, disallowNonLDHDot);
+				}
+				expected = processASCIIBlock(*scalar, src16, expected16, disallowNonLDHDot);
+				actual = processASCIIBlock(*kernel, src16, actual16, disallowNonLDHDot);
+				valid = expected.stop ? countTrailingZeros(expected.stop) : ASCIIBlockSize;
+				if (actual.stop != expected.stop || actual.special != expected.special || 0 != u_memcmp(expected16, actual16, valid)) {
+					errln("ASCII kernel %d UTF-16 block %d STD3=%d differs from the scalar kernel", (int) type, (int) n, disallowNonLDHDot);
+				}
+			}
+		}
+
+		// Whole names, with label boundaries and hyphens anywhere relative to the blocks.
+		IcuTestErrorCode errorCode(*this, "TestASCIIKernels()");
+		UTS46 notSTD3(UIDNA_CHECK_BIDI, errorCode);
+		for (int32_t n = 0; n < 500; ++n) {
+			std::string name;
+			int32_t length = next(300);
+			for (int32_t i = 0; i < length; ++i) {
+				name += next(16) ? alphabet[next(18)] : alphabet[next(UPRV_LENGTHOF(alphabet) - 1)];
+			}
+			UnicodeString name16 = UnicodeString::fromUTF8(name);
+			for (const UTS46 *uts46 : { &trans, &notSTD3 }) {
+				std::string expected8, actual8;
+				UnicodeString expected16, actual16;
+				IDNAInfo expectedInfo8, actualInfo8, expectedInfo16, actualInfo16;
+				StringByteSink<std::string> expectedSink(&expected8), actualSink(&actual8);
+				setASCIIBlockKernel(ASCIIKernelType::Scalar);
+				uts46->nameToASCII_UTF8(name, expectedSink, expectedInfo8, errorCode);
+				uts46->nameToASCII(name16, expected16, expectedInfo16, errorCode);
+				setASCIIBlockKernel(type);
+				uts46->nameToASCII_UTF8(name, actualSink, actualInfo8, errorCode);
+				uts46->nameToASCII(name16, actual16, actualInfo16, errorCode);
+				if (errorCode.errIfFailureAndReset("ASCII kernel %d name %d", (int) type, (int) n)) {
+					continue;
+				}
+				if (expected8 != actual8 || expectedInfo8.getErrors() != actualInfo8.getErrors()) {
+					errln("ASCII kernel %d UTF-8 name %d \"%s\" differs from the scalar kernel", (int) type, (int) n, name.c_str());
+				}
+				if (expected16 != actual16 || expectedInfo16.getErrors() != actualInfo16.getErrors()) {
+					errln("ASCII kernel %d UTF-16 name %d \"%s\" differs from the scalar kernel", (int) type, (int) n, name.c_str());
+				}
+			}
+		}
+	}
+	setASCIIBlockKernel(defaultType);
+#endif
+}
+
+void UTS46Test::TestLongUTF8() {
+#ifdef UIDNA_SOURCES
+	// Names longer than the UTF-8 fastpath chunks, with labels and "??--" hyphens across chunk boundaries
+	// and non-ASCII anywhere, must be processed like their UTF-16 versions, with any sink buffer size.
+	static const char *const pieces[] = {
+		"abc", "XyZ", "0", "-", ".", "ab--c", "xn--bcher-kva", "\xc3\xbc", "\xe2\x80\x8d", "\xd7\x90", "_"
+	};
+	uint32_t seed = 7;
+	auto next = [&] (uint32_t limit) {
+		seed = seed * 1103515245 + 12345;
+		return (seed >> 16) % limit;
+	};
+	IcuTestErrorCode errorCode(*this, "TestLongUTF8()");
+	for (int32_t n = 0; n < 300; ++n) {
+		std::string name;
+		int32_t length = 200 + next(3000);
+		UBool ascii = next(2);
+		while ((int32_t) name.length() < length) {
+			uint32_t piece = next(ascii ? 7 : UPRV_LENGTHOF(pieces));
+			int32_t repeat = piece < 3 ? 1 + next(40) : 1;
+			while (repeat-- > 0) {
+				name += pieces[piece];
+			}
+		}
+		UnicodeString name16 = UnicodeString::fromUTF8(name);
+		for (const UTS46 *uts46 : { &trans, &nontrans }) {
+			for (UBool toASCII : { true, false }) {
+				UnicodeString expected;
+				IDNAInfo expectedInfo;
+				if (toASCII) {
+					uts46->nameToASCII(name16, expected, expectedInfo, errorCode);
+				} else {
+					uts46->nameToUnicode(name16, expected, expectedInfo, errorCode);
+				}
+				std::string expected8;
+				expected.toUTF8String(expected8);
+
+				// Growing sink, and a fixed buffer that may be too short.
+				std::string actual8;
+				StringByteSink<std::string> sink(&actual8);
+				IDNAInfo info;
+				if (toASCII) {
+					uts46->nameToASCII_UTF8(name, sink, info, errorCode);
+				} else {
+					uts46->nameToUnicodeUTF8(name, sink, info, errorCode);
+				}
+				if (errorCode.errIfFailureAndReset("long name %d toASCII=%d", (int) n, toASCII)) {
+					continue;
+				}
+				if (actual8 != expected8 || info.getErrors() != expectedInfo.getErrors()) {
+					errln("long name %d toASCII=%d: UTF-8 %04lx vs. UTF-16 %04lx processing differs", (int) n, toASCII,
+							(long) info.getErrors(), (long) expectedInfo.getErrors());
+				}
+				for (int32_t capacity : { 0, 100, 257, (int32_t) expected8.length() }) {
+					std::vector<char> buffer(capacity + 1);
+					CheckedArrayByteSink checked(buffer.data(), capacity);
+					IDNAInfo checkedInfo;
+					if (toASCII) {
+						uts46->nameToASCII_UTF8(name, checked, checkedInfo, errorCode);
+					} else {
+						uts46->nameToUnicodeUTF8(name, checked, checkedInfo, errorCode);
+					}
+					int32_t written = capacity < (int32_t) expected8.length() ? capacity : (int32_t) expected8.length();
+					if (checked.NumberOfBytesAppended() != (int32_t) expected8.length() || 0 != memcmp(buffer.data(), expected8.data(), written)
+							|| checkedInfo.getErrors() != expectedInfo.getErrors()) {
+						errln("long name %d toASCII=%d capacity=%d: UTF-8 processing differs", (int) n, toASCII, (int) capacity);
+					}
+				}
+			}
+		}
+	}
+#endif
+}
+
+void UTS46Test::TestCache() {
+#ifdef UIDNA_SOURCES
+	// Cached results, including errors for invalid names, must be identical to uncached ones,
+	// also under eviction pressure and with concurrent lookups and insertions.
+	static const char *const inputs[] = {
+		"www.eXample.cOm", "B\xc3\xbc" "cher.de", "xn--bcher-kva.xn--p1ai", "fa\xc3\x9f.de", "\xd7\x90\xd7\x91.com",
+		"a..b", "xn--ab-", "-x.y", "\xc3x", "\xe2\x80\x8d.com", "xn--a.xn--nxa", "ab--c.de", "\xe2\x98\x83.net"
+	};
+	IcuTestErrorCode errorCode(*this, "TestCache()");
+	UIDNA *plain = uidna_open(OptionsNonTrans, errorCode);
+	UIDNA *cached = uidna_open(OptionsNonTrans, errorCode);
+	uidna_setCache(cached, 1 << 20, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()/uidna_setCache()")) {
+		uidna_close(plain);
+		uidna_close(cached);
+		return;
+	}
+
+	auto check = [&] (UIDNA *idna, int32_t n, UBool toASCII, int32_t capacity) {
+		std::string name = inputs[n % UPRV_LENGTHOF(inputs)];
+		if (n >= UPRV_LENGTHOF(inputs)) {
+			name = std::to_string(n) + "-" + name;
+		}
+		char expected[256], actual[256];
+		UIDNAInfo expectedInfo = { false, 0 }, actualInfo = { false, 0 };
+		UErrorCode expectedCode = U_ZERO_ERROR, actualCode = U_ZERO_ERROR;
+		int32_t expectedLength, actualLength;
+		if (toASCII) {
+			expectedLength = uidna_nameToASCII_UTF8(plain, name.data(), (int32_t) name.length(), expected, capacity, &expectedInfo, &expectedCode);
+			actualLength = uidna_nameToASCII_UTF8(idna, name.data(), (int32_t) name.length(), actual, capacity, &actualInfo, &actualCode);
+		} else {
+			expectedLength = uidna_nameToUnicodeUTF8(plain, name.data(), (int32_t) name.length(), expected, capacity, &expectedInfo, &expectedCode);
+			actualLength = uidna_nameToUnicodeUTF8(idna, name.data(), (int32_t) name.length(), actual, capacity, &actualInfo, &actualCode);
+		}
+		int32_t written = expectedLength < capacity ? expectedLength : capacity;
+		return expectedLength == actualLength && expectedCode == actualCode && 0 == memcmp(expected, actual, written)
+				&& expectedInfo.errors == actualInfo.errors && expectedInfo.isTransitionalDifferent == actualInfo.isTransitionalDifferent;
+	};
+
+	// Misses, then hits; the short buffer is served from the cache as well.
+	for (int32_t round = 0; round < 3; ++round) {
+		for (int32_t n = 0; n < UPRV_LENGTHOF(inputs); ++n) {
+			for (UBool toASCII : { true, false }) {
+				if (!check(cached, n, toASCII, round == 2 ? 5 : 256)) {
+					errln("cached conversion round %d [%d] toASCII=%d differs from uncached", (int) round, (int) n, toASCII);
+				}
+			}
+		}
+	}
+	UIDNACacheStats stats;
+	uidna_getCacheStats(cached, &stats, errorCode);
+	assertEquals("cache misses", 2 * UPRV_LENGTHOF(inputs), (int64_t) stats.misses);
+	assertEquals("cache hits", 4 * UPRV_LENGTHOF(inputs), (int64_t) stats.hits);
+	assertEquals("cache entries", 2 * UPRV_LENGTHOF(inputs), (int64_t) stats.entries);
+	assertEquals("cache evictions", 0, (int64_t) stats.evictions);
+
+	// A small budget with concurrent users: entries are evicted, results stay the same.
+	const int64_t budget = 16 * 1024;
+	uidna_setCache(cached, budget, errorCode);
+	std::atomic<int32_t> failures { 0 };
+	std::vector<std::thread> threads;
+	for (int32_t t = 0; t < 4; ++t) {
+		threads.emplace_back([&, t] {
+			uint32_t seed = t + 1;
+			for (int32_t i = 0; i < 5000; ++i) {
+				seed = seed * 1103515245 + 12345;
+				// Skewed: mostly a few hot names, sometimes one of many cold ones.
+				int32_t n = (seed >> 16) % 4 ? (seed >> 8) % 8 : (seed >> 16) % 2000;
+				if (!check(cached, n, (seed >> 4) & 1, 256)) {
+					++failures;
+				}
+			}
+		});
+	}
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	assertEquals("concurrent cached conversions that differ from uncached", 0, failures.load());
+	uidna_getCacheStats(cached, &stats, errorCode);
+	assertEquals("cache lookups", 4 * 5000, (int64_t) (stats.hits + stats.misses));
+	assertTrue("cache evictions under a small budget", stats.evictions > 0);
+	assertTrue("cache hits under a small budget", stats.hits > 0);
+	assertTrue("cache memory within budget", stats.memoryUsed <= (uint64_t) budget);
+
+	// Removing the cache.
+	uidna_setCache(cached, 0, errorCode);
+	uidna_getCacheStats(cached, &stats, errorCode);
+	assertEquals("no cache entries", 0, (int64_t) stats.entries);
+	errorCode.errIfFailureAndReset("uidna_getCacheStats()");
+	uidna_close(plain);
+	uidna_close(cached);
+#endif
+}
+
+void UTS46Test::TestLabelCache() {
+#ifdef UIDNA_SOURCES
+	// Names combined from a few labels: memoized labels must give the same results as uncached ones
+	// in every position, next to every other label, including the BiDi and error state across labels.
+	static const char *const labels[] = {
+		"www", "B\xc3\xbc" "cher", "xn--bcher-kva", "xn--p1ai", "fa\xc3\x9f", "\xd7\x90\xd7\x91", "xn--4db", "\xd7\x90" "1",
+		"xn--ab-", "-x", "\xe2\x80\x8d" "a", "xn--a", "ab--c", "\xe2\x98\x83", "\xcc\x81" "a", "XN--BCHER-KVA", "\xd7\x90" "a", "1\xd7\x90", ""
+	};
+	IcuTestErrorCode errorCode(*this, "TestLabelCache()");
+	UIDNA *plain = uidna_open(OptionsNonTrans, errorCode);
+	UIDNA *cached = uidna_open(OptionsNonTrans, errorCode);
+	uidna_setLabelCache(cached, 1 << 20, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()/uidna_setLabelCache()")) {
+		uidna_close(plain);
+		uidna_close(cached);
+		return;
+	}
+
+	int32_t failures = 0;
+	for (int32_t round = 0; round < 2; ++round) {
+		for (int32_t i = 0; i < UPRV_LENGTHOF(labels); ++i) {
+			for (int32_t j = 0; j < UPRV_LENGTHOF(labels); ++j) {
+				std::string name = std::string(labels[i]) + "." + labels[j] + ".com";
+				UnicodeString name16 = UnicodeString::fromUTF8(name);
+				for (UBool toASCII : { true, false }) {
+					char expected[256], actual[256];
+					UChar expected16[256], actual16[256];
+					UIDNAInfo expectedInfo = { false, 0 }, actualInfo = { false, 0 }, expectedInfo16 = { false, 0 }, actualInfo16 = { false, 0 };
+					UErrorCode expectedCode = U_ZERO_ERROR, actualCode = U_ZERO_ERROR;
+					int32_t expectedLength, actualLength, expectedLength16, actualLength16;
+					if (toASCII) {
+						expectedLength = uidna_nameToASCII_UTF8(plain, name.data(), (int32_t) name.length(), expected, 256, &expectedInfo, &expectedCode);
+						actualLength = uidna_nameToASCII_UTF8(cached, name.data(), (int32_t) name.length(), actual, 256, &actualInfo, &actualCode);
+						expectedLength16 = uidna_nameToASCII(plain, name16.getBuffer(), name16.length(), expected16, 256, &expectedInfo16, &expectedCode);
+						actualLength16 = uidna_nameToASCII(cached, name16.getBuffer(), name16.length(), actual16, 256, &actualInfo16, &actualCode);
+					} else {
+						expectedLength = uidna_nameToUnicodeUTF8(plain, name.data(), (int32_t) name.length(), expected, 256, &expectedInfo, &expectedCode);
+						actualLength = uidna_nameToUnicodeUTF8(cached, name.data(), (int32_t) name.length(), actual, 256, &actualInfo, &actualCode);
+						expectedLength16 = uidna_nameToUnicode(plain, name16.getBuffer(), name16.length(), expected16, 256, &expectedInfo16, &expectedCode);
+						actualLength16 = uidna_nameToUnicode(cached, name16.getBuffer(), name16.length(), actual16, 256, &actualInfo16, &actualCode);
+					}
+					if (expectedCode != actualCode || expectedLength != actualLength || 0 != memcmp(expected, actual, expectedLength)
+							|| expectedInfo.errors != actualInfo.errors
+							|| expectedLength16 != actualLength16 || 0 != memcmp(expected16, actual16, expectedLength16 * 2)
+							|| expectedInfo16.errors != actualInfo16.errors) {
+						errln("memoized labels round %d \"%s\" toASCII=%d differ from uncached", (int) round, name.c_str(), toASCII);
+						++failures;
+					}
+				}
+			}
+		}
+	}
+	assertEquals("memoized label conversions that differ from uncached", 0, failures);
+
+	UIDNACacheStats stats;
+	uidna_getLabelCacheStats(cached, &stats, errorCode);
+	assertTrue("label memo hits", stats.hits > stats.misses);
+	assertTrue("label memo entries", stats.entries > 0);
+
+	uidna_setLabelCache(cached, 0, errorCode);
+	uidna_getLabelCacheStats(cached, &stats, errorCode);
+	assertEquals("no label memo entries", 0, (int64_t) stats.entries);
+	errorCode.errIfFailureAndReset("uidna_getLabelCacheStats()");
+	uidna_close(plain);
+	uidna_close(cached);
+#endif
+}
+
+#ifdef UIDNA_SOURCES
+// Counting allocator for TestAllocator(), compatible with malloc() so that it can be switched at any time.
+static std::atomic<int64_t> s_testAllocations { 0 };
+
+static void *testAlloc(const void * /*context*/, size_t size) {
+	++s_testAllocations;
+	return malloc(size);
+}
+
+static void *testRealloc(const void * /*context*/, void *mem, size_t size) {
+	++s_testAllocations;
+	return realloc(mem, size);
+}
+
+static void testFree(const void * /*context*/, void *mem) {
+	free(mem);
+}
+#endif
+
+void UTS46Test::TestAllocator() {
+#ifdef UIDNA_SOURCES
+	static const char *const inputs[] = {
+		"B\xc3\xbc" "cher.de", "xn--bcher-kva.xn--p1ai", "\xe4\xbe\x8b\xe5\xad\x90.\xe4\xb8\xad\xe5\x9b\xbd", "fa\xc3\x9f.de",
+		"\xd7\x90\xd7\x91.com", "www.example.com", "a..b", "xn--ab-", "\xe2\x80\x8d.com",
+		"\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.\xe2\x98\x83.net"
+	};
+	IcuTestErrorCode errorCode(*this, "TestAllocator()");
+	uidna_setAllocator(NULL, testAlloc, NULL, testFree, errorCode);
+	assertEquals("incomplete allocator", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+	uidna_setAllocator(NULL, testAlloc, testRealloc, testFree, errorCode);
+	UIDNA *plain = uidna_open(OptionsNonTrans, errorCode);
+	UIDNA *arena = uidna_open(OptionsNonTrans, errorCode);
+	UIDNA *small = uidna_open(OptionsNonTrans, errorCode);
+	uidna_setCallArena(arena, 16 * 1024, errorCode);
+	uidna_setCallArena(small, 16, errorCode);  // no allocation fits
+	if (errorCode.errIfFailureAndReset("uidna_setAllocator()/uidna_open()/uidna_setCallArena()")) {
+		uidna_setAllocator(NULL, NULL, NULL, NULL, errorCode);
+		uidna_close(plain);
+		uidna_close(arena);
+		uidna_close(small);
+		return;
+	}
+
+	// Converts all inputs in all directions and forms, returns false if the results differ from the plain handle.
+	auto convertAll = [&] (UIDNA *idna) {
+		UBool same = true;
+		for (const char *input : inputs) {
+			UnicodeString input16 = UnicodeString::fromUTF8(input);
+			for (UBool toASCII : { true, false }) {
+				char expected[256], actual[256];
+				UChar expected16[256], actual16[256];
+				UIDNAInfo expectedInfo = { false, 0 }, actualInfo = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				int32_t expectedLength, actualLength, expectedLength16, actualLength16;
+				if (toASCII) {
+					expectedLength = uidna_nameToASCII_UTF8(plain, input, -1, expected, 256, &expectedInfo, &code);
+					actualLength = uidna_nameToASCII_UTF8(idna, input, -1, actual, 256, &actualInfo, &code);
+					expectedLength16 = uidna_nameToASCII(plain, input16.getBuffer(), input16.length(), expected16, 256, NULL, &code);
+					actualLength16 = uidna_nameToASCII(idna, input16.getBuffer(), input16.length(), actual16, 256, NULL, &code);
+				} else {
+					expectedLength = uidna_nameToUnicodeUTF8(plain, input, -1, expected, 256, &expectedInfo, &code);
+					actualLength = uidna_nameToUnicodeUTF8(idna, input, -1, actual, 256, &actualInfo, &code);
+					expectedLength16 = uidna_nameToUnicode(plain, input16.getBuffer(), input16.length(), expected16, 256, NULL, &code);
+					actualLength16 = uidna_nameToUnicode(idna, input16.getBuffer(), input16.length(), actual16, 256, NULL, &code);
+				}
+				same = same && U_SUCCESS(code) && expectedLength == actualLength && 0 == memcmp(expected, actual, expectedLength)
+						&& expectedInfo.errors == actualInfo.errors
+						&& expectedLength16 == actualLength16 && 0 == memcmp(expected16, actual16, expectedLength16 * 2);
+			}
+		}
+		return same;
+	};
+	auto countAllocations = [&] (UIDNA *idna) {
+		int64_t count = 0;
+		for (const char *input : inputs) {
+			UnicodeString input16 = UnicodeString::fromUTF8(input);  // outside of the counted calls
+			char dest[256];
+			UChar dest16[256];
+			UErrorCode code = U_ZERO_ERROR;
+			int64_t start = s_testAllocations.load();
+			uidna_nameToASCII_UTF8(idna, input, -1, dest, 256, NULL, &code);
+			uidna_nameToUnicodeUTF8(idna, input, -1, dest, 256, NULL, &code);
+			uidna_nameToASCII(idna, input16.getBuffer(), input16.length(), dest16, 256, NULL, &code);
+			uidna_nameToUnicode(idna, input16.getBuffer(), input16.length(), dest16, 256, NULL, &code);
+			count += s_testAllocations.load() - start;
+		}
+		return count;
+	};
+
+	// The allocator is used, and the arena takes over all of the temporaries.
+	assertTrue("arena results", convertAll(arena));
+	assertTrue("small arena results", convertAll(small));
+	assertTrue("allocations without an arena", countAllocations(plain) > 0);
+	assertEquals("allocations with an arena", 0, countAllocations(arena));
+	assertTrue("allocations with a too small arena", countAllocations(small) > 0);
+
+	// Batches reset the arena after each name.
+	std::vector<UIDNAName> names;
+	for (int32_t i = 0; i < 500; ++i) {
+		names.push_back(UIDNAName{ inputs[i % UPRV_LENGTHOF(inputs)], -1 });
+	}
+	std::vector<char> expectedArena(64 * 1024), actualArena(64 * 1024);
+	std::vector<int32_t> expectedOffsets(names.size()), expectedLengths(names.size()), offsets(names.size()), lengths(names.size());
+	int32_t expectedTotal = uidna_nameToASCII_UTF8_batch(plain, names.data(), (int32_t) names.size(), expectedArena.data(), (int32_t) expectedArena.size(),
+			expectedOffsets.data(), expectedLengths.data(), NULL, errorCode);
+	int64_t start = s_testAllocations.load();
+	int32_t total = uidna_nameToASCII_UTF8_batch(arena, names.data(), (int32_t) names.size(), actualArena.data(), (int32_t) actualArena.size(),
+			offsets.data(), lengths.data(), NULL, errorCode);
+	assertEquals("batch allocations with an arena", 0, s_testAllocations.load() - start);
+	assertTrue("batch results with an arena", total == expectedTotal && offsets == expectedOffsets && lengths == expectedLengths
+			&& 0 == memcmp(expectedArena.data(), actualArena.data(), total));
+	total = uidna_nameToASCII_UTF8_batchParallel(arena, names.data(), (int32_t) names.size(), actualArena.data(), (int32_t) actualArena.size(),
+			offsets.data(), lengths.data(), NULL, 4, errorCode);
+	assertTrue("parallel batch results with an arena", total == expectedTotal && offsets == expectedOffsets && lengths == expectedLengths
+			&& 0 == memcmp(expectedArena.data(), actualArena.data(), total));
+
+	// Cache entries outlive the calls.
+	uidna_setCache(arena, 1 << 20, errorCode);
+	assertTrue("cached arena results", convertAll(arena));
+	assertTrue("cached arena results, second time", convertAll(arena));
+
+	// Handles and the tables of their caches come from the allocator as well.
+	start = s_testAllocations.load();
+	UIDNA *cached = uidna_open(OptionsNonTrans, errorCode);
+	uidna_setCache(cached, 1 << 20, errorCode);
+	uidna_setLabelCache(cached, 1 << 16, errorCode);
+	assertTrue("handle and cache allocations", s_testAllocations.load() - start > 3);
+	uidna_close(cached);
+
+	errorCode.errIfFailureAndReset("conversions with an arena");
+	uidna_setAllocator(NULL, NULL, NULL, NULL, errorCode);
+	uidna_close(plain);
+	uidna_close(arena);
+	uidna_close(small);
+#endif
+}
+
+void UTS46Test::TestContext() {
+#ifdef UIDNA_SOURCES
+	static const char *const inputs[] = {
+		"B\xc3\xbc" "cher.de", "xn--bcher-kva.xn--p1ai", "\xe4\xbe\x8b\xe5\xad\x90.\xe4\xb8\xad\xe5\x9b\xbd", "fa\xc3\x9f.de",
+		"\xd7\x90\xd7\x91.com", "www.example.com", "a..b", "xn--ab-", "\xe2\x80\x8d.com", "\xe2\x98\x83"
+	};
+	IcuTestErrorCode errorCode(*this, "TestContext()");
+	uidna_setAllocator(NULL, testAlloc, testRealloc, testFree, errorCode);
+	UIDNA *idna = uidna_open(OptionsNonTrans, errorCode);
+	UIDNAContext *context = uidna_openContext(0, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()/uidna_openContext()")) {
+		uidna_setAllocator(NULL, NULL, NULL, NULL, errorCode);
+		uidna_close(idna);
+		return;
+	}
+
+	// Converts all inputs with all functions, returns the number of allocations, counts differences from the context-free functions.
+	int32_t differences = 0;
+	auto convertAll = [&] () {
+		int64_t count = 0;
+		for (const char *input : inputs) {
+			UnicodeString input16 = UnicodeString::fromUTF8(input);
+			const UChar *s16 = input16.getBuffer();
+			char expected[256], actual[256];
+			UChar expected16[256], actual16[256];
+			UIDNAInfo expectedInfo = { false, 0 }, actualInfo = { false, 0 };
+			UErrorCode code = U_ZERO_ERROR;
+			for (int32_t function = 0; function < 8; ++function) {
+				int32_t expectedLength = 0, actualLength = 0;
+				int64_t start = 0;
+				switch (function) {
+				case 0:
+					expectedLength = uidna_nameToASCII_UTF8(idna, input, -1, expected, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = uidna_nameToASCII_UTF8_WithContext(idna, context, input, -1, actual, 256, &actualInfo, &code);
+					break;
+				case 1:
+					expectedLength = uidna_nameToUnicodeUTF8(idna, input, -1, expected, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = uidna_nameToUnicodeUTF8_WithContext(idna, context, input, -1, actual, 256, &actualInfo, &code);
+					break;
+				case 2:
+					expectedLength = uidna_labelToASCII_UTF8(idna, input, -1, expected, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = uidna_labelToASCII_UTF8_WithContext(idna, context, input, -1, actual, 256, &actualInfo, &code);
+					break;
+				case 3:
+					expectedLength = uidna_labelToUnicodeUTF8(idna, input, -1, expected, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = uidna_labelToUnicodeUTF8_WithContext(idna, context, input, -1, actual, 256, &actualInfo, &code);
+					break;
+				case 4:
+					expectedLength = 2 * uidna_nameToASCII(idna, s16, input16.length(), expected16, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = 2 * uidna_nameToASCII_WithContext(idna, context, s16, input16.length(), actual16, 256, &actualInfo, &code);
+					break;
+				case 5:
+					expectedLength = 2 * uidna_nameToUnicode(idna, s16, input16.length(), expected16, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = 2 * uidna_nameToUnicode_WithContext(idna, context, s16, input16.length(), actual16, 256, &actualInfo, &code);
+					break;
+				case 6:
+					expectedLength = 2 * uidna_labelToASCII(idna, s16, input16.length(), expected16, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = 2 * uidna_labelToASCII_WithContext(idna, context, s16, input16.length(), actual16, 256, &actualInfo, &code);
+					break;
+				case 7:
+					expectedLength = 2 * uidna_labelToUnicode(idna, s16, input16.length(), expected16, 256, &expectedInfo, &code);
+					start = s_testAllocations.load();
+					actualLength = 2 * uidna_labelToUnicode_WithContext(idna, context, s16, input16.length(), actual16, 256, &actualInfo, &code);
+					break;
+				}
+				count += s_testAllocations.load() - start;
+				const void *e = function < 4 ? (const void *) expected : (const void *) expected16;
+				const void *a = function < 4 ? (const void *) actual : (const void *) actual16;
+				if (U_FAILURE(code) || expectedLength != actualLength || 0 != memcmp(e, a, expectedLength) || expectedInfo.errors != actualInfo.errors) {
+					errln("function %d with a context differs for \"%s\"", (int) function, input);
+					++differences;
+				}
+			}
+		}
+		return count;
+	};
+
+	// The empty context grows during the first round, then no more heap allocations.
+	assertTrue("allocations while the context grows", convertAll() > 0);
+	assertEquals("allocations with a grown context", 0, convertAll());
+	assertEquals("context results that differ", 0, differences);
+
+	// Also with a handle that has a call arena.
+	uidna_setCallArena(idna, 64, errorCode);
+	assertEquals("allocations with a grown context and a call arena", 0, convertAll());
+
+	char dest[32];
+	uidna_nameToASCII_UTF8_WithContext(idna, NULL, "a", -1, dest, 32, NULL, errorCode);
+	assertEquals("no context", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+	uidna_openContext(-1, errorCode);
+	assertEquals("negative capacity", U_ILLEGAL_ARGUMENT_ERROR, errorCode.reset());
+
+	uidna_closeContext(context);
+	uidna_closeContext(NULL);
+	uidna_setAllocator(NULL, NULL, NULL, NULL, errorCode);
+	uidna_close(idna);
+#endif
+}
+
+void UTS46Test::TestPunycodeEncoder() {
+#ifdef UIDNA_SOURCES
+	IcuTestErrorCode errorCode(*this, "TestPunycodeEncoder()");
+
+	// RFC 3492 7.1 (L), with case flags.
+	static const UBool sampleFlags[] = { false, false, true, false, false, false, false, false };
+	UnicodeString sample(u"3年b組金八先生");
+	UChar dest[4096];
+	int32_t length = u_strToPunycode(sample.getBuffer(), sample.length(), dest, UPRV_LENGTHOF(dest), sampleFlags, errorCode);
+	assertEquals("RFC 3492 sample (L)", u"3B-ww4c5e180e575a65lsy2b", UnicodeString(dest, length));
+
+	// Labels across the short label limit and up to the input limit, with repeated code points of all lengths.
+	static const UChar32 alphabet[] = { u'a', u'Z', u'-', 0xe4, 0xdf, 0x3b1, 0x5d0, 0x4e2d, 0x6587, 0xff21, 0x1f600, 0x10ffff };
+	static const int32_t lengths[] = { 1, 2, 10, 59, 62, 63, 64, 65, 66, 100, 255, 256, 600, 999, 1000 };
+	uint32_t seed = 1;
+	for (int32_t length16 : lengths) {
+		for (int32_t round = 0; round < 8; ++round) {
+			UnicodeString s;
+			UBool flags[1000];
+			while (s.length() < length16) {
+				seed = seed * 1103515245 + 12345;
+				UChar32 c = alphabet[(seed >> 16) % (round < 4 ? UPRV_LENGTHOF(alphabet) : 4 + round)];
+				if (s.length() + U16_LENGTH(c) > length16) {
+					c = u'x';
+				}
+				// The encoder applies the case flags of basic letters to the output, as in the decoded string.
+				flags[s.length()] = ((seed >> 8) & 1) != 0;
+				if (c == u'a' || c == u'x' || c == u'Z') {
+					c = flags[s.length()] ? (c & ~0x20) : (c | 0x20);
+				}
+				s.append(c);
+			}
+
+			// Round trip, including the case flags of the basic and non-basic code points.
+			UErrorCode code = U_ZERO_ERROR;
+			int32_t encodedLength = u_strToPunycode(s.getBuffer(), s.length(), dest, UPRV_LENGTHOF(dest), flags, &code);
+			UChar decoded[1000];
+			UBool decodedFlags[1000];
+			int32_t decodedLength = u_strFromPunycode(dest, encodedLength, decoded, UPRV_LENGTHOF(decoded), decodedFlags, &code);
+			UChar again[4096];
+			int32_t againLength = u_strToPunycode(decoded, decodedLength, again, UPRV_LENGTHOF(again), decodedFlags, &code);
+			if (U_FAILURE(code) || UnicodeString(decoded, decodedLength) != s
+					|| UnicodeString(again, againLength) != UnicodeString(dest, encodedLength)) {
+				errln("Punycode round trip failed for length %d round %d: %s", (int) length16, (int) round, u_errorName(code));
+				continue;
+			}
+
+			// Without case flags, the UTF-8 encoder yields the same, also when preflighting.
+			encodedLength = u_strToPunycode(s.getBuffer(), s.length(), dest, UPRV_LENGTHOF(dest), nullptr, &code);
+			std::string s8;
+			s.toUTF8String(s8);
+			char dest8[4096];
+			int32_t encodedLength8 = u_strToPunycodeUTF8(s8.data(), int32_t(s8.length()), dest8, UPRV_LENGTHOF(dest8), &code);
+			UErrorCode preflightCode = U_ZERO_ERROR;
+			int32_t preflightLength = u_strToPunycodeUTF8(s8.data(), int32_t(s8.length()), nullptr, 0, &preflightCode);
+			if (U_FAILURE(code) || UnicodeString(dest, encodedLength) != UnicodeString::fromUTF8(StringPiece(dest8, encodedLength8))
+					|| preflightCode != U_BUFFER_OVERFLOW_ERROR || preflightLength != encodedLength8) {
+				errln("UTF-8 Punycode differs for length %d round %d: %s", (int) length16, (int) round, u_errorName(code));
+			}
+		}
+	}
+
+	// Input limits for NUL-terminated and UTF-8 input, and unpaired surrogates in long input.
+	UChar limit[1002];
+	for (int32_t i = 0; i < 1000; ++i) {
+		limit[i] = u'é';
+	}
+	limit[1000] = 0;
+	length = u_strToPunycode(limit, -1, dest, UPRV_LENGTHOF(dest), nullptr, errorCode);
+	assertTrue("1000 code units", length > 0);
+	limit[1000] = u'a';
+	limit[1001] = 0;
+	UErrorCode code = U_ZERO_ERROR;
+	u_strToPunycode(limit, -1, dest, UPRV_LENGTHOF(dest), nullptr, &code);
+	assertEquals("1001 code units", U_INPUT_TOO_LONG_ERROR, code);
+	std::string limit8;
+	UnicodeString(limit, 1001).toUTF8String(limit8);
+	char dest8[4096];
+	code = U_ZERO_ERROR;
+	u_strToPunycodeUTF8(limit8.data(), int32_t(limit8.length()), dest8, UPRV_LENGTHOF(dest8), &code);
+	assertEquals("1001 code units in UTF-8", U_INPUT_TOO_LONG_ERROR, code);
+	limit[500] = 0xd800;
+	code = U_ZERO_ERROR;
+	u_strToPunycode(limit, 600, dest, UPRV_LENGTHOF(dest), nullptr, &code);
+	assertEquals("unpaired surrogate", U_INVALID_CHAR_FOUND, code);
+#endif
+}
+
+void UTS46Test::TestPunycodeUTF8() {
+#ifdef UIDNA_SOURCES
+	static const struct {
+		const char *unicode, *punycode;
+	} cases[] = {
+		{ "b\xc3\xbc" "cher", "bcher-kva" },
+		{ "3\xe5\xb9\xb4" "B\xe7\xb5\x84\xe9\x87\x91\xe5\x85\xab\xe5\x85\x88\xe7\x94\x9f", "3B-ww4c5e180e575a65lsy2b" },  // RFC 3492 7.1 (L)
+		{ "\xf0\x9f\x98\x80", "e28h" },
+		{ "ascii", "ascii-" },
+		{ "", "" },
+	};
+	for (const auto &c : cases) {
+		IcuTestErrorCode errorCode(*this, c.unicode);
+		char dest[256];
+		int32_t length = u_strToPunycodeUTF8(c.unicode, -1, dest, UPRV_LENGTHOF(dest), errorCode);
+		assertEquals("u_strToPunycodeUTF8()", UnicodeString::fromUTF8(c.punycode), UnicodeString::fromUTF8(StringPiece(dest, length)));
+		length = u_strFromPunycodeUTF8(c.punycode, -1, dest, UPRV_LENGTHOF(dest), errorCode);
+		assertEquals("u_strFromPunycodeUTF8()", UnicodeString::fromUTF8(c.unicode), UnicodeString::fromUTF8(StringPiece(dest, length)));
+
+		// Same as the UTF-16 functions.
+		UnicodeString unicode16 = UnicodeString::fromUTF8(c.unicode);
+		UChar dest16[256];
+		length = u_strToPunycode(unicode16.getBuffer(), unicode16.length(), dest16, UPRV_LENGTHOF(dest16), nullptr, errorCode);
+		assertEquals("u_strToPunycode()", UnicodeString::fromUTF8(c.punycode), UnicodeString(dest16, length));
+	}
+
+	// The case of the delta digits is ignored when decoding.
+	IcuTestErrorCode errorCode(*this, "TestPunycodeUTF8()");
+	char dest[256];
+	int32_t length = u_strFromPunycodeUTF8("3B-WW4C5E180E575A65LSY2B", -1, dest, UPRV_LENGTHOF(dest), errorCode);
+	assertEquals("uppercase digits", UnicodeString::fromUTF8(cases[1].unicode), UnicodeString::fromUTF8(StringPiece(dest, length)));
+
+	// Preflighting and termination.
+	UErrorCode code = U_ZERO_ERROR;
+	length = u_strFromPunycodeUTF8("bcher-kva", -1, dest, 3, &code);
+	assertEquals("decode overflow", U_BUFFER_OVERFLOW_ERROR, code);
+	assertEquals("decode preflight length", 7, length);
+	code = U_ZERO_ERROR;
+	length = u_strFromPunycodeUTF8("bcher-kva", -1, dest, 7, &code);
+	assertEquals("decode unterminated", U_STRING_NOT_TERMINATED_WARNING, code);
+	code = U_ZERO_ERROR;
+	length = u_strToPunycodeUTF8("b\xc3\xbc" "cher", -1, nullptr, 0, &code);
+	assertEquals("encode overflow", U_BUFFER_OVERFLOW_ERROR, code);
+	assertEquals("encode preflight length", 9, length);
+
+	// Errors.
+	static const struct {
+		UBool encode;
+		const char *src;
+		UErrorCode expected;
+	} errors[] = {
+		{ true, "b\xc3" "cher", U_INVALID_CHAR_FOUND },
+		{ true, "\xed\xa0\x80", U_INVALID_CHAR_FOUND },  // surrogate
+		{ false, "b\xc3\xbc-kva", U_INVALID_CHAR_FOUND },
+		{ false, "bcher-k_a", U_INVALID_CHAR_FOUND },
+		{ false, "bcher-kv", U_ILLEGAL_CHAR_FOUND },
+		{ false, "zzzzzzzzzzzzzz", U_ILLEGAL_CHAR_FOUND },
+	};
+	for (const auto &e : errors) {
+		code = U_ZERO_ERROR;
+		if (e.encode) {
+			u_strToPunycodeUTF8(e.src, -1, dest, UPRV_LENGTHOF(dest), &code);
+		} else {
+			u_strFromPunycodeUTF8(e.src, -1, dest, UPRV_LENGTHOF(dest), &code);
+		}
+		assertEquals(e.src, e.expected, code);
+	}
+	std::string tooLong(2001, 'a');
+	code = U_ZERO_ERROR;
+	u_strToPunycodeUTF8(tooLong.data(), 1001, dest, UPRV_LENGTHOF(dest), &code);
+	assertEquals("encode too long", U_INPUT_TOO_LONG_ERROR, code);
+	code = U_ZERO_ERROR;
+	u_strFromPunycodeUTF8(tooLong.data(), 2001, dest, UPRV_LENGTHOF(dest), &code);
+	assertEquals("decode too long", U_INPUT_TOO_LONG_ERROR, code);
+#endif
+}
+
+void UTS46Test::TestCheckName() {
+#ifdef UIDNA_SOURCES
+	// Names around the length limits, where the Punycode of the labels is longer or shorter than their UTF-8.
+	static const char *const labels[] = {
+		"www", "example", "xn--bcher-kva", "B\xc3\xbc" "cher", "\xe4\xbe\x8b\xe5\xad\x90",
+		"\xce\xb1\xce\xb2\xce\xb3\xce\xb4\xce\xb5\xce\xb6\xce\xb7\xce\xb8",
+		"\xf0\x9f\x98\x80\xf0\x9f\x98\x81\xf0\x9f\x98\x82", "a-", "\xd7\x90\xd7\x91", "\xe2\x98\x83x",
+		"abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghij", ""
+	};
+	IcuTestErrorCode errorCode(*this, "TestCheckName()");
+	UIDNA *idna = uidna_open(OptionsNonTrans, errorCode);
+	UIDNA *cached = uidna_open(OptionsNonTrans, errorCode);
+	uidna_setCache(cached, 1 << 20, errorCode);
+	uidna_setLabelCache(cached, 1 << 20, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()")) {
+		uidna_close(idna);
+		uidna_close(cached);
+		return;
+	}
+	uint32_t seed = 1;
+	for (int32_t i = 0; i < 3000; ++i) {
+		std::string name;
+		int32_t targetLength = 200 + i % 120;
+		while ((int32_t) name.length() < targetLength) {
+			seed = seed * 1103515245 + 12345;
+			if (!name.empty()) {
+				name += '.';
+			}
+			name += labels[(seed >> 16) % (UPRV_LENGTHOF(labels) - (i % 7 == 0 ? 0 : 1))];
+		}
+		if (i % 5 == 0) {
+			name += '.';
+		}
+		UnicodeString name16 = UnicodeString::fromUTF8(name);
+		UIDNA *instance = i % 2 == 0 ? idna : cached;  // twice each for cache hits
+		for (int32_t round = 0; round < 2; ++round) {
+			UErrorCode code = U_ZERO_ERROR;
+			char dest[1024];
+			UIDNAInfo expected = { false, 0 }, info = { false, 0 }, info16 = { false, 0 };
+			uidna_nameToASCII_UTF8(instance, name.data(), (int32_t) name.length(), dest, UPRV_LENGTHOF(dest), &expected, &code);
+			UBool valid = uidna_checkNameUTF8(instance, name.data(), (int32_t) name.length(), &info, &code);
+			UBool valid16 = uidna_checkName(instance, name16.getBuffer(), name16.length(), &info16, &code);
+			UBool isValid = uidna_isValidNameUTF8(instance, name.data(), (int32_t) name.length(), &code);
+			UBool isValid16 = uidna_isValidName(instance, name16.getBuffer(), name16.length(), &code);
+			UBool expectedValid = expected.errors == 0;
+			if (U_FAILURE(code) || info.errors != expected.errors || info16.errors != expected.errors
+					|| info.isTransitionalDifferent != expected.isTransitionalDifferent
+					|| valid != expectedValid || valid16 != expectedValid || isValid != expectedValid || isValid16 != expectedValid) {
+				errln("checkName() differs from nameToASCII(): %04lx/%04lx vs. %04lx for \"%s\": %s",
+						(long) info.errors, (long) info16.errors, (long) expected.errors, name.c_str(), u_errorName(code));
+			}
+		}
+	}
+
+	// Arguments.
+	UIDNAInfo info = { false, 0 };
+	assertTrue("empty name", !uidna_checkNameUTF8(idna, "", 0, &info, errorCode) && info.errors == UIDNA_ERROR_EMPTY_LABEL);
+	assertTrue("NUL-terminated", uidna_isValidNameUTF8(idna, "b\xc3\xbc" "cher.de", -1, errorCode));
+	assertTrue("no info", uidna_checkName(idna, u"example.com", -1, NULL, errorCode));
+	UErrorCode code = U_ZERO_ERROR;
+	assertFalse("NULL name", uidna_isValidNameUTF8(idna, NULL, 3, &code));
+	assertEquals("NULL name", U_ILLEGAL_ARGUMENT_ERROR, code);
+	uidna_close(idna);
+	uidna_close(cached);
+#endif
+}
+
+void UTS46Test::TestNameToASCIIView() {
+#ifdef UIDNA_SOURCES
+	static const struct {
+		const char *name;
+		UBool unchanged;
+	} cases[] = {
+		{ "www.example.com", true },
+		{ "www.example.com.", true },
+		{ "a-b.c9", true },
+		{ "www.Example.com", false },  // lowercased
+		{ "b\xc3\xbc" "cher.de", false },  // Punycode
+		{ "xn--bcher-kva.de", false },  // Punycode is decoded and checked
+		{ "-abc.de", false },  // errors
+		{ "abc..de", false },
+		{ "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijkl.com", false },  // 64
+		{ "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyzabcdefghijk.com", true },  // 63
+		{ "", false },
+	};
+	IcuTestErrorCode errorCode(*this, "TestNameToASCIIView()");
+	UIDNA *idna = uidna_open(OptionsNonTrans, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()")) {
+		return;
+	}
+	std::vector<std::string> names;
+	for (const auto &c : cases) {
+		names.push_back(c.name);
+	}
+	// Around the domain name length limit.
+	std::string longName;
+	while (longName.length() < 250) {
+		longName += "abcdefghi.";
+	}
+	for (int32_t i = 0; i < 8; ++i) {
+		names.push_back(longName.substr(0, 250 + i));
+		names.push_back(longName.substr(0, 250 + i - 1) + ".");
+	}
+	// Random names from units that hit each of the checks.
+	static const char *const units[] = { "a", "z", "0", "9", "-", ".", "A", "_", "\x7f", "\xc3\xa4", "xn--", "--", "abcdefghijklmnopqrstuvwxyzabcdefghij" };
+	uint32_t seed = 1;
+	for (int32_t i = 0; i < 3000; ++i) {
+		std::string name;
+		int32_t count = 1 + i % 24;
+		for (int32_t j = 0; j < count; ++j) {
+			seed = seed * 1103515245 + 12345;
+			uint32_t k = (seed >> 16) % 64;
+			name += units[k < UPRV_LENGTHOF(units) ? k : k % 3 == 0 ? 5 : k % 2];  // mostly letters and dots
+		}
+		names.push_back(name);
+	}
+	// The instance above has STD3 rules, which already exclude everything but lowercase LDH ASCII.
+	UIDNA *lenient = uidna_open(OptionsNonTrans & ~UIDNA_USE_STD3_RULES, errorCode);
+	for (const std::string &name : names) {
+		UIDNAInfo expectedInfo = { false, 0 }, info = { false, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		char expected[1024];
+		int32_t expectedLength = uidna_nameToASCII_UTF8(lenient, name.data(), (int32_t) name.length(), expected, UPRV_LENGTHOF(expected), &expectedInfo, &code);
+		const char *result = NULL;
+		UBool unchanged = false;
+		uidna_nameToASCII_UTF8_view(lenient, name.data(), (int32_t) name.length(), NULL, 0, &result, &unchanged, &info, &code);
+		// Labels with "--" in the third and fourth position are always copied, valid A-labels too.
+		UBool identical = expectedInfo.errors == 0 && name == std::string(expected, expectedLength);
+		if (unchanged ? !identical : identical && name.find("--") == std::string::npos) {
+			errln("uidna_nameToASCII_UTF8_view(\"%s\") without STD3 rules unchanged=%d", name.c_str(), unchanged);
+		}
+	}
+	uidna_close(lenient);
+	for (const std::string &name : names) {
+		char expected[1024], dest[1024];
+		UIDNAInfo expectedInfo = { false, 0 }, info = { false, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		int32_t expectedLength = uidna_nameToASCII_UTF8(idna, name.data(), (int32_t) name.length(), expected, UPRV_LENGTHOF(expected), &expectedInfo, &code);
+		const char *result = NULL;
+		UBool unchanged = false;
+		int32_t length = uidna_nameToASCII_UTF8_view(idna, name.data(), (int32_t) name.length(), dest, UPRV_LENGTHOF(dest), &result, &unchanged, &info, &code);
+		UBool identical = expectedInfo.errors == 0 && name == std::string(expected, expectedLength);
+		if (U_FAILURE(code) || length != expectedLength || memcmp(result, expected, length) != 0 || info.errors != expectedInfo.errors
+				|| unchanged != (result == name.data()) || (unchanged ? !identical : identical && name.find("--") == std::string::npos)) {
+			errln("uidna_nameToASCII_UTF8_view(\"%s\") differs from uidna_nameToASCII_UTF8(): %s", name.c_str(), u_errorName(code));
+		}
+	}
+	for (const auto &c : cases) {
+		const char *result = NULL;
+		UBool unchanged = !c.unchanged;
+		UErrorCode code = U_ZERO_ERROR;
+		// Without a buffer, only unchanged names succeed.
+		int32_t length = uidna_nameToASCII_UTF8_view(idna, c.name, -1, NULL, 0, &result, &unchanged, NULL, &code);
+		if (unchanged != c.unchanged || (unchanged ? result != c.name || length != (int32_t) strlen(c.name) || U_FAILURE(code)
+				: result != NULL || (length > 0 && code != U_BUFFER_OVERFLOW_ERROR))) {
+			errln("uidna_nameToASCII_UTF8_view(\"%s\") unchanged=%d, expected %d: %s", c.name, unchanged, c.unchanged, u_errorName(code));
+		}
+	}
+	UErrorCode code = U_ZERO_ERROR;
+	char dest[16];
+	uidna_nameToASCII_UTF8_view(idna, "example", -1, dest, UPRV_LENGTHOF(dest), NULL, NULL, NULL, &code);
+	assertEquals("NULL pResult", U_ILLEGAL_ARGUMENT_ERROR, code);
+	uidna_close(idna);
+#endif
+}
+
+void UTS46Test::TestEngines() {
+	// The option sets with a specialized engine, see UTS46::getEngine(), and some without.
+	static const uint32_t optionSets[] = {
+		UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO,
+		OptionsCommon,
+		OptionsNonTrans & ~UIDNA_USE_STD3_RULES,
+		OptionsNonTrans,
+		OptionsNonTrans & ~UIDNA_CHECK_CONTEXTO,
+		OptionsNonTrans & ~(UIDNA_CHECK_CONTEXTO | UIDNA_USE_STD3_RULES),
+		OptionsNonTrans & ~UIDNA_NONTRANSITIONAL_TO_UNICODE,
+		UIDNA_DEFAULT,
+		UIDNA_USE_STD3_RULES,
+	};
+	static const char *const units[] = { "a", "-", ".", "A", "_", "xn--", "\xc3\x9f", "\xe2\x80\x8c", "\xe2\x80\x8d", "\xc2\xb7", "l",
+		"\xd7\x90", "\xd9\xa0", "\xdb\xb0", "1", "\xcc\x88", "\xe2\x92\x88", "\xef\xbc\x8e" };
+	std::vector<std::string> names;
+	for (int32_t i = 0; i < UPRV_LENGTHOF(testCases); ++i) {
+		std::string name;
+		ctou(testCases[i].s).toUTF8String(name);
+		names.push_back(name);
+	}
+	uint32_t seed = 1;
+	for (int32_t i = 0; i < 2000; ++i) {
+		std::string name;
+		int32_t count = 1 + i % 16;
+		for (int32_t j = 0; j < count; ++j) {
+			seed = seed * 1103515245 + 12345;
+			name += units[(seed >> 16) % UPRV_LENGTHOF(units)];
+		}
+		names.push_back(name);
+	}
+	IcuTestErrorCode errorCode(*this, "TestEngines()");
+	for (uint32_t options : optionSets) {
+		// Bit 1 is not a UTS #46 option, it only makes uidna_open() fall back to the generic engine.
+		UIDNA *specialized = uidna_open(options, errorCode);
+		UIDNA *generic = uidna_open(options | 1, errorCode);
+		if (errorCode.errIfFailureAndReset("uidna_open(%04lx)", (long) options)) {
+			uidna_close(specialized);
+			uidna_close(generic);
+			return;
+		}
+		for (const std::string &name : names) {
+			UnicodeString name16 = UnicodeString::fromUTF8(name);
+			for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+				char expected[1024], actual[1024];
+				UChar expected16[512], actual16[512];
+				UIDNAInfo expectedInfo = { false, 0 }, actualInfo = { false, 0 };
+				UIDNAInfo expectedInfo16 = { false, 0 }, actualInfo16 = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				int32_t expectedLength, actualLength, expectedLength16, actualLength16;
+				if (toASCII) {
+					expectedLength = uidna_nameToASCII_UTF8(generic, name.data(), (int32_t) name.length(), expected, UPRV_LENGTHOF(expected), &expectedInfo, &code);
+					actualLength = uidna_nameToASCII_UTF8(specialized, name.data(), (int32_t) name.length(), actual, UPRV_LENGTHOF(actual), &actualInfo, &code);
+					expectedLength16 = uidna_nameToASCII(generic, name16.getBuffer(), name16.length(), expected16, UPRV_LENGTHOF(expected16), &expectedInfo16, &code);
+					actualLength16 = uidna_nameToASCII(specialized, name16.getBuffer(), name16.length(), actual16, UPRV_LENGTHOF(actual16), &actualInfo16, &code);
+				} else {
+					expectedLength = uidna_nameToUnicodeUTF8(generic, name.data(), (int32_t) name.length(), expected, UPRV_LENGTHOF(expected), &expectedInfo, &code);
+					actualLength = uidna_nameToUnicodeUTF8(specialized, name.data(), (int32_t) name.length(), actual, UPRV_LENGTHOF(actual), &actualInfo, &code);
+					expectedLength16 = uidna_nameToUnicode(generic, name16.getBuffer(), name16.length(), expected16, UPRV_LENGTHOF(expected16), &expectedInfo16, &code);
+					actualLength16 = uidna_nameToUnicode(specialized, name16.getBuffer(), name16.length(), actual16, UPRV_LENGTHOF(actual16), &actualInfo16, &code);
+				}
+				if (U_FAILURE(code) || actualLength != expectedLength || memcmp(actual, expected, actualLength) != 0
+						|| actualInfo.errors != expectedInfo.errors || actualInfo.isTransitionalDifferent != expectedInfo.isTransitionalDifferent
+						|| actualLength16 != expectedLength16 || memcmp(actual16, expected16, actualLength16 * 2) != 0
+						|| actualInfo16.errors != expectedInfo16.errors) {
+					errln("options %04lx toASCII=%d: specialized engine differs from the generic one for \"%s\": %s",
+							(long) options, (int) toASCII, name.c_str(), u_errorName(code));
+				}
+			}
+		}
+		uidna_close(specialized);
+		uidna_close(generic);
+	}
+}
+
+void UTS46Test::TestIDNAProps() {
+#ifdef UIDNA_SOURCES
+	// The generated table must agree with the separate lookups it replaces.
+	const ComposeNormalizer2 *norm2 = ComposeNormalizer2::getInstance();
+	int32_t errors = 0;
+	for (UChar32 c = 0; c <= 0x10ffff && errors < 10; ++c) {
+		uint16_t props = getIDNAProps(c);
+		UErrorCode errorCode = U_ZERO_ERROR;
+		UScriptCode script = uscript_getScript(c, &errorCode);
+		IDNAScriptClass scriptClass = script == USCRIPT_GREEK ? IDNAScriptClass::Greek
+				: script == USCRIPT_HEBREW ? IDNAScriptClass::Hebrew
+				: script == USCRIPT_HIRAGANA || script == USCRIPT_KATAKANA || script == USCRIPT_HAN ? IDNAScriptClass::HiraganaKatakanaHan
+				: IDNAScriptClass::Other;
+		if (getIDNAPropsBiDi(props) != u_charDirection(c) || getIDNAPropsJoiningType(props) != ubidi_getJoiningType(c)
+				|| ((props & IDNAPropsMark) != 0) != ((U_GET_GC_MASK(c) & U_GC_M_MASK) != 0)
+				|| ((props & IDNAPropsVirama) != 0) != (norm2->getCombiningClass(c) == 9)
+				|| getIDNAPropsScript(props) != scriptClass) {
+			errln("getIDNAProps(U+%04lX)=%04x differs from the property lookups", (long) c, props);
+			++errors;
+		}
+		// The status must match what the uts46 normalizer does with the code point.
+		UnicodeString s, normalized;
+		s.append(c);
+		norm2->normalize(s, normalized, errorCode);
+		UTS46Status status = U_IS_SURROGATE(c) || c == 0xfffd || normalized.indexOf((UChar) 0xfffd) >= 0 ? UTS46Status::Disallowed
+				: normalized.isEmpty() ? UTS46Status::Ignored
+				: normalized != s ? UTS46Status::Mapped
+				: UTS46Status::Valid;
+		if (U_FAILURE(errorCode) || getIDNAPropsStatus(props) != status) {
+			errln("getIDNAProps(U+%04lX)=%04x status %d, expected %d", (long) c, props, (int) getIDNAPropsStatus(props), (int) status);
+			++errors;
+		}
+	}
+	assertEquals("getIDNAProps(U+226E) disallowed_STD3_valid", IDNAPropsDisallowedSTD3Valid, getIDNAProps(0x226e) & IDNAPropsDisallowedSTD3Valid);
+	assertEquals("getIDNAProps(U+200D) deviation", IDNAPropsDeviation, getIDNAProps(0x200d) & IDNAPropsDeviation);
+	assertEquals("getIDNAProps(U+00E4) no status", 0, getIDNAProps(0xe4) & (IDNAPropsDisallowedSTD3Valid | IDNAPropsDeviation));
+	assertTrue("getIDNAProps(U+0061) valid", getIDNAPropsStatus(getIDNAProps(0x61)) == UTS46Status::Valid);
+	assertTrue("getIDNAProps(U+FF45) mapped", getIDNAPropsStatus(getIDNAProps(0xff45)) == UTS46Status::Mapped);
+	assertTrue("getIDNAProps(U+00AD) ignored", getIDNAPropsStatus(getIDNAProps(0xad)) == UTS46Status::Ignored);
+	assertTrue("getIDNAProps(U+2028) disallowed", getIDNAPropsStatus(getIDNAProps(0x2028)) == UTS46Status::Disallowed);
+	assertTrue("getIDNAProps(U+0378) disallowed", getIDNAPropsStatus(getIDNAProps(0x378)) == UTS46Status::Disallowed);
+	assertEquals("getIDNAProps(-1)", 0, getIDNAProps(-1));
+	assertEquals("getIDNAProps(0x110000)", 0, getIDNAProps(0x110000));
+#endif
+}
+
+void UTS46Test::TestInertRuns() {
+#ifdef UIDNA_SOURCES
+	const ComposeNormalizer2 *norm2 = ComposeNormalizer2::getInstance();
+	IcuTestErrorCode errorCode(*this, "TestInertRuns()");
+	for (UChar32 c = 0; c <= 0xffff; ++c) {
+		UnicodeString s((UChar) c), normalized;
+		norm2->normalize(s, normalized, errorCode);
+		UBool inert = !U_IS_SURROGATE(c) && normalized == s && norm2->impl.hasCompBoundaryBefore(c);
+		if (isUTS46Inert(c) != inert) {
+			errln("isUTS46Inert(U+%04lX)=%d differs from the normalizer", (long) c, isUTS46Inert(c));
+			break;
+		}
+	}
+	// Inert characters next to ones that combine with them or are mapped:
+	// processing a name must give the same result as processing its normalized form.
+	static const UChar *const units[] = {
+		u"e", u"E", u"\u0301", u"\u0308", u"\u0435", u"\u0415", u"\u4e00", u"\u00e9", u"\u1100", u"\u1161",
+		u"\uac00", u"\u11a8", u"\u0915", u"\u094d", u"\u00df", u"\u200d", u"\u2488", u".", u"\U0001f600"
+	};
+	UIDNA *idna = uidna_open(OptionsNonTrans & ~UIDNA_USE_STD3_RULES, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()")) {
+		return;
+	}
+	uint32_t seed = 1;
+	for (int32_t i = 0; i < 3000; ++i) {
+		UnicodeString name;
+		int32_t count = 1 + i % 12;
+		for (int32_t j = 0; j < count; ++j) {
+			seed = seed * 1103515245 + 12345;
+			name.append(units[(seed >> 16) % UPRV_LENGTHOF(units)]);
+		}
+		UnicodeString normalized = norm2->normalize(name, errorCode);
+		std::string name8, normalized8;
+		name.toUTF8String(name8);
+		normalized.toUTF8String(normalized8);
+		UChar dest16[256], expected16[256];
+		char dest8[512], expected8[512];
+		UIDNAInfo info = { false, 0 }, expectedInfo = { false, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		int32_t length16 = uidna_nameToUnicode(idna, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &info, &code);
+		int32_t expectedLength16 = uidna_nameToUnicode(idna, normalized.getBuffer(), normalized.length(), expected16, UPRV_LENGTHOF(expected16), &expectedInfo, &code);
+		int32_t length8 = uidna_nameToUnicodeUTF8(idna, name8.data(), (int32_t) name8.length(), dest8, UPRV_LENGTHOF(dest8), &info, &code);
+		int32_t expectedLength8 = uidna_nameToUnicodeUTF8(idna, normalized8.data(), (int32_t) normalized8.length(), expected8, UPRV_LENGTHOF(expected8), &expectedInfo, &code);
+		if (U_FAILURE(code) || length16 != expectedLength16 || memcmp(dest16, expected16, length16 * 2) != 0
+				|| length8 != expectedLength8 || memcmp(dest8, expected8, length8) != 0) {
+			errln("nameToUnicode(name %d) differs from nameToUnicode(normalized name): %s", (int) i, u_errorName(code));
+		}
+	}
+	uidna_close(idna);
+#endif
+}
+
+void UTS46Test::TestContextualChecks() {
+	// The contextual rules look before and after characters, and the BiDi rule
+	// looks at all labels of a name, including the ASCII ones of the fastpath.
+	static const struct {
+		UBool std3;
+		const UChar *name;
+		uint32_t errors;
+	} cases[] = {
+		{ true, u"a\u094d\u200cb", 0 },  // ZWNJ after a virama
+		{ true, u"\u0628\u200c\u0628", 0 },
+		{ true, u"\u0628\u064b\u200c\u064b\u0628", 0 },  // transparent characters around ZWNJ
+		{ true, u"\u0628\u200c\u064b", UIDNA_ERROR_CONTEXTJ | UIDNA_ERROR_BIDI },  // ZWNJ without postcontext
+		{ true, u"\u0628\u200c", UIDNA_ERROR_CONTEXTJ | UIDNA_ERROR_BIDI },
+		{ true, u"\u0628\u200c\u200c\u0628", UIDNA_ERROR_CONTEXTJ },
+		{ true, u"\u0627\u200c\u0628", UIDNA_ERROR_CONTEXTJ },  // no precontext
+		{ true, u"\u200cb", UIDNA_ERROR_CONTEXTJ },
+		{ true, u"a\u200db", UIDNA_ERROR_CONTEXTJ },  // ZWJ without virama
+		{ true, u"\u0915\u094d\u200d\u0937", 0 },
+		{ true, u"l\u00b7l", 0 },
+		{ true, u"l\u00b7", UIDNA_ERROR_CONTEXTO_PUNCTUATION },
+		{ true, u"l\u00b7\u00b7l", UIDNA_ERROR_CONTEXTO_PUNCTUATION },
+		{ true, u"\u0375\u03b1", 0 },
+		{ true, u"\u03b1\u0375", UIDNA_ERROR_CONTEXTO_PUNCTUATION },
+		{ true, u"\u0375\U0001d6c2", 0 },
+		{ true, u"\u05d0\u05f3", 0 },
+		{ true, u"a\u05f4", UIDNA_ERROR_CONTEXTO_PUNCTUATION | UIDNA_ERROR_BIDI },
+		{ true, u"\u30fb\u30a2", 0 },
+		{ true, u"\u30fb\U00020000", 0 },
+		{ true, u"a\u30fb", UIDNA_ERROR_CONTEXTO_PUNCTUATION },
+		{ true, u"\u0660\u0661", UIDNA_ERROR_BIDI },
+		{ true, u"\u0660\u06f0", UIDNA_ERROR_CONTEXTO_DIGITS | UIDNA_ERROR_BIDI },
+		{ true, u"\u06f0\u0628\u0660", UIDNA_ERROR_CONTEXTO_DIGITS | UIDNA_ERROR_BIDI },
+		{ true, u"ab.\u05d0", 0 },
+		{ true, u"Ab.c1.\u05d0", 0 },
+		{ true, u"1a.\u05d0", UIDNA_ERROR_BIDI },
+		{ true, u"ab.c-.\u05d0", UIDNA_ERROR_TRAILING_HYPHEN | UIDNA_ERROR_BIDI },
+		{ true, u"\u05d0.a1.\u05d1", 0 },
+		{ true, u"\u05d0.1a.\u05d1", UIDNA_ERROR_BIDI },
+		{ true, u"1a.\u00e9", 0 },  // not a BiDi domain name
+		{ false, u"a b.\u05d0", UIDNA_ERROR_BIDI },
+		{ false, u"a\tb.\u05d0", UIDNA_ERROR_BIDI },
+		{ false, u"a_b.\u05d0", 0 },
+		{ false, u"_a.\u05d0", UIDNA_ERROR_BIDI },
+		{ false, u"\u05d0.a b", UIDNA_ERROR_BIDI },
+	};
+	IcuTestErrorCode errorCode(*this, "TestContextualChecks()");
+	UIDNA *idna[2] = { uidna_open(OptionsNonTrans & ~UIDNA_USE_STD3_RULES, errorCode), uidna_open(OptionsNonTrans, errorCode) };
+	if (errorCode.errIfFailureAndReset("uidna_open()")) {
+		uidna_close(idna[0]);
+		uidna_close(idna[1]);
+		return;
+	}
+	for (int32_t i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+		UIDNA *uts46 = idna[cases[i].std3 ? 1 : 0];
+		UnicodeString name(cases[i].name);
+		std::string name8;
+		name.toUTF8String(name8);
+		UChar dest16[64];
+		char dest8[128];
+		UIDNAInfo info16 = { false, 0 }, info8 = { false, 0 }, infoASCII = { false, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		uidna_nameToUnicode(uts46, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &info16, &code);
+		uidna_nameToUnicodeUTF8(uts46, name8.data(), (int32_t) name8.length(), dest8, UPRV_LENGTHOF(dest8), &info8, &code);
+		uidna_nameToASCII(uts46, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &infoASCII, &code);
+		if (U_FAILURE(code) || info16.errors != cases[i].errors || info8.errors != cases[i].errors || infoASCII.errors != cases[i].errors) {
+			errln("case %d: nameToUnicode errors %04lx, UTF-8 %04lx, nameToASCII %04lx, expected %04lx (%s)", (int) i,
+					(long) info16.errors, (long) info8.errors, (long) infoASCII.errors, (long) cases[i].errors, u_errorName(code));
+		}
+	}
+	uidna_close(idna[0]);
+	uidna_close(idna[1]);
+}
+
+void UTS46Test::TestLabelsAppended() {
+	// Labels that change their length (Punycode, U+FFFD, deviation characters, marked ACE labels)
+	// anywhere in a name: the name result must be the label results joined with dots.
+	static const UChar *const labels[] = {
+		u"abc", u"fa\u00df", u"\u03c2\u03b1\u03c2", u"a\u200db", u"xn--bad-", u"xn--ab", u"\u00e4bc", u"a\u0308bc",
+		u"a_b", u"\U0001f600", u"\u0915\u094d\u200d\u0937", u"\u00c4BC"
+	};
+	IcuTestErrorCode errorCode(*this, "TestLabelsAppended()");
+	static const uint32_t options[] = {
+		UIDNA_USE_STD3_RULES | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO,
+		UIDNA_USE_STD3_RULES | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO | UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE
+	};
+	for (int32_t k = 0; k < UPRV_LENGTHOF(options); ++k) {
+		UIDNA *idna = uidna_open(options[k], errorCode);
+		if (errorCode.errIfFailureAndReset("uidna_open()")) {
+			return;
+		}
+		uint32_t seed = 1;
+		for (int32_t i = 0; i < 1000; ++i) {
+			UnicodeString name, expected[2];
+			uint32_t expectedErrors[2] = { 0, 0 };
+			int32_t count = 1 + i % 6;
+			for (int32_t j = 0; j < count; ++j) {
+				seed = seed * 1103515245 + 12345;
+				const UChar *label = labels[(seed >> 16) % UPRV_LENGTHOF(labels)];
+				if (j > 0) {
+					name.append((UChar) 0x2e);
+					expected[0].append((UChar) 0x2e);
+					expected[1].append((UChar) 0x2e);
+				}
+				name.append(label);
+				for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+					UChar dest[128];
+					UIDNAInfo info = { false, 0 };
+					UErrorCode code = U_ZERO_ERROR;
+					int32_t length = (toASCII ? uidna_labelToASCII : uidna_labelToUnicode)(idna, label, -1, dest, UPRV_LENGTHOF(dest), &info, &code);
+					expected[toASCII].append(dest, length);
+					expectedErrors[toASCII] |= info.errors;
+				}
+			}
+			for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+				UChar dest16[256];
+				char dest8[512];
+				UIDNAInfo info16 = { false, 0 }, info8 = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				int32_t length16 = (toASCII ? uidna_nameToASCII : uidna_nameToUnicode)(idna, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &info16, &code);
+				std::string name8, expected8;
+				name.toUTF8String(name8);
+				expected[toASCII].toUTF8String(expected8);
+				int32_t length8 = (toASCII ? uidna_nameToASCII_UTF8 : uidna_nameToUnicodeUTF8)(idna, name8.data(), (int32_t) name8.length(), dest8, UPRV_LENGTHOF(dest8), &info8, &code);
+				if (U_FAILURE(code) || expected[toASCII] != UnicodeString(dest16, length16) || info16.errors != expectedErrors[toASCII]) {
+					errln("options %lx name %d %s: UTF-16 result differs from the label results: %s", (long) options[k], (int) i,
+							toASCII ? "toASCII" : "toUnicode", u_errorName(code));
+				}
+				if (U_FAILURE(code) || expected8 != std::string(dest8, length8) || info8.errors != expectedErrors[toASCII]) {
+					errln("options %lx name %d %s: UTF-8 result differs from the label results: %s", (long) options[k], (int) i,
+							toASCII ? "toASCII" : "toUnicode", u_errorName(code));
+				}
+			}
+		}
+		uidna_close(idna);
+	}
+}
+
+void UTS46Test::TestTrustedNFCInput() {
+	// UIDNA_TRUSTED_NFC_INPUT must not change the results for input that is mapped and in NFC
+	// (ASCII case is mapped by the ASCII fastpath either way).
+	static const UChar *const names[] = {
+		u"example.com", u"bl\u00e5b\u00e6rgr\u00f8d.no", u"Example.COM", u"fa\u00df.de", u"\u03c2\u03b1\u03c2.gr",
+		u"caf\u00e9", u"\u0915\u094d\u200d\u0937.in", u"\u05d0\u05d1.\u05d2", u"xn--bcher-kva.de",
+		u"\u0308abc.de", u"abc.\u0308de", u"\uac01.kr", u"a..b", u"", u"\u00e4BC.de", u"\U00010428x.com"
+	};
+	// Input with code points that UTS #46 maps, ignores or disallows breaks the promise;
+	// the per-code-point status check must still reject it.
+	static const UChar *const unmapped[] = {
+		u"caf\u00e9\u2028x.com", u"\u2488x.com", u"\u00e9\u0378.com", u"\uff45xample.com",
+		u"\u00e9\u00adx.com", u"\u00e9\U0001D400.com", u"\u00e9\U000E0001.com"
+	};
+	IcuTestErrorCode errorCode(*this, "TestTrustedNFCInput()");
+	static const uint32_t options[] = {
+		UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO,
+		UIDNA_USE_STD3_RULES | UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE
+	};
+	for (int32_t k = 0; k < UPRV_LENGTHOF(options); ++k) {
+		UIDNA *idna = uidna_open(options[k], errorCode);
+		UIDNA *trusted = uidna_open(options[k] | UIDNA_TRUSTED_NFC_INPUT, errorCode);
+		if (errorCode.errIfFailureAndReset("uidna_open()")) {
+			uidna_close(idna);
+			return;
+		}
+		for (int32_t i = 0; i < UPRV_LENGTHOF(names); ++i) {
+			UnicodeString name(names[i]);
+			std::string name8;
+			name.toUTF8String(name8);
+			for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+				UChar expected16[128], dest16[128];
+				char expected8[256], dest8[256];
+				UIDNAInfo expectedInfo16 = { false, 0 }, info16 = { false, 0 }, expectedInfo8 = { false, 0 }, info8 = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				auto toName16 = toASCII ? uidna_nameToASCII : uidna_nameToUnicode;
+				auto toName8 = toASCII ? uidna_nameToASCII_UTF8 : uidna_nameToUnicodeUTF8;
+				int32_t expectedLength16 = toName16(idna, name.getBuffer(), name.length(), expected16, UPRV_LENGTHOF(expected16), &expectedInfo16, &code);
+				int32_t length16 = toName16(trusted, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &info16, &code);
+				int32_t expectedLength8 = toName8(idna, name8.data(), (int32_t) name8.length(), expected8, UPRV_LENGTHOF(expected8), &expectedInfo8, &code);
+				int32_t length8 = toName8(trusted, name8.data(), (int32_t) name8.length(), dest8, UPRV_LENGTHOF(dest8), &info8, &code);
+				if (U_FAILURE(code) || UnicodeString(expected16, expectedLength16) != UnicodeString(dest16, length16) ||
+						expectedInfo16.errors != info16.errors || expectedInfo16.isTransitionalDifferent != info16.isTransitionalDifferent) {
+					errln("options %lx name %d %s: UTF-16 result differs with UIDNA_TRUSTED_NFC_INPUT: %s", (long) options[k], (int) i,
+							toASCII ? "toASCII" : "toUnicode", u_errorName(code));
+				}
+				if (U_FAILURE(code) || std::string(expected8, expectedLength8) != std::string(dest8, length8) ||
+						expectedInfo8.errors != info8.errors || expectedInfo8.isTransitionalDifferent != info8.isTransitionalDifferent) {
+					errln("options %lx name %d %s: UTF-8 result differs with UIDNA_TRUSTED_NFC_INPUT: %s", (long) options[k], (int) i,
+							toASCII ? "toASCII" : "toUnicode", u_errorName(code));
+				}
+			}
+		}
+#ifndef UIDNA_VERIFY_TRUSTED_NFC
+		for (int32_t i = 0; i < UPRV_LENGTHOF(unmapped); ++i) {
+			UnicodeString name(unmapped[i]);
+			std::string name8;
+			name.toUTF8String(name8);
+			for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+				UChar dest16[128];
+				char dest8[256];
+				UIDNAInfo info16 = { false, 0 }, info8 = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				auto toName16 = toASCII ? uidna_nameToASCII : uidna_nameToUnicode;
+				auto toName8 = toASCII ? uidna_nameToASCII_UTF8 : uidna_nameToUnicodeUTF8;
+				toName16(trusted, name.getBuffer(), name.length(), dest16, UPRV_LENGTHOF(dest16), &info16, &code);
+				toName8(trusted, name8.data(), (int32_t) name8.length(), dest8, UPRV_LENGTHOF(dest8), &info8, &code);
+				if (U_FAILURE(code) || (info16.errors & UIDNA_ERROR_DISALLOWED) == 0 || (info8.errors & UIDNA_ERROR_DISALLOWED) == 0) {
+					errln("options %lx unmapped name %d %s: errors %lx (UTF-16) %lx (UTF-8) with UIDNA_TRUSTED_NFC_INPUT, expected DISALLOWED: %s",
+							(long) options[k], (int) i, toASCII ? "toASCII" : "toUnicode", (long) info16.errors, (long) info8.errors, u_errorName(code));
+				}
+			}
+		}
+		// Input that is not in NFC is not normalized.
+		static const UChar decomposed[] = u"bla\u030ab\u00e6rgr\u00f8d.no";
+		UChar dest16[64];
+		UIDNAInfo info = { false, 0 };
+		int32_t length = uidna_nameToUnicode(trusted, decomposed, -1, dest16, UPRV_LENGTHOF(dest16), &info, errorCode);
+		assertEquals("decomposed input is used as is", UnicodeString(decomposed), UnicodeString(dest16, length));
+		length = uidna_nameToUnicode(idna, decomposed, -1, dest16, UPRV_LENGTHOF(dest16), &info, errorCode);
+		assertEquals("decomposed input is normalized without the option", UnicodeString(u"bl\u00e5b\u00e6rgr\u00f8d.no"), UnicodeString(dest16, length));
+		errorCode.errIfFailureAndReset("decomposed input");
+#endif
+		uidna_close(idna);
+		uidna_close(trusted);
+	}
+}
+
+void UTS46Test::TestDualConversion() {
+	// uidna_nameToASCIIDual() must return the same as uidna_nameToASCII() with and without
+	// UIDNA_NONTRANSITIONAL_TO_ASCII, with deviation characters in any of the labels.
+	static const UChar *const labels[] = {
+		u"abc", u"fa\u00df", u"\u03c2\u03b1\u03c2", u"a\u200db", u"\u0915\u094d\u200d\u0937", u"xn--bad-", u"\u00e4bc",
+		u"A\u0308BC", u"a_b", u"\u05d0\u05d1", u"1\u05d0", u"\u0644\u200c\u0645", u"xn--fa-hia", u"STRASSE", u"",
+		u"\u200c", u"\u200d\u200c"
+	};
+	// Labels without deviation characters, for long names whose results do not fork.
+	static const UChar *const longLabels[] = {
+		u"abc", u"\u00e4bc", u"a_b", u"1\u05d0", u"xn--bad-", u"example"
+	};
+	IcuTestErrorCode errorCode(*this, "TestDualConversion()");
+	static const uint32_t options[] = {
+		UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO,
+		UIDNA_USE_STD3_RULES | UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII,
+		UIDNA_USE_STD3_RULES
+	};
+	for (int32_t k = 0; k < UPRV_LENGTHOF(options); ++k) {
+		UIDNA *idna = uidna_open(options[k], errorCode);
+		UIDNA *trans = uidna_open(options[k] & ~UIDNA_NONTRANSITIONAL_TO_ASCII, errorCode);
+		UIDNA *nontrans = uidna_open(options[k] | UIDNA_NONTRANSITIONAL_TO_ASCII, errorCode);
+		if (errorCode.errIfFailureAndReset("uidna_open()")) {
+			uidna_close(idna);
+			uidna_close(trans);
+			return;
+		}
+		uint32_t seed = 1;
+		for (int32_t i = 0; i < 1200; ++i) {
+			UnicodeString name;
+			// Names from 1000 on are long (about 200 to 400 UTF-16 units) for the length errors,
+			// and only every fourth one has a label with deviation characters, at its end.
+			UBool isLong = i >= 1000;
+			int32_t count = isLong ? 40 + i % 30 : 1 + i % 5;
+			for (int32_t j = 0; j < count; ++j) {
+				seed = seed * 1103515245 + 12345;
+				if (j > 0) {
+					name.append((UChar) 0x2e);
+				}
+				if (isLong && (j < count - 1 || i % 4 != 0)) {
+					name.append(longLabels[(seed >> 16) % UPRV_LENGTHOF(longLabels)]);
+				} else {
+					name.append(labels[(seed >> 16) % UPRV_LENGTHOF(labels)]);
+				}
+			}
+			std::string name8;
+			name.toUTF8String(name8);
+			UChar expected16[2][1024], dest16[2][1024];
+			char expected8[2][2048], dest8[2][2048];
+			int32_t expectedLength16[2], expectedLength8[2];
+			UIDNAInfo expectedInfo16[2], expectedInfo8[2];
+			UErrorCode code = U_ZERO_ERROR;
+			for (int32_t t = 0; t < 2; ++t) {
+				UIDNA *expectedIdna = t == 0 ? nontrans : trans;
+				expectedInfo16[t] = expectedInfo8[t] = { false, 0 };
+				expectedLength16[t] = uidna_nameToASCII(expectedIdna, name.getBuffer(), name.length(), expected16[t], 1024, &expectedInfo16[t], &code);
+				expectedLength8[t] = uidna_nameToASCII_UTF8(expectedIdna, name8.data(), (int32_t) name8.length(), expected8[t], 2048, &expectedInfo8[t], &code);
+			}
+			UIDNAInfo info16 = { false, 0 }, transInfo16 = { false, 0 }, info8 = { false, 0 }, transInfo8 = { false, 0 };
+			int32_t transLength16, transLength8;
+			int32_t length16 = uidna_nameToASCIIDual(idna, name.getBuffer(), name.length(), dest16[0], 1024, &info16,
+					dest16[1], 1024, &transLength16, &transInfo16, &code);
+			int32_t length8 = uidna_nameToASCIIDual_UTF8(idna, name8.data(), (int32_t) name8.length(), dest8[0], 2048, &info8,
+					dest8[1], 2048, &transLength8, &transInfo8, &code);
+			if (U_FAILURE(code)) {
+				errln("name %d: %s", (int) i, u_errorName(code));
+				continue;
+			}
+			if (info16.isTransitionalDifferent != expectedInfo16[0].isTransitionalDifferent ||
+					(transLength16 < 0) != !info16.isTransitionalDifferent || (transLength8 < 0) != !info8.isTransitionalDifferent) {
+				errln("options %lx name %d: isTransitionalDifferent %d, transitional lengths %d %d", (long) options[k], (int) i,
+						info16.isTransitionalDifferent, (int) transLength16, (int) transLength8);
+				continue;
+			}
+			if (transLength16 < 0) {
+				transLength16 = length16;
+				u_memcpy(dest16[1], dest16[0], length16);
+				transLength8 = length8;
+				memcpy(dest8[1], dest8[0], length8);
+			}
+			if (UnicodeString(expected16[0], expectedLength16[0]) != UnicodeString(dest16[0], length16) ||
+					expectedInfo16[0].errors != info16.errors) {
+				errln("options %lx name %d: UTF-16 nontransitional result differs", (long) options[k], (int) i);
+			}
+			if (UnicodeString(expected16[1], expectedLength16[1]) != UnicodeString(dest16[1], transLength16) ||
+					expectedInfo16[1].errors != transInfo16.errors) {
+				errln("options %lx name %d: UTF-16 transitional result differs", (long) options[k], (int) i);
+			}
+			if (std::string(expected8[0], expectedLength8[0]) != std::string(dest8[0], length8) ||
+					expectedInfo8[0].errors != info8.errors) {
+				errln("options %lx name %d: UTF-8 nontransitional result differs", (long) options[k], (int) i);
+			}
+			if (std::string(expected8[1], expectedLength8[1]) != std::string(dest8[1], transLength8) ||
+					expectedInfo8[1].errors != transInfo8.errors) {
+				errln("options %lx name %d: UTF-8 transitional result differs", (long) options[k], (int) i);
+			}
+		}
+		// Preflighting: both lengths with U_BUFFER_OVERFLOW_ERROR.
+		UIDNAInfo info = { false, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		int32_t transLength;
+		int32_t length = uidna_nameToASCIIDual_UTF8(idna, "fa\xc3\x9f.de", -1, NULL, 0, &info, NULL, 0, &transLength, NULL, &code);
+		if (code != U_BUFFER_OVERFLOW_ERROR || length != 13 || transLength != 7) {
+			errln("options %lx: preflighting fa\u00df.de: %s, lengths %d %d", (long) options[k], u_errorName(code), (int) length, (int) transLength);
+		}
+		uidna_close(idna);
+		uidna_close(trans);
+		uidna_close(nontrans);
+	}
+}
+
+void UTS46Test::TestASCIIAndUnicode() {
+	// uidna_nameToASCIIAndUnicodeUTF8() must return the same as uidna_nameToASCII_UTF8() and uidna_nameToUnicodeUTF8(),
+	// also with different NONTRANSITIONAL options for the two directions, with labels that are too long only for ToASCII
+	// and with labels of only ZWJ/ZWNJ, which are empty in a transitional direction.
+	static const char *const labels[] = {
+		"abc", "fa\u00df", "\u03c2\u03b1\u03c2", "a\u200db", "xn--bad-", "\u00e4bc", "A\u0308BC", "a_b", "\u05d0\u05d1",
+		"1\u05d0", "\u0644\u200c\u0645", "xn--fa-hia", "xn--bc-ZZZ", "STRASSE", "-ab", "ab--c", "\u0308a", "",
+		"\u200c", "\u200c\u200c\u200c", "\u200d",
+		"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+		"\u00e4aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa",
+		"xn--aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa-\u00e4",
+		"xn--aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa_"
+	};
+	IcuTestErrorCode errorCode(*this, "TestASCIIAndUnicode()");
+	static const uint32_t options[] = {
+		UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_CHECK_CONTEXTO,
+		UIDNA_USE_STD3_RULES | UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII,
+		UIDNA_USE_STD3_RULES | UIDNA_NONTRANSITIONAL_TO_UNICODE,
+		UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_UNICODE,
+		UIDNA_CHECK_BIDI | UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE
+	};
+	for (int32_t k = 0; k < UPRV_LENGTHOF(options); ++k) {
+		UIDNA *idna = uidna_open(options[k], errorCode);
+		if (errorCode.errIfFailureAndReset("uidna_open()")) {
+			return;
+		}
+		uint32_t seed = 1;
+		for (int32_t i = 0; i < 1000; ++i) {
+			std::string name;
+			int32_t count = 1 + i % 5;
+			for (int32_t j = 0; j < count; ++j) {
+				seed = seed * 1103515245 + 12345;
+				if (j > 0) {
+					name.push_back('.');
+				}
+				name.append(labels[(seed >> 16) % UPRV_LENGTHOF(labels)]);
+			}
+			char expectedASCII[1024], expectedUnicode[1024], ascii[1024], unicode[1024];
+			UIDNAInfo expectedASCIIInfo = { false, 0 }, expectedUnicodeInfo = { false, 0 };
+			UErrorCode code = U_ZERO_ERROR;
+			int32_t expectedASCIILength = uidna_nameToASCII_UTF8(idna, name.data(), (int32_t) name.length(),
+					expectedASCII, 1024, &expectedASCIIInfo, &code);
+			int32_t expectedUnicodeLength = uidna_nameToUnicodeUTF8(idna, name.data(), (int32_t) name.length(),
+					expectedUnicode, 1024, &expectedUnicodeInfo, &code);
+			UIDNAASCIIAndUnicodeInfo info = { false, 0, 0, 0 };
+			int32_t unicodeLength;
+			int32_t asciiLength = uidna_nameToASCIIAndUnicodeUTF8(idna, name.data(), (int32_t) name.length(),
+					ascii, 1024, unicode, 1024, &unicodeLength, &info, &code);
+			if (U_FAILURE(code)) {
+				errln("options %lx name %d: %s", (long) options[k], (int) i, u_errorName(code));
+				continue;
+			}
+			if (std::string(expectedASCII, expectedASCIILength) != std::string(ascii, asciiLength) ||
+					expectedASCIIInfo.errors != (info.errors | info.asciiErrors) ||
+					expectedASCIIInfo.isTransitionalDifferent != info.isTransitionalDifferent) {
+				errln("options %lx name %d: ASCII result differs, errors %lx vs. %lx", (long) options[k], (int) i,
+						(long) expectedASCIIInfo.errors, (long) (info.errors | info.asciiErrors));
+			}
+			if (std::string(expectedUnicode, expectedUnicodeLength) != std::string(unicode, unicodeLength) ||
+					expectedUnicodeInfo.errors != (info.errors | info.unicodeErrors)) {
+				errln("options %lx name %d: Unicode result differs, errors %lx vs. %lx", (long) options[k], (int) i,
+						(long) expectedUnicodeInfo.errors, (long) (info.errors | info.unicodeErrors));
+			}
+			if ((info.errors & (info.asciiErrors | info.unicodeErrors)) != 0 || (info.asciiErrors & info.unicodeErrors) != 0) {
+				errln("options %lx name %d: error sets overlap", (long) options[k], (int) i);
+			}
+		}
+		// Preflighting: both lengths with U_BUFFER_OVERFLOW_ERROR.
+		UIDNAASCIIAndUnicodeInfo info = { false, 0, 0, 0 };
+		UErrorCode code = U_ZERO_ERROR;
+		int32_t unicodeLength;
+		int32_t asciiLength = uidna_nameToASCIIAndUnicodeUTF8(idna, "xn--mnchen-3ya.de", -1, NULL, 0, NULL, 0, &unicodeLength, &info, &code);
+		if (code != U_BUFFER_OVERFLOW_ERROR || asciiLength != 17 || unicodeLength != 11) {
+			errln("options %lx: preflighting xn--mnchen-3ya.de: %s, lengths %d %d", (long) options[k], u_errorName(code),
+					(int) asciiLength, (int) unicodeLength);
+		}
+		uidna_close(idna);
+	}
+}
+
+void UTS46Test::TestFailFast() {
+	// With UIDNA_FAIL_FAST, a result with one of the fail-fast errors is empty and has a subset of the errors,
+	// other results are the same as without it.
+	static const char *const labels[] = {
+		"abc", "fa\u00df", "a\u200db", "xn--bad-", "xn--a", "\u00e4bc", "A\u0308BC", "a_b", "\u05d0\u05d1", "1\u05d0",
+		"xn--fa-hia", "xn--bc-ZZZ", "-ab", "ab-", "ab--c", "\u0308a", "", "a\ufffdb", "xn--zca.b",
+		"aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+	};
+	static const uint32_t masks[] = {
+		0xffffffff, UIDNA_ERROR_DISALLOWED | UIDNA_ERROR_PUNYCODE | UIDNA_ERROR_INVALID_ACE_LABEL, UIDNA_ERROR_BIDI
+	};
+	IcuTestErrorCode errorCode(*this, "TestFailFast()");
+	static const uint32_t options = UIDNA_USE_STD3_RULES | UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII;
+	UIDNA *idna = uidna_open(options, errorCode);
+	UIDNA *failFast = uidna_open(options | UIDNA_FAIL_FAST, errorCode);
+	if (errorCode.errIfFailureAndReset("uidna_open()")) {
+		uidna_close(idna);
+		return;
+	}
+	for (int32_t k = 0; k < UPRV_LENGTHOF(masks); ++k) {
+		uidna_setFailFastErrors(failFast, masks[k], errorCode);
+		uint32_t seed = 1;
+		for (int32_t i = 0; i < 1000; ++i) {
+			std::string name8;
+			int32_t count = 1 + i % 4;
+			for (int32_t j = 0; j < count; ++j) {
+				seed = seed * 1103515245 + 12345;
+				if (j > 0) {
+					name8.push_back('.');
+				}
+				name8.append(labels[(seed >> 16) % UPRV_LENGTHOF(labels)]);
+			}
+			UnicodeString name = UnicodeString::fromUTF8(name8);
+			for (int32_t toASCII = 0; toASCII < 2; ++toASCII) {
+				UChar expected16[512], dest16[512];
+				char expected8[1024], dest8[1024];
+				UIDNAInfo expectedInfo16 = { false, 0 }, expectedInfo8 = { false, 0 }, info16 = { false, 0 }, info8 = { false, 0 };
+				UErrorCode code = U_ZERO_ERROR;
+				int32_t expectedLength16, expectedLength8, length16, length8;
+				if (toASCII) {
+					expectedLength16 = uidna_nameToASCII(idna, name.getBuffer(), name.length(), expected16, 512, &expectedInfo16, &code);
+					expectedLength8 = uidna_nameToASCII_UTF8(idna, name8.data(), (int32_t) name8.length(), expected8, 1024, &expectedInfo8, &code);
+					length16 = uidna_nameToASCII(failFast, name.getBuffer(), name.length(), dest16, 512, &info16, &code);
+					length8 = uidna_nameToASCII_UTF8(failFast, name8.data(), (int32_t) name8.length(), dest8, 1024, &info8, &code);
+				} else {
+					expectedLength16 = uidna_nameToUnicode(idna, name.getBuffer(), name.length(), expected16, 512, &expectedInfo16, &code);
+					expectedLength8 = uidna_nameToUnicodeUTF8(idna, name8.data(), (int32_t) name8.length(), expected8, 1024, &expectedInfo8, &code);
+					length16 = uidna_nameToUnicode(failFast, name.getBuffer(), name.length(), dest16, 512, &info16, &code);
+					length8 = uidna_nameToUnicodeUTF8(failFast, name8.data(), (int32_t) name8.length(), dest8, 1024, &info8, &code);
+				}
+				if (U_FAILURE(code)) {
+					errln("mask %lx name %d: %s", (long) masks[k], (int) i, u_errorName(code));
+					continue;
+				}
+				if ((expectedInfo16.errors & masks[k]) == 0) {
+					if (UnicodeString(expected16, expectedLength16) != UnicodeString(dest16, length16) || expectedInfo16.errors != info16.errors) {
+						errln("mask %lx name %d toASCII=%d: UTF-16 result without fail-fast errors differs", (long) masks[k], (int) i, (int) toASCII);
+					}
+				} else if (length16 != 0 || (info16.errors & masks[k]) == 0 || (info16.errors & ~expectedInfo16.errors) != 0) {
+					errln("mask %lx name %d toASCII=%d: UTF-16 fail-fast length %d errors %lx, expected 0 and a subset of %lx",
+							(long) masks[k], (int) i, (int) toASCII, (int) length16, (long) info16.errors, (long) expectedInfo16.errors);
+				}
+				if ((expectedInfo8.errors & masks[k]) == 0) {
+					if (std::string(expected8, expectedLength8) != std::string(dest8, length8) || expectedInfo8.errors != info8.errors) {
+						errln("mask %lx name %d toASCII=%d: UTF-8 result without fail-fast errors differs", (long) masks[k], (int) i, (int) toASCII);
+					}
+				} else if (length8 != 0 || (info8.errors & masks[k]) == 0 || (info8.errors & ~expectedInfo8.errors) != 0) {
+					errln("mask %lx name %d toASCII=%d: UTF-8 fail-fast length %d errors %lx, expected 0 and a subset of %lx",
+							(long) masks[k], (int) i, (int) toASCII, (int) length8, (long) info8.errors, (long) expectedInfo8.errors);
+				}
+			}
+		}
+	}
+
+	// In a batch, rejected names take no arena space.
+	uidna_setFailFastErrors(failFast, 0xffffffff, errorCode);
+	const UIDNAName pair[] = { { "-abc.def", -1 }, { "ok.com", -1 } };
+	char pairArena[6];
+	int32_t pairOffsets[2], pairLengths[2];
+	int32_t total = uidna_nameToASCII_UTF8_batch(failFast, pair, 2, pairArena, UPRV_LENGTHOF(pairArena), pairOffsets, pairLengths, NULL, errorCode);
+	errorCode.errIfFailureAndReset("uidna_nameToASCII_UTF8_batch()");
+	if (total != 6 || pairOffsets[0] != 0 || pairLengths[0] != 0 || pairOffsets[1] != 0 || pairLengths[1] != 6
+			|| 0 != memcmp(pairArena, "ok.com", 6)) {
+		errln("fail-fast batch: total %d, offsets %d %d, lengths %d %d, expected 6, 0 0, 0 6",
+				(int) total, (int) pairOffsets[0], (int) pairOffsets[1], (int) pairLengths[0], (int) pairLengths[1]);
+	}
+
+	// The parallel batch returns the same as the serial one.
+	std::vector<std::string> names8;
+	std::vector<UIDNAName> names;
+	uint32_t seed = 1;
+	for (int32_t i = 0; i < 1000; ++i) {
+		std::string name8;
+		int32_t count = 1 + i % 4;
+		for (int32_t j = 0; j < count; ++j) {
+			seed = seed * 1103515245 + 12345;
+			if (j > 0) {
+				name8.push_back('.');
+			}
+			name8.append(labels[(seed >> 16) % UPRV_LENGTHOF(labels)]);
+		}
+		names8.push_back(name8);
+	}
+	for (const std::string &name8 : names8) {
+		names.push_back(UIDNAName{ name8.data(), (int32_t) name8.length() });
+	}
+	int32_t count = (int32_t) names.size();
+	std::vector<char> expectedArena(64 * 1024), arena(64 * 1024);
+	std::vector<int32_t> expectedOffsets(count), expectedLengths(count), offsets(count), lengths(count);
+	std::vector<UIDNAInfo> expectedInfos(count), infos(count);
+	for (UBool toASCII : { true, false }) {
+		auto batch = toASCII ? uidna_nameToASCII_UTF8_batch : uidna_nameToUnicodeUTF8_batch;
+		auto batchParallel = toASCII ? uidna_nameToASCII_UTF8_batchParallel : uidna_nameToUnicodeUTF8_batchParallel;
+		int32_t expectedTotal = batch(failFast, names.data(), count, expectedArena.data(), (int32_t) expectedArena.size(),
+				expectedOffsets.data(), expectedLengths.data(), expectedInfos.data(), errorCode);
+		total = batchParallel(failFast, names.data(), count, arena.data(), (int32_t) arena.size(),
+				offsets.data(), lengths.data(), infos.data(), 4, errorCode);
+		if (errorCode.errIfFailureAndReset("fail-fast batches")) {
+			break;
+		}
+		UBool sameInfos = true;
+		for (int32_t i = 0; i < count; ++i) {
+			sameInfos = sameInfos && expectedInfos[i].errors == infos[i].errors;
+		}
+		if (total != expectedTotal || offsets != expectedOffsets || lengths != expectedLengths || !sameInfos
+				|| 0 != memcmp(expectedArena.data(), arena.data(), total)) {
+			errln("toASCII=%d: fail-fast parallel batch differs from the serial one, totals %d %d",
+					(int) toASCII, (int) expectedTotal, (int) total);
+		}
+	}
+	uidna_close(idna);
+	uidna_close(failFast);
+}
+
 void UTS46Test::IdnaTest() {
 	IcuTestErrorCode errorCode(*this, "IdnaTest");
 
@@ -62,6 +62,28 @@ public:
 	void TestACELabelEdgeCases();
 	void TestTooLong();
 	void TestSomeCases();
+	void TestUTF8IllFormed();
+	void TestBatch();
+	void TestBatchParallel();
+	void TestASCIIKernels();
+	void TestLongUTF8();
+	void TestCache();
+	void TestLabelCache();
+	void TestAllocator();
+	void TestContext();
+	void TestPunycodeEncoder();
+	void TestPunycodeUTF8();
+	void TestCheckName();
+	void TestNameToASCIIView();
+	void TestEngines();
+	void TestIDNAProps();
+	void TestInertRuns();
+	void TestContextualChecks();
+	void TestLabelsAppended();
+	void TestTrustedNFCInput();
+	void TestDualConversion();
+	void TestASCIIAndUnicode();
+	void TestFailFast();
 	void IdnaTest();
 
 	UBool runTestLoop(char *testname, char *par, char *baseName);
@@ -1341,6 +1341,53 @@ test_IdnaTest (char *linep)
   return 0;
 }
 
+static void
+test_buffer_api (void)
+{
+  uint8_t *out;
+  uint8_t buf[IDN2_DOMAIN_MAX_LENGTH + 1];
+  size_t i, len;
+  int rc, rc_buf;
+
+  for (i = 0; i < sizeof (idna) / sizeof (idna[0]); i++)
+    {
+      rc = idn2_lookup_u8 ((uint8_t *) idna[i].in, &out, idna[i].flags);
+      rc_buf =
+	idn2_lookup_u8_buf ((uint8_t *) idna[i].in, strlen (idna[i].in), buf,
+			    sizeof (buf), &len, idna[i].flags);
+
+      if (rc != rc_buf)
+	{
+	  failed++;
+	  printf ("buffer API: expected rc %d got rc %d for %s\n", rc,
+		  rc_buf, idna[i].in);
+	}
+      else if (rc == IDN2_OK
+	       && (strcmp ((char *) out, (char *) buf) != 0
+		   || len != strlen ((char *) out)))
+	{
+	  failed++;
+	  printf ("buffer API: expected: %s\ngot: %s\n", out, buf);
+	}
+      else
+	ok++;
+
+      if (rc == IDN2_OK)
+	idn2_free (out);
+    }
+
+  /* A buffer without space for the terminating NUL must be rejected. */
+  rc = idn2_lookup_u8_buf ((const uint8_t *) "example.com", 11, buf, 11, &len,
+			   0);
+  if (rc == IDN2_OK)
+    {
+      failed++;
+      printf ("buffer API: short buffer was accepted\n");
+    }
+  else
+    ok++;
+}
+
 static void
 separator (void)
 {
@@ -1401,6 +1448,10 @@ main (int argc, const char *argv[])
 
   separator ();
 
+  test_buffer_api ();
+
+  separator ();
+
   // test all IDNA cases from Unicode 9.0.0
   if (_scan_file
       (argc == 1 ? "data/IdnaTest.txt" : argv[1], test_IdnaTest))
@@ -0,0 +1,192 @@
+// genidnaprops: generates src/u_idnaprops.cc, the combined property table of src/u_idnaprops.h
+//
+// Usage: genidnaprops [output]
+//
+// Builds the 16-bit properties of each code point from the separate lookups of the library
+// (u_charType(), u_charDirection(), ubidi_getJoiningType(), uscript_getScript() and the uts46 normalizer,
+// which also gives the UTS #46 status),
+// deduplicates the data and index blocks, and writes the arrays as C++ source, to stdout by default.
+// Also writes the bitmap of BMP code points that the uts46 normalizer passes through unchanged.
+// The lookups here do not use the table, so the library it links with can have any u_idnaprops.cc.
+
+#include "u_macro.h"
+#include "u_char.h"
+#include "u_norm2.h"
+#include "u_unistr.h"
+#include "u_idnaprops.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <map>
+#include <vector>
+
+using namespace uidna;
+
+// The status follows from what the uts46 normalizer does with the code point on its own:
+// disallowed code points map to U+FFFD, ignored ones to nothing, mapped ones to something else.
+static UTS46Status getStatus(UChar32 c) {
+	if (U_IS_SURROGATE(c) || c == 0xfffd) {
+		return UTS46Status::Disallowed;
+	}
+	UChar units[2] = { (UChar) c, 0 };
+	int32_t length = 1;
+	if (c > 0xffff) {
+		units[0] = U16_LEAD(c);
+		units[1] = U16_TRAIL(c);
+		length = 2;
+	}
+	UnicodeString s(units, length), normalized;
+	UErrorCode errorCode = U_ZERO_ERROR;
+	ComposeNormalizer2::getInstance()->normalize(s, normalized, errorCode);
+	if (U_FAILURE(errorCode)) {
+		return UTS46Status::Disallowed;
+	}
+	for (int32_t i = 0; i < normalized.length(); ++i) {
+		if (normalized.charAt(i) == 0xfffd) {
+			return UTS46Status::Disallowed;
+		}
+	}
+	if (normalized.isEmpty()) {
+		return UTS46Status::Ignored;
+	} else if (normalized.length() != length || normalized.charAt(0) != units[0] || normalized.charAt(length - 1) != units[length - 1]) {
+		return UTS46Status::Mapped;
+	} else {
+		return UTS46Status::Valid;
+	}
+}
+
+static uint16_t getProps(UChar32 c) {
+	uint16_t props = (uint16_t) u_charDirection(c);
+	props |= (uint16_t) (ubidi_getJoiningType(c) << IDNAPropsJoiningTypeShift);
+	if ((U_GET_GC_MASK(c) & U_GC_M_MASK) != 0) {
+		props |= IDNAPropsMark;
+	}
+	if (ComposeNormalizer2::getInstance()->getCombiningClass(c) == 9) {
+		props |= IDNAPropsVirama;
+	}
+	UErrorCode errorCode = U_ZERO_ERROR;
+	IDNAScriptClass script = IDNAScriptClass::Other;
+	switch (uscript_getScript(c, &errorCode)) {
+	case USCRIPT_GREEK:
+		script = IDNAScriptClass::Greek;
+		break;
+	case USCRIPT_HEBREW:
+		script = IDNAScriptClass::Hebrew;
+		break;
+	case USCRIPT_HIRAGANA:
+	case USCRIPT_KATAKANA:
+	case USCRIPT_HAN:
+		script = IDNAScriptClass::HiraganaKatakanaHan;
+		break;
+	default:
+		break;
+	}
+	props |= (uint16_t) ((uint16_t) script << IDNAPropsScriptShift);
+	// IdnaMappingTable.txt: disallowed_STD3_valid outside of ASCII, and deviation
+	if (c == 0x2260 || c == 0x226e || c == 0x226f) {
+		props |= IDNAPropsDisallowedSTD3Valid;
+	}
+	if (c == 0xdf || c == 0x3c2 || c == 0x200c || c == 0x200d) {
+		props |= IDNAPropsDeviation;
+	}
+	props |= (uint16_t) ((uint16_t) getStatus(c) << IDNAPropsStatusShift);
+	return props;
+}
+
+static bool isInert(UChar32 c) {
+	if (U_IS_SURROGATE(c)) {
+		return false;
+	}
+	const ComposeNormalizer2 *norm2 = ComposeNormalizer2::getInstance();
+	UChar unit = (UChar) c;
+	UnicodeString s(&unit, 1), normalized;
+	UErrorCode errorCode = U_ZERO_ERROR;
+	norm2->normalize(s, normalized, errorCode);
+	return U_SUCCESS(errorCode) && normalized.length() == 1 && normalized.charAt(0) == unit && norm2->impl.hasCompBoundaryBefore(c);
+}
+
+// Appends the block to the array unless it is already there, returns its start.
+static uint16_t addBlock(std::vector<uint16_t> &array, std::map<std::vector<uint16_t>, uint16_t> &blocks,
+		const std::vector<uint16_t> &block) {
+	auto it = blocks.find(block);
+	if (it != blocks.end()) {
+		return it->second;
+	}
+	if (array.size() + block.size() > 0x10000) {
+		fprintf(stderr, "genidnaprops: more than 64k values, use larger blocks\n");
+		exit(1);
+	}
+	uint16_t start = (uint16_t) array.size();
+	array.insert(array.end(), block.begin(), block.end());
+	blocks.emplace(block, start);
+	return start;
+}
+
+template <typename T>
+static void writeArray(FILE *out, const char *declaration, const std::vector<T> &array) {
+	fprintf(out, "const %s %s = {", sizeof(T) == 2 ? "uint16_t" : "uint32_t", declaration);
+	int32_t perLine = sizeof(T) == 2 ? 16 : 8;
+	for (size_t i = 0; i < array.size(); ++i) {
+		fprintf(out, "%s0x%x,", i % perLine == 0 ? "\n\t" : " ", (unsigned) array[i]);
+	}
+	fprintf(out, "\n};\n\n");
+}
+
+int main(int argc, char *argv[]) {
+	FILE *out = argc > 1 ? fopen(argv[1], "w") : stdout;
+	if (out == NULL) {
+		perror(argv[1]);
+		return 1;
+	}
+	std::vector<uint16_t> data, bmpIndex, suppIndex1, suppIndex2;
+	std::map<std::vector<uint16_t>, uint16_t> dataBlocks, index2Blocks;
+	std::vector<uint16_t> block(IDNAPropsBlockLength);
+	std::vector<uint16_t> index2Block(IDNAPropsIndex2BlockLength);
+	for (UChar32 start = 0; start < 0x110000; start += IDNAPropsBlockLength) {
+		for (int32_t i = 0; i < IDNAPropsBlockLength; ++i) {
+			block[i] = getProps(start + i);
+		}
+		uint16_t dataStart = addBlock(data, dataBlocks, block);
+		if (start < 0x10000) {
+			bmpIndex.push_back(dataStart);
+			continue;
+		}
+		int32_t i2 = (start >> IDNAPropsShift2) & (IDNAPropsIndex2BlockLength - 1);
+		index2Block[i2] = dataStart;
+		if (i2 == IDNAPropsIndex2BlockLength - 1) {
+			suppIndex1.push_back(addBlock(suppIndex2, index2Blocks, index2Block));
+		}
+	}
+	std::vector<uint32_t> inertBMP(0x10000 >> 5);
+	for (UChar32 c = 0; c < 0x10000; ++c) {
+		if (isInert(c)) {
+			inertBMP[c >> 5] |= (uint32_t) 1 << (c & 0x1f);
+		}
+	}
+	fprintf(out,
+			"// Copyright (C) 2016 and later: Unicode, Inc. and others.\n"
+			"// License & terms of use: http://www.unicode.org/copyright.html\n"
+			"//\n"
+			"// file name: u_idnaprops.cc\n"
+			"//\n"
+			"// machine-generated by: tools/genidnaprops.cpp\n"
+			"\n"
+			"#include \"u_idnaprops.h\"\n"
+			"\n"
+			"namespace uidna {\n"
+			"\n");
+	writeArray(out, "idnaPropsBMPIndex[0x10000 >> IDNAPropsShift2]", bmpIndex);
+	writeArray(out, "idnaPropsSuppIndex1[0x100000 >> IDNAPropsShift1]", suppIndex1);
+	writeArray(out, "idnaPropsSuppIndex2[]", suppIndex2);
+	writeArray(out, "idnaPropsData[]", data);
+	writeArray(out, "uts46InertBMP[0x10000 >> 5]", inertBMP);
+	fprintf(out, "}\n");
+	fprintf(stderr, "genidnaprops: %d data values, %d supplementary index-2 entries, %d bytes\n",
+			(int) data.size(), (int) suppIndex2.size(),
+			(int) (data.size() + bmpIndex.size() + suppIndex1.size() + suppIndex2.size()) * 2);
+	if (out != stdout) {
+		fclose(out);
+	}
+	return 0;
+}
@@ -0,0 +1,341 @@
+// uidna-conv: bulk conversion of host names
+//
+// Usage: uidna-conv [-a | -u] [-0] [-e] [-s] [-t] [-j threads] [-c cache bytes] [-o output] [input]
+//
+// Reads newline-delimited (or with -0 NUL-delimited) UTF-8 host names from the input file,
+// mapped into memory, or from stdin, and writes one converted name per input name,
+// with the same delimiter. With -e, each result is followed by a tab and the hex mask of UIDNA_ERROR_* bits.
+// Names are converted in blocks with uidna_nameToASCII_UTF8_batchParallel() (or the Unicode version),
+// while the results of the previous block are written by a separate thread.
+
+#include "unicode/uidna.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <thread>
+#include <vector>
+
+// Input bytes converted per block: large enough for the worker threads and the writes,
+// small enough to keep the per-block buffers in memory.
+static constexpr size_t BlockSize = 8 << 20;
+
+static void usage(const char *name) {
+	fprintf(stderr,
+			"Usage: %s [-a | -u] [-0] [-e] [-s] [-t] [-j threads] [-c cache bytes] [-o output] [input]\n"
+			"  -a  convert to ASCII (default)\n"
+			"  -u  convert to Unicode\n"
+			"  -0  names are NUL-delimited instead of newline-delimited\n"
+			"  -e  append a tab and the hex mask of UIDNA_ERROR_* bits to each result\n"
+			"  -s  use STD3 ASCII rules\n"
+			"  -t  use transitional processing\n"
+			"  -j  number of threads, 0 for all hardware threads (default)\n"
+			"  -c  result cache size in bytes, for inputs with repeated names\n"
+			"  -o  output file, stdout by default\n"
+			"  input file, stdin if missing or -\n", name);
+}
+
+// Input as a sequence of blocks that end at a delimiter (or at the end of the input).
+// Regular files are mapped into memory, other inputs are read into a growing buffer.
+class InputReader {
+public:
+	InputReader(char delimiter) : delimiter(delimiter) { }
+
+	~InputReader() {
+		if (mapped != NULL) {
+			munmap(mapped, mappedSize);
+		}
+		if (fd > STDIN_FILENO) {
+			close(fd);
+		}
+	}
+
+	bool open(const char *path) {
+		if (path != NULL && strcmp(path, "-") != 0) {
+			fd = ::open(path, O_RDONLY);
+			if (fd < 0) {
+				return false;
+			}
+		}
+		struct stat st;
+		if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+			void *p = mmap(NULL, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			if (p != MAP_FAILED) {
+				madvise(p, size_t(st.st_size), MADV_SEQUENTIAL);
+				mapped = static_cast<char *>(p);
+				mappedSize = size_t(st.st_size);
+			}
+		}
+		return true;
+	}
+
+	// Returns the next block, or false at the end of the input or on a read error.
+	bool next(const char *&data, size_t &length) {
+		return mapped != NULL ? nextMapped(data, length) : nextRead(data, length);
+	}
+
+	// errno of a failed read, 0 if none
+	int getError() const { return error; }
+
+private:
+	bool nextMapped(const char *&data, size_t &length) {
+		if (mappedPos >= mappedSize) {
+			return false;
+		}
+		size_t end = mappedSize - mappedPos > BlockSize ? mappedPos + BlockSize : mappedSize;
+		if (end < mappedSize) {
+			const char *d = static_cast<const char *>(memchr(mapped + end, delimiter, mappedSize - end));
+			end = d != NULL ? size_t(d - mapped) + 1 : mappedSize;
+		}
+		data = mapped + mappedPos;
+		length = end - mappedPos;
+		mappedPos = end;
+		return true;
+	}
+
+	bool nextRead(const char *&data, size_t &length) {
+		// Keep the incomplete name after the previous block.
+		buffer.erase(buffer.begin(), buffer.begin() + consumed);
+		consumed = 0;
+		size_t target = BlockSize;
+		for (;;) {
+			fill(target);
+			size_t end = buffer.size();
+			while (end > 0 && buffer[end - 1] != delimiter) {
+				--end;
+			}
+			if (end == 0 && !eof) {
+				target = buffer.size() * 2;  // a single name longer than the block
+				continue;
+			}
+			consumed = eof ? buffer.size() : end;
+			data = buffer.data();
+			length = consumed;
+			return length > 0;
+		}
+	}
+
+	void fill(size_t target) {
+		while (!eof && buffer.size() < target) {
+			size_t size = buffer.size();
+			buffer.resize(target);
+			ssize_t n;
+			do {
+				n = read(fd, buffer.data() + size, target - size);
+			} while (n < 0 && errno == EINTR);
+			if (n < 0) {
+				error = errno;
+				n = 0;
+			}
+			buffer.resize(size + size_t(n));
+			eof = n == 0;
+		}
+	}
+
+	char delimiter;
+	int fd = STDIN_FILENO;
+	char *mapped = NULL;
+	size_t mappedSize = 0;
+	size_t mappedPos = 0;
+	std::vector<char> buffer;
+	size_t consumed = 0;
+	bool eof = false;
+	int error = 0;
+};
+
+static bool writeAll(int fd, const char *data, size_t length) {
+	while (length > 0) {
+		ssize_t n = write(fd, data, length);
+		if (n < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			return false;
+		}
+		data += n;
+		length -= size_t(n);
+	}
+	return true;
+}
+
+static char *appendErrors(char *p, uint32_t errors) {
+	static const char digits[] = "0123456789abcdef";
+	*p++ = '\t';
+	*p++ = '0';
+	*p++ = 'x';
+	int32_t shift = 28;
+	while (shift > 0 && (errors >> shift) == 0) {
+		shift -= 4;
+	}
+	for (; shift >= 0; shift -= 4) {
+		*p++ = digits[(errors >> shift) & 0xf];
+	}
+	return p;
+}
+
+int main(int argc, char *argv[]) {
+	UBool toASCII = true, withErrors = false;
+	char delimiter = '\n';
+	uint32_t options = UIDNA_CHECK_BIDI | UIDNA_CHECK_CONTEXTJ | UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE;
+	int32_t threadCount = 0;
+	int64_t cacheSize = 0;
+	const char *outputPath = NULL;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "au0estj:c:o:h")) != -1) {
+		switch (opt) {
+		case 'a': toASCII = true; break;
+		case 'u': toASCII = false; break;
+		case '0': delimiter = '\0'; break;
+		case 'e': withErrors = true; break;
+		case 's': options |= UIDNA_USE_STD3_RULES; break;
+		case 't': options &= ~(UIDNA_NONTRANSITIONAL_TO_ASCII | UIDNA_NONTRANSITIONAL_TO_UNICODE); break;
+		case 'j': threadCount = atoi(optarg); break;
+		case 'c': cacheSize = atoll(optarg); break;
+		case 'o': outputPath = optarg; break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+	if (optind + 1 < argc || threadCount < 0 || cacheSize < 0) {
+		usage(argv[0]);
+		return EXIT_FAILURE;
+	}
+	const char *inputPath = optind < argc ? argv[optind] : NULL;
+
+	InputReader input(delimiter);
+	if (!input.open(inputPath)) {
+		fprintf(stderr, "%s: %s: %s\n", argv[0], inputPath, strerror(errno));
+		return EXIT_FAILURE;
+	}
+	int outputFd = STDOUT_FILENO;
+	if (outputPath != NULL && strcmp(outputPath, "-") != 0) {
+		outputFd = open(outputPath, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+		if (outputFd < 0) {
+			fprintf(stderr, "%s: %s: %s\n", argv[0], outputPath, strerror(errno));
+			return EXIT_FAILURE;
+		}
+	}
+
+	UErrorCode errorCode = U_ZERO_ERROR;
+	UIDNA *idna = uidna_open(options, &errorCode);
+	if (cacheSize > 0) {
+		uidna_setCache(idna, cacheSize, &errorCode);
+	}
+	if (errorCode > U_ZERO_ERROR) {
+		fprintf(stderr, "%s: uidna_open() failed: %s\n", argv[0], u_errorName(errorCode));
+		return EXIT_FAILURE;
+	}
+
+	std::vector<UIDNAName> names;
+	std::vector<int32_t> offsets, lengths;
+	std::vector<UIDNAInfo> infos;
+	std::vector<char> arena;
+	std::vector<char> outputs[2];
+	std::thread writer;
+	int writeError = 0;
+	int32_t current = 0;
+	int status = EXIT_SUCCESS;
+
+	const char *data;
+	size_t length;
+	while (input.next(data, length)) {
+		names.clear();
+		for (size_t pos = 0; pos < length;) {
+			const char *d = static_cast<const char *>(memchr(data + pos, delimiter, length - pos));
+			size_t end = d != NULL ? size_t(d - data) : length;
+			size_t nameLength = end - pos;
+			if (delimiter == '\n' && nameLength > 0 && data[end - 1] == '\r') {
+				--nameLength;
+			}
+			if (nameLength > INT32_MAX) {
+				fprintf(stderr, "%s: name too long\n", argv[0]);
+				status = EXIT_FAILURE;
+				break;
+			}
+			names.push_back(UIDNAName{ data + pos, int32_t(nameLength) });
+			pos = end + 1;
+		}
+		if (status != EXIT_SUCCESS) {
+			break;
+		}
+
+		int32_t count = int32_t(names.size());
+		offsets.resize(count);
+		lengths.resize(count);
+		infos.resize(count);
+		if (arena.size() < length * 2) {
+			arena.resize(length * 2);
+		}
+		int32_t total;
+		for (;;) {
+			errorCode = U_ZERO_ERROR;
+			total = toASCII
+					? uidna_nameToASCII_UTF8_batchParallel(idna, names.data(), count, arena.data(), int32_t(arena.size()),
+							offsets.data(), lengths.data(), infos.data(), threadCount, &errorCode)
+					: uidna_nameToUnicodeUTF8_batchParallel(idna, names.data(), count, arena.data(), int32_t(arena.size()),
+							offsets.data(), lengths.data(), infos.data(), threadCount, &errorCode);
+			if (errorCode != U_BUFFER_OVERFLOW_ERROR) {
+				break;
+			}
+			arena.resize(size_t(total));
+		}
+		if (errorCode > U_ZERO_ERROR) {
+			fprintf(stderr, "%s: conversion failed: %s\n", argv[0], u_errorName(errorCode));
+			status = EXIT_FAILURE;
+			break;
+		}
+
+		// Format into the buffer that is not being written, then hand it to the writer.
+		std::vector<char> &output = outputs[current];
+		output.resize(size_t(total) + size_t(count) * (withErrors ? 12 : 1));
+		char *p = output.data();
+		for (int32_t i = 0; i < count; ++i) {
+			memcpy(p, arena.data() + offsets[i], size_t(lengths[i]));
+			p += lengths[i];
+			if (withErrors) {
+				p = appendErrors(p, infos[i].errors);
+			}
+			*p++ = delimiter;
+		}
+		output.resize(size_t(p - output.data()));
+
+		if (writer.joinable()) {
+			writer.join();
+		}
+		if (writeError != 0) {
+			break;
+		}
+		writer = std::thread([&output, outputFd, &writeError] {
+			if (!writeAll(outputFd, output.data(), output.size())) {
+				writeError = errno;
+			}
+		});
+		current ^= 1;
+	}
+	if (writer.joinable()) {
+		writer.join();
+	}
+
+	if (writeError != 0) {
+		fprintf(stderr, "%s: write failed: %s\n", argv[0], strerror(writeError));
+		status = EXIT_FAILURE;
+	}
+	if (input.getError() != 0) {
+		fprintf(stderr, "%s: read failed: %s\n", argv[0], strerror(input.getError()));
+		status = EXIT_FAILURE;
+	}
+	if (outputFd != STDOUT_FILENO && close(outputFd) != 0) {
+		fprintf(stderr, "%s: %s: %s\n", argv[0], outputPath, strerror(errno));
+		status = EXIT_FAILURE;
+	}
+	uidna_close(idna);
+	return status;
+}